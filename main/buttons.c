@@ -0,0 +1,276 @@
+/**
+ * @file buttons.c
+ * @brief Button driver
+ *
+ * The buttons are read on GPIO interrupts, not polled. An edge on any button pin (re)starts the debounce timer,
+ * when the pins did not change for BUTTONS_DEBOUNCE_MS their levels are the new stable states of the buttons.
+ * Changes of the stable states are queued as press and release events, read them with buttons_get_event().
+ *
+ * A press that is released again before the pins are stable is still queued (as a press and a release),
+ * so short presses are not lost.
+ *
+ * While a button is held, a long press event is queued after BUTTONS_LONG_PRESS_MS, and repeat events every
+ * BUTTONS_REPEAT_MS after that. Only the last pressed button is repeated.
+ *
+ * @note The timer callbacks run in the esp_timer task, they are the only writers of the button states
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "buttons.h"
+
+#define NO_BUTTON BUTTONS_ID_COUNT
+
+static const char *TAG = "buttons";
+static buttons_config_t buttons_config;
+static QueueHandle_t event_queue;
+static esp_timer_handle_t debounce_timer;
+static esp_timer_handle_t hold_timer;
+static portMUX_TYPE edge_lock = portMUX_INITIALIZER_UNLOCKED;   // Protects edge_pending, edge_time_us and edge_pressed
+static bool edge_pending[BUTTONS_ID_COUNT];         // The pin changed since the last debounce
+static int64_t edge_time_us[BUTTONS_ID_COUNT];      // Time of the first change since the last debounce
+static bool edge_pressed[BUTTONS_ID_COUNT];         // The pin was seen pressed since the last debounce
+static volatile bool pressed[BUTTONS_ID_COUNT];     // Stable (debounced) states
+static buttons_id_t held_button = NO_BUTTON;        // Button of the long press and repeat events
+static bool long_press_sent = false;
+
+// Function prototypes
+static void button_isr_handler(void *arg);
+static void debounce_timer_cb(void *arg);
+static void hold_timer_cb(void *arg);
+static void queue_event(buttons_id_t button, buttons_event_type_t type, int64_t time_us);
+static void start_hold(buttons_id_t button);
+
+
+/**
+ * @brief Initialize the buttons
+ *
+ * Configures the pins (input with pull-up, interrupt on both edges) and the timers.
+ *
+ * @param[in] config The pins of the buttons, and the function called when events are queued
+ * @return ESP_OK on success
+ */
+esp_err_t buttons_init(const buttons_config_t *config) {
+    uint64_t pin_mask = 0;
+
+    ESP_LOGI(TAG, "Initializing buttons");
+    buttons_config = *config;
+
+    event_queue = xQueueCreate(BUTTONS_QUEUE_LENGTH, sizeof(buttons_event_t));
+    if (event_queue == NULL) {
+        ESP_LOGE(TAG, "Failed to create the event queue");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_timer_create_args_t debounce_timer_args = {
+            .callback = &debounce_timer_cb,
+            .name = "buttons_debounce"
+    };
+    if (esp_timer_create(&debounce_timer_args, &debounce_timer) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create the debounce timer");
+        return ESP_FAIL;
+    }
+    const esp_timer_create_args_t hold_timer_args = {
+            .callback = &hold_timer_cb,
+            .name = "buttons_hold"
+    };
+    if (esp_timer_create(&hold_timer_args, &hold_timer) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create the hold timer");
+        return ESP_FAIL;
+    }
+
+    for (uint8_t i = 0; i < BUTTONS_ID_COUNT; i++) {
+        pin_mask |= 1ULL << buttons_config.pins[i];
+    }
+    const gpio_config_t gpio_cfg = {
+            .pin_bit_mask = pin_mask,
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = GPIO_PULLUP_ENABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_ANYEDGE,
+    };
+    if (gpio_config(&gpio_cfg) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure the button pins");
+        return ESP_FAIL;
+    }
+
+    // The ISR service may already be installed by another driver
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "Failed to install the GPIO ISR service");
+        return ESP_FAIL;
+    }
+
+    for (uint8_t i = 0; i < BUTTONS_ID_COUNT; i++) {
+        pressed[i] = gpio_get_level(buttons_config.pins[i]) == 0;
+        if (gpio_isr_handler_add(buttons_config.pins[i], button_isr_handler, (void *)(uintptr_t)i) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to add the interrupt handler of button %d", i);
+            return ESP_FAIL;
+        }
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Get the next button event
+ *
+ * @param[out] event The event
+ * @return true if an event was queued, false if the queue is empty
+ */
+bool buttons_get_event(buttons_event_t *event) {
+    return xQueueReceive(event_queue, event, 0) == pdTRUE;
+}
+
+/**
+ * @brief Check if a button is pressed
+ *
+ * @param[in] button The button
+ * @return The stable (debounced) state of the button, true if pressed
+ */
+bool buttons_is_pressed(buttons_id_t button) {
+    return pressed[button];
+}
+
+/**
+ * @brief Check if any button is pressed
+ *
+ * @return true if a button is pressed, or if a change is not debounced yet
+ */
+bool buttons_any_pressed(void) {
+    for (uint8_t i = 0; i < BUTTONS_ID_COUNT; i++) {
+        if (pressed[i]) {
+            return true;
+        }
+    }
+    return esp_timer_is_active(debounce_timer);
+}
+
+/**
+ * @brief Handle an edge on a button pin
+ *
+ * Records the edge, and restarts the debounce timer.
+ *
+ * @note esp_timer_stop() and esp_timer_start_once() are in IRAM and can be called from an ISR
+ * @param arg The button (buttons_id_t)
+ */
+static void IRAM_ATTR button_isr_handler(void *arg) {
+    buttons_id_t button = (buttons_id_t)(uintptr_t)arg;
+
+    portENTER_CRITICAL_ISR(&edge_lock);
+    if (!edge_pending[button]) {
+        edge_pending[button] = true;
+        edge_time_us[button] = esp_timer_get_time();
+    }
+    if (gpio_get_level(buttons_config.pins[button]) == 0) {
+        edge_pressed[button] = true;
+    }
+    portEXIT_CRITICAL_ISR(&edge_lock);
+
+    esp_timer_stop(debounce_timer);
+    esp_timer_start_once(debounce_timer, BUTTONS_DEBOUNCE_MS * 1000);
+}
+
+/**
+ * @brief Update the stable states when the pins did not change for BUTTONS_DEBOUNCE_MS, and queue the changes
+ *
+ * @param arg unused
+ */
+static void debounce_timer_cb(void *arg) {
+    bool queued = false;
+
+    for (uint8_t i = 0; i < BUTTONS_ID_COUNT; i++) {
+        bool level_pressed = gpio_get_level(buttons_config.pins[i]) == 0;
+
+        portENTER_CRITICAL(&edge_lock);
+        bool changed = edge_pending[i];
+        int64_t time_us = edge_time_us[i];
+        bool was_pressed = edge_pressed[i];
+        edge_pending[i] = false;
+        edge_pressed[i] = false;
+        portEXIT_CRITICAL(&edge_lock);
+
+        if (!changed) {
+            continue;
+        }
+
+        if (level_pressed != pressed[i]) {
+            pressed[i] = level_pressed;
+            queue_event(i, level_pressed ? BUTTONS_EVENT_PRESS : BUTTONS_EVENT_RELEASE, time_us);
+            queued = true;
+            if (level_pressed) {
+                start_hold(i);
+            }
+            else if (held_button == i) {
+                esp_timer_stop(hold_timer);
+                held_button = NO_BUTTON;
+            }
+        }
+        else if (!level_pressed && was_pressed) {
+            // Pressed and released within the debounce time
+            queue_event(i, BUTTONS_EVENT_PRESS, time_us);
+            queue_event(i, BUTTONS_EVENT_RELEASE, esp_timer_get_time());
+            queued = true;
+        }
+    }
+
+    if (queued && buttons_config.event_cb != NULL) {
+        buttons_config.event_cb(buttons_config.event_cb_arg);
+    }
+}
+
+/**
+ * @brief Queue the long press or repeat event of the held button
+ *
+ * @param arg unused
+ */
+static void hold_timer_cb(void *arg) {
+    if (held_button == NO_BUTTON || !pressed[held_button]) {
+        return;
+    }
+
+    queue_event(held_button, long_press_sent ? BUTTONS_EVENT_REPEAT : BUTTONS_EVENT_LONG_PRESS, esp_timer_get_time());
+    long_press_sent = true;
+    esp_timer_start_once(hold_timer, BUTTONS_REPEAT_MS * 1000);
+
+    if (buttons_config.event_cb != NULL) {
+        buttons_config.event_cb(buttons_config.event_cb_arg);
+    }
+}
+
+/**
+ * @brief Queue an event, the event is dropped if the queue is full
+ *
+ * @param[in] button The button
+ * @param[in] type The event type
+ * @param[in] time_us The time of the event
+ */
+static void queue_event(buttons_id_t button, buttons_event_type_t type, int64_t time_us) {
+    const buttons_event_t event = {
+            .button = button,
+            .type = type,
+            .time_us = time_us,
+    };
+
+    if (xQueueSend(event_queue, &event, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Event queue full, event of button %d dropped", button);
+    }
+}
+
+/**
+ * @brief Start the long press timer of a button
+ *
+ * @param[in] button The pressed button
+ */
+static void start_hold(buttons_id_t button) {
+    esp_timer_stop(hold_timer);
+    held_button = button;
+    long_press_sent = false;
+    esp_timer_start_once(hold_timer, BUTTONS_LONG_PRESS_MS * 1000);
+}
@@ -1,83 +1,86 @@
 /**
  * @file buzzer.c
- * @brief This file contains the buzzer task and related functions
+ * @brief This file contains the buzzer sequencer and related functions
+ *
+ * A beep is a pattern of tones (frequency, duration and gap after the tone), played by a one-shot esp_timer.
+ * Each timer callback starts or stops a tone, and arms the timer for the next change, so no task is blocked
+ * while a beep plays. Beeps are queued with buzzer_beep(), which never blocks.
+ *
+ * @note The LEDC channel is only changed from the timer callback (the esp_timer task)
  */
 
-#include <sys/cdefs.h>
-#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
-#include <freertos/queue.h>
 #include "driver/ledc.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "buzzer.h"
 
 #define BUZZER_QUEUE_LENGTH 10
 
+// A tone of a beep pattern
+typedef struct {
+    uint32_t freq_hz;
+    uint16_t duration_ms;
+    uint16_t gap_ms;            // Silence after the tone
+} buzzer_tone_t;
+
+typedef struct {
+    const buzzer_tone_t *tones;
+    uint8_t length;
+} buzzer_pattern_t;
+
+static const buzzer_tone_t beep_short_tones[] = {
+        {BUZZER_DEFAULT_FREQ_HZ, BUZZER_BEEP_SHORT_TIME_MS, 0},
+};
+static const buzzer_tone_t beep_long_tones[] = {
+        {BUZZER_DEFAULT_FREQ_HZ, BUZZER_BEEP_LONG_TIME_MS, 0},
+};
+static const buzzer_tone_t beep_double_tones[] = {
+        {BUZZER_BEEP_DOUBLE_LOW_FREQ_HZ, BUZZER_BEEP_SHORT_TIME_MS, 0},
+        {BUZZER_BEEP_DOUBLE_HIGH_FREQ_HZ, BUZZER_BEEP_LONG_TIME_MS, 0},
+};
+
+// Patterns, indexed by beep type
+static const buzzer_pattern_t patterns[BUZZER_BEEP_TYPE_COUNT] = {
+        [BUZZER_BEEP_TYPE_SHORT] = {beep_short_tones, sizeof(beep_short_tones) / sizeof(beep_short_tones[0])},
+        [BUZZER_BEEP_TYPE_LONG] = {beep_long_tones, sizeof(beep_long_tones) / sizeof(beep_long_tones[0])},
+        [BUZZER_BEEP_TYPE_DOUBLE] = {beep_double_tones, sizeof(beep_double_tones) / sizeof(beep_double_tones[0])},
+};
+
 static char *TAG = "buzzer";
-static QueueHandle_t buzzer_queue;
+static esp_timer_handle_t sequencer_timer;
 
-// Function prototypes
-static void buzzer_init(void);
-static void beep_long(void);
-static void beep_short(void);
-static void beep_double(void);
+// Queue of beeps waiting to be played, protected by queue_lock
+static portMUX_TYPE queue_lock = portMUX_INITIALIZER_UNLOCKED;
+static enum buzzer_beep_type_e beep_queue[BUZZER_QUEUE_LENGTH];
+static uint8_t queue_head = 0;
+static uint8_t queue_count = 0;
+static bool playing = false;                // The sequencer timer is running, or is about to run
 
+// State of the sequencer, only used by the timer callback
+static const buzzer_pattern_t *current_pattern = NULL;
+static uint8_t current_tone = 0;
+static bool tone_on = false;
 
-/**
- * @brief Initialize the buzzer, and process buzzer events from the buzzer queue
- *
- * @param pvParameters unused
- */
-_Noreturn void buzzer_task(void *pvParameters) {
-    enum buzzer_beep_type_e beep_type;
-    buzzer_queue = xQueueCreate(BUZZER_QUEUE_LENGTH, sizeof(enum buzzer_beep_type_e));
-
-    // Initialize the buzzer hardware
-    buzzer_init();
-
-    // Process buzzer events from the buzzer queue
-    while (true) {
-        if (xQueueReceive(buzzer_queue, &beep_type, portMAX_DELAY)) {
-            switch (beep_type) {
-                case BUZZER_BEEP_TYPE_SHORT:
-                    beep_short();
-                    break;
-                case BUZZER_BEEP_TYPE_LONG:
-                    beep_long();
-                    break;
-                case BUZZER_BEEP_TYPE_DOUBLE:
-                    beep_double();
-                    break;
-                default:
-                    ESP_LOGE(TAG, "Unknown beep type");
-            }
-        }
-    }
-}
+// Function prototypes
+static void sequencer_timer_cb(void *arg);
+static bool next_pattern(void);
+static void start_tone(uint32_t freq_hz);
+static void stop_tone(void);
 
-/**
- * @brief Beep the buzzer based on the beep type
- *
- * Add a beep to the buzzer queue.
- * This function is thread-safe, and can be called from any task.
- *
- * @param beep_type The type of beep to play
- */
-void buzzer_beep(enum buzzer_beep_type_e beep_type) {
-    xQueueSend(buzzer_queue, &beep_type, portMAX_DELAY);
-}
 
 /**
- * @brief Initialize the buzzer hardware
+ * @brief Initialize the buzzer hardware and the sequencer timer
  *
  * Uses the LEDC peripheral to generate a PWM signal on the buzzer pin.
  * By default, the buzzer is off (duty = 0).
  *
- * @note This function should only be called once, from the buzzer task
+ * @note This function should only be called once, before buzzer_beep()
  */
-static void buzzer_init(void) {
+void buzzer_init(void) {
     ESP_LOGI(TAG, "Initializing buzzer");
     ledc_timer_config_t ledc_timer = {
             .duty_resolution = BUZZER_RESOLUTION,
@@ -99,48 +102,132 @@ static void buzzer_init(void) {
             .hpoint = 0,
     };
     ESP_ERROR_CHECK(ledc_channel_config(&ledc_channel));
+
+    const esp_timer_create_args_t sequencer_timer_args = {
+            .callback = &sequencer_timer_cb,
+            .name = "buzzer_sequencer"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&sequencer_timer_args, &sequencer_timer));
 }
 
 /**
- * @brief Beep with default frequency for BUZZER_BEEP_SHORT_TIME_MS
- * @warning This function is not thread safe, and should only be called from the buzzer task
+ * @brief Beep the buzzer based on the beep type
+ *
+ * Add a beep to the buzzer queue, and start the sequencer if it is idle.
+ * This function does not block, and can be called from any task (also with the LVGL mutex taken).
+ * A beep of the same type as the last waiting beep is coalesced with it, and a beep is dropped if the queue is full.
+ *
+ * @param beep_type The type of beep to play
  */
-static void beep_short(void) {
-    ESP_LOGD(TAG, "Beeping short");
-    ledc_set_freq(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_TIMER, BUZZER_DEFAULT_FREQ_HZ);
-    ledc_set_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL, BUZZER_DUTY);
-    ledc_update_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL);
-    vTaskDelay(pdMS_TO_TICKS(BUZZER_BEEP_SHORT_TIME_MS));
-    ledc_set_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL, 0);
-    ledc_update_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL);
+void buzzer_beep(enum buzzer_beep_type_e beep_type) {
+    bool start = false;
+    bool dropped = false;
+
+    if (sequencer_timer == NULL || beep_type >= BUZZER_BEEP_TYPE_COUNT) {
+        ESP_LOGE(TAG, "Buzzer not initialized, or unknown beep type");
+        return;
+    }
+
+    portENTER_CRITICAL(&queue_lock);
+    uint8_t last = (queue_head + queue_count + BUZZER_QUEUE_LENGTH - 1) % BUZZER_QUEUE_LENGTH;
+    if (queue_count > 0 && beep_queue[last] == beep_type) {
+        // Coalesce repeats, the same beep is already waiting
+    }
+    else if (queue_count < BUZZER_QUEUE_LENGTH) {
+        beep_queue[(queue_head + queue_count) % BUZZER_QUEUE_LENGTH] = beep_type;
+        queue_count++;
+    }
+    else {
+        dropped = true;
+    }
+    if (!playing && queue_count > 0) {
+        playing = true;
+        start = true;
+    }
+    portEXIT_CRITICAL(&queue_lock);
+
+    if (dropped) {
+        ESP_LOGW(TAG, "Buzzer queue full, beep dropped");
+    }
+    if (start) {
+        esp_timer_start_once(sequencer_timer, 0);
+    }
 }
 
 /**
- * @brief Beep with default frequency for BUZZER_BEEP_LONG_TIME_MS
- * @warning This function is not thread safe, and should only be called from the buzzer task
+ * @brief Play the next step of the current pattern
+ *
+ * Stops the playing tone and waits for its gap, or starts the next tone (of the current or the next pattern).
+ * The sequencer stops when the queue is empty.
+ *
+ * @param arg unused
  */
-static void beep_long(void) {
-    ESP_LOGD(TAG, "Beeping long");
-    ledc_set_freq(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_TIMER, BUZZER_DEFAULT_FREQ_HZ);
-    ledc_set_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL, BUZZER_DUTY);
-    ledc_update_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL);
-    vTaskDelay(pdMS_TO_TICKS(BUZZER_BEEP_LONG_TIME_MS));
-    ledc_set_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL, 0);
-    ledc_update_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL);
+static void sequencer_timer_cb(void *arg) {
+    if (tone_on) {
+        const buzzer_tone_t *tone = &current_pattern->tones[current_tone];
+
+        stop_tone();
+        current_tone++;
+        if (tone->gap_ms > 0) {
+            esp_timer_start_once(sequencer_timer, tone->gap_ms * 1000);
+            return;
+        }
+    }
+
+    if (current_pattern == NULL || current_tone >= current_pattern->length) {
+        if (!next_pattern()) {
+            return;
+        }
+    }
+
+    const buzzer_tone_t *tone = &current_pattern->tones[current_tone];
+    start_tone(tone->freq_hz);
+    esp_timer_start_once(sequencer_timer, tone->duration_ms * 1000);
+}
+
+/**
+ * @brief Take the next beep from the queue, and make its pattern the current pattern
+ *
+ * @return true if there is a next pattern, false if the queue is empty and the sequencer stopped
+ */
+static bool next_pattern(void) {
+    enum buzzer_beep_type_e beep_type;
+
+    portENTER_CRITICAL(&queue_lock);
+    if (queue_count == 0) {
+        playing = false;
+        portEXIT_CRITICAL(&queue_lock);
+        current_pattern = NULL;
+        return false;
+    }
+    beep_type = beep_queue[queue_head];
+    queue_head = (queue_head + 1) % BUZZER_QUEUE_LENGTH;
+    queue_count--;
+    portEXIT_CRITICAL(&queue_lock);
+
+    ESP_LOGD(TAG, "Beeping pattern %d", beep_type);
+    current_pattern = &patterns[beep_type];
+    current_tone = 0;
+    return true;
 }
 
 /**
- * @brief Beep with a lower freq, then a higher freq for BUZZER_BEEP_SHORT_TIME_MS and BUZZER_BEEP_LONG_TIME_MS
- * @warning This function is not thread safe, and should only be called from the buzzer task
+ * @brief Start a tone on the buzzer
+ *
+ * @param[in] freq_hz The frequency of the tone
  */
-static void beep_double(void) {
-    ESP_LOGD(TAG, "Beeping double");
-    ledc_set_freq(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_TIMER, BUZZER_BEEP_DOUBLE_LOW_FREQ_HZ);
+static void start_tone(uint32_t freq_hz) {
+    ledc_set_freq(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_TIMER, freq_hz);
     ledc_set_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL, BUZZER_DUTY);
     ledc_update_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL);
-    vTaskDelay(pdMS_TO_TICKS(BUZZER_BEEP_SHORT_TIME_MS));
-    ledc_set_freq(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_TIMER, BUZZER_BEEP_DOUBLE_HIGH_FREQ_HZ);
-    vTaskDelay(pdMS_TO_TICKS(BUZZER_BEEP_LONG_TIME_MS));
+    tone_on = true;
+}
+
+/**
+ * @brief Stop the tone on the buzzer
+ */
+static void stop_tone(void) {
     ledc_set_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL, 0);
     ledc_update_duty(BUZZER_LEDC_SPEED_MODE, BUZZER_LEDC_CHANNEL);
-}
\ No newline at end of file
+    tone_on = false;
+}
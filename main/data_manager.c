@@ -4,10 +4,14 @@
  *
  * The data manager is responsible for managing the data used by the application.
  * The data can be set by different data providers (e.g. the web client) and can be used by the rest of the application.
+ *
+ * Consumers subscribe to the fields they need with data_manager_subscribe(). Changed fields are collected when they are set,
+ * and are delivered to the subscribers from the app event loop when the data provider calls one of the notify functions.
  */
 
 #include <stdint.h>
 #include <time.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
@@ -15,7 +19,12 @@
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_event.h"
+#include "esp_timer.h"
+#include "nvs.h"
 #include "data_manager.h"
+#include "demand_calculator.h"
+#include "ingest_log.h"
+#include "local_clock.h"
 
 ESP_EVENT_DEFINE_BASE(DATA_MANAGER_EVENTS);
 
@@ -24,6 +33,40 @@ extern esp_event_loop_handle_t app_loop_handle;
 static const char *TAG = "data_manager";
 data_manager_data_t data_manager_data;
 SemaphoreHandle_t data_manager_data_mutex;
+static demand_calculator_t demand_calculator;
+static energy_buckets_t energy_buckets;
+static rolling_stats_t demand_stats[DM_DSW_LENGTH];
+static const uint32_t demand_stats_window_s[DM_DSW_LENGTH] = {
+        [DM_DSW_1_MIN] = 60,
+        [DM_DSW_15_MIN] = 15 * 60,
+        [DM_DSW_1_HOUR] = 60 * 60,
+};
+
+_Static_assert(DM_DF_LENGTH <= sizeof(data_manager_field_mask_t) * 8, "Too many data fields for the field mask");
+
+typedef struct {
+    bool in_use;
+    data_manager_subscription_config_t config;
+    data_manager_field_mask_t pending_fields;   // Changed fields not yet delivered
+    int64_t last_delivery_us;                   // Time of the last call of the callback, 0 if never called
+    esp_timer_handle_t coalesce_timer;          // Delivers coalesced updates at the end of the interval
+} subscriber_t;
+
+// Protected by data_manager_data_mutex
+static subscriber_t subscribers[DATA_MANAGER_MAX_SUBSCRIBERS];
+static data_manager_field_mask_t changed_fields;    // Fields changed since the last notify
+static bool persistence_enabled = true;             // Store the energy buckets in NVS, disabled during a replay
+
+// Function prototypes
+static void update_local_demand(void);
+static void add_demand_stats_sample(time_t timestamp, float demand);
+static bool update_energy_buckets(void);
+static esp_err_t store_energy_buckets(const energy_buckets_t *eb);
+static esp_err_t read_energy_buckets_nvs(void);
+static void update_field(enum data_manager_data_fields_e field, void *dst, const void *src, size_t size);
+static bool publish_changed_fields(void);
+static void deliver_subscriptions(void* handler_arg, esp_event_base_t base, int32_t id, void* event_data);
+static void coalesce_timer_cb(void *arg);
 
 /**
  * @brief Initialize the data manager
@@ -35,6 +78,45 @@ void data_manager_init(void) {
         ESP_LOGE(TAG, "Failed to create data manager data mutex");
         abort();
     }
+    demand_calculator_reset(&demand_calculator);
+
+    // Continue with the buckets of before the restart
+    if (read_energy_buckets_nvs() != ESP_OK) {
+        energy_buckets_reset(&energy_buckets);
+    }
+
+    // Room for a sample every second
+    for (uint8_t i = 0; i < DM_DSW_LENGTH; i++) {
+        ESP_ERROR_CHECK(rolling_stats_init(&demand_stats[i], demand_stats_window_s[i], demand_stats_window_s[i]));
+    }
+
+    ESP_ERROR_CHECK(esp_event_handler_register_with(app_loop_handle, DATA_MANAGER_EVENTS, DATA_MANAGER_DELIVER_SUBSCRIPTIONS, deliver_subscriptions, NULL));
+}
+
+/**
+ * @brief Start from a scratch state for a replay of an ingest log
+ *
+ * Clears the meter and history data, the demand calculator, the statistics and the energy buckets (also the ones read
+ * from NVS), and stops storing the energy buckets in NVS. Every replay then starts from the same state, and does not
+ * overwrite the buckets of normal operation.
+ *
+ * @note Call before the first replayed record, there is no way back to normal operation without a restart
+ */
+void data_manager_start_replay(void) {
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+
+    persistence_enabled = false;
+    memset(&data_manager_data, 0, sizeof(data_manager_data_t));
+    demand_calculator_reset(&demand_calculator);
+    energy_buckets_reset(&energy_buckets);
+    for (uint8_t i = 0; i < DM_DSW_LENGTH; i++) {
+        rolling_stats_reset(&demand_stats[i]);
+    }
+    changed_fields |= DM_DF_MASK_ALL;
+
+    xSemaphoreGive(data_manager_data_mutex);
+
+    ESP_LOGI(TAG, "Replay started, data cleared and energy buckets not stored");
 }
 
 /**
@@ -68,12 +150,409 @@ data_manager_history_data_t * data_manager_get_history_data(void) {
     return &data_manager_data.history_data;
 }
 
+/**
+ * @brief Notify the subscribers that new meter data is available
+ *
+ * Updates the locally calculated demand values, and delivers all fields changed since the last notification.
+ */
 void data_manager_notify_new_meter_data_available(void) {
-    ESP_ERROR_CHECK(esp_event_post_to(app_loop_handle, DATA_MANAGER_EVENTS, DATA_MANAGER_NEW_METER_DATA_AVAILABLE, NULL, 0, portMAX_DELAY));
+    static energy_buckets_t energy_buckets_copy;    // Only used by the data provider task, too large for its stack
+    static data_manager_meter_data_t meter_data_copy;
+    bool recording = ingest_log_is_recording();
+
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+    if (recording) {
+        meter_data_copy = data_manager_data.meter_data;
+    }
+    time_t p1_timestamp = data_manager_data.meter_data.p1_timestamp;
+    update_local_demand();
+    add_demand_stats_sample(data_manager_data.meter_data.p1_timestamp, data_manager_data.meter_data.current_avg_demand);
+    bool store_buckets = update_energy_buckets() && persistence_enabled;
+    if (store_buckets) {
+        energy_buckets_copy = energy_buckets;
+    }
+    bool deliver = publish_changed_fields();
+    xSemaphoreGive(data_manager_data_mutex);
+
+    // The meter data can be old when the data provider stalls, so it can only move the clock forward
+    local_clock_discipline(LOCAL_CLOCK_SOURCE_P1, p1_timestamp, LOCAL_CLOCK_UNBOUNDED_LAG);
+
+    // Write the log outside the mutex, the file system can be slow
+    if (recording) {
+        ingest_log_record_meter_data(&meter_data_copy);
+    }
+
+    // Store the buckets when a bucket is completed, so at most one bucket is lost on a restart (not during a replay)
+    if (store_buckets) {
+        store_energy_buckets(&energy_buckets_copy);
+    }
+
+    if (deliver) {
+        ESP_ERROR_CHECK(esp_event_post_to(app_loop_handle, DATA_MANAGER_EVENTS, DATA_MANAGER_DELIVER_SUBSCRIPTIONS, NULL, 0, portMAX_DELAY));
+    }
 }
 
+/**
+ * @brief Notify the subscribers that the history data was replaced
+ *
+ * The history data is written directly by the data provider, so the history fields are always reported as changed.
+ */
 void data_manager_notify_new_meter_history_data_available(void) {
-    ESP_ERROR_CHECK(esp_event_post_to(app_loop_handle, DATA_MANAGER_EVENTS, DATA_MANAGER_NEW_METER_HISTORY_DATA_AVAILABLE, NULL, 0, portMAX_DELAY));
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+
+    // Recorded under the mutex, the history is too large to copy and is only replaced at startup
+    ingest_log_record_history_data(&data_manager_data.history_data);
+
+    // Restart the demand statistics from the history
+    for (uint8_t i = 0; i < DM_DSW_LENGTH; i++) {
+        rolling_stats_reset(&demand_stats[i]);
+    }
+    for (uint16_t i = 0; i < data_manager_data.history_data.max_demand_short_term_items; i++) {
+        add_demand_stats_sample(data_manager_data.history_data.max_demand_short_term[i].timestamp, data_manager_data.history_data.max_demand_short_term[i].demand);
+    }
+
+    changed_fields |= DM_DF_MASK(DM_DF_MAX_DEMAND_YEAR) | DM_DF_MASK(DM_DF_MAX_DEMAND_SHORT_TERM);
+    bool deliver = publish_changed_fields();
+    xSemaphoreGive(data_manager_data_mutex);
+
+    if (deliver) {
+        ESP_ERROR_CHECK(esp_event_post_to(app_loop_handle, DATA_MANAGER_EVENTS, DATA_MANAGER_DELIVER_SUBSCRIPTIONS, NULL, 0, portMAX_DELAY));
+    }
+}
+
+/**
+ * @brief Get the energy per interval of the last 24 hours
+ *
+ * @param[out] buckets The buckets, oldest first, the last bucket is still in progress
+ * @return The number of buckets, ENERGY_BUCKETS_COUNT or 0 if there is no data yet
+ */
+uint8_t data_manager_get_energy_buckets(energy_buckets_bucket_t buckets[ENERGY_BUCKETS_COUNT]) {
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+    uint8_t count = energy_buckets_get(&energy_buckets, buckets);
+    xSemaphoreGive(data_manager_data_mutex);
+
+    return count;
+}
+
+/**
+ * @brief Get the statistics of the average demand over a sliding window
+ *
+ * The window ends at the last sample, the statistics are updated with every data_manager_notify_new_meter_data_available().
+ *
+ * @param[in] window The window to get the statistics of
+ * @param[out] result The statistics, values in kW
+ * @return true if there are samples in the window, false otherwise
+ */
+bool data_manager_get_demand_stats(enum data_manager_demand_stats_window_e window, rolling_stats_result_t *result) {
+    if (window >= DM_DSW_LENGTH) {
+        ESP_LOGE(TAG, "Invalid demand statistics window");
+        return false;
+    }
+
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+    bool valid = rolling_stats_get(&demand_stats[window], result);
+    xSemaphoreGive(data_manager_data_mutex);
+
+    return valid;
+}
+
+/**
+ * @brief Subscribe to changes of data fields
+ *
+ * The callback is called from the app event loop task when one of the subscribed fields changed,
+ * at most once every min_interval_ms.
+ *
+ * @note Single items added with data_manager_add_max_demand_short_term_history_item() are not reported,
+ *       they follow DM_DF_CURRENT_AVG_DEMAND.
+ *
+ * @param[in] config The subscription configuration, copied
+ * @param[out] handle The handle of the subscription, used to unsubscribe
+ * @return
+ *   - ESP_OK on success
+ *   - ESP_ERR_INVALID_ARG if the config has no callback or no fields
+ *   - ESP_ERR_NO_MEM if the maximum number of subscribers is reached
+ */
+esp_err_t data_manager_subscribe(const data_manager_subscription_config_t *config, data_manager_subscription_handle_t *handle) {
+    if (config == NULL || config->callback == NULL || (config->fields & DM_DF_MASK_ALL) == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+    for (data_manager_subscription_handle_t i = 0; i < DATA_MANAGER_MAX_SUBSCRIBERS; i++) {
+        if (subscribers[i].in_use) {
+            continue;
+        }
+
+        if (subscribers[i].coalesce_timer == NULL) {
+            const esp_timer_create_args_t timer_args = {
+                    .callback = coalesce_timer_cb,
+                    .name = "dm_coalesce",
+            };
+            ESP_ERROR_CHECK(esp_timer_create(&timer_args, &subscribers[i].coalesce_timer));
+        }
+
+        subscribers[i].in_use = true;
+        subscribers[i].config = *config;
+        subscribers[i].pending_fields = 0;
+        subscribers[i].last_delivery_us = 0;
+        *handle = i;
+
+        xSemaphoreGive(data_manager_data_mutex);
+        ESP_LOGD(TAG, "New subscriber %d, fields 0x%08lx", i, config->fields);
+        return ESP_OK;
+    }
+    xSemaphoreGive(data_manager_data_mutex);
+
+    ESP_LOGE(TAG, "No free subscriber slots");
+    return ESP_ERR_NO_MEM;
+}
+
+/**
+ * @brief Remove a subscription
+ *
+ * @note A delivery to the subscriber that is already in progress is not cancelled
+ *
+ * @param[in] handle The handle returned by data_manager_subscribe()
+ * @return
+ *   - ESP_OK on success
+ *   - ESP_ERR_INVALID_ARG if the handle is not a valid subscription
+ */
+esp_err_t data_manager_unsubscribe(data_manager_subscription_handle_t handle) {
+    if (handle >= DATA_MANAGER_MAX_SUBSCRIBERS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+    if (!subscribers[handle].in_use) {
+        xSemaphoreGive(data_manager_data_mutex);
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_timer_stop(subscribers[handle].coalesce_timer);
+    subscribers[handle].in_use = false;
+    xSemaphoreGive(data_manager_data_mutex);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Hand the changed fields to the subscribers
+ *
+ * @note The data manager data mutex must be held by the caller
+ * @note The delivery event must be posted after releasing the mutex, the delivery itself needs it
+ *
+ * @return true if a subscriber has pending updates
+ */
+static bool publish_changed_fields(void) {
+    bool deliver = false;
+
+    for (uint8_t i = 0; i < DATA_MANAGER_MAX_SUBSCRIBERS; i++) {
+        if (subscribers[i].in_use && (subscribers[i].config.fields & changed_fields)) {
+            subscribers[i].pending_fields |= subscribers[i].config.fields & changed_fields;
+            deliver = true;
+        }
+    }
+    changed_fields = 0;
+
+    return deliver;
+}
+
+/**
+ * @brief Deliver the pending updates to the subscribers
+ *
+ * Runs in the app event loop task. Subscribers within their minimum interval either get their update
+ * at the end of the interval (coalesce), or the update is dropped.
+ *
+ * @param[in] handler_arg unused
+ * @param[in] base unused
+ * @param[in] id unused
+ * @param[in] event_data unused
+ */
+static void deliver_subscriptions(void* handler_arg, esp_event_base_t base, int32_t id, void* event_data) {
+    data_manager_field_mask_t deliver_fields[DATA_MANAGER_MAX_SUBSCRIBERS] = {0};
+    data_manager_subscriber_cb_t callbacks[DATA_MANAGER_MAX_SUBSCRIBERS];
+    void *args[DATA_MANAGER_MAX_SUBSCRIBERS];
+    data_manager_meter_data_t meter_data;
+    int64_t now = esp_timer_get_time();
+
+    xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
+    meter_data = data_manager_data.meter_data;
+
+    for (uint8_t i = 0; i < DATA_MANAGER_MAX_SUBSCRIBERS; i++) {
+        subscriber_t *subscriber = &subscribers[i];
+        if (!subscriber->in_use || subscriber->pending_fields == 0) {
+            continue;
+        }
+
+        int64_t next_delivery_us = subscriber->last_delivery_us + (int64_t)subscriber->config.min_interval_ms * 1000;
+        if (subscriber->last_delivery_us == 0 || now >= next_delivery_us) {
+            deliver_fields[i] = subscriber->pending_fields;
+            callbacks[i] = subscriber->config.callback;
+            args[i] = subscriber->config.arg;
+            subscriber->pending_fields = 0;
+            subscriber->last_delivery_us = now;
+        }
+        else if (subscriber->config.coalesce) {
+            if (!esp_timer_is_active(subscriber->coalesce_timer)) {
+                ESP_ERROR_CHECK(esp_timer_start_once(subscriber->coalesce_timer, next_delivery_us - now));
+            }
+        }
+        else {
+            subscriber->pending_fields = 0;
+        }
+    }
+
+    xSemaphoreGive(data_manager_data_mutex);
+
+    // Call the callbacks without holding the mutex, so they can use the data manager
+    for (uint8_t i = 0; i < DATA_MANAGER_MAX_SUBSCRIBERS; i++) {
+        if (deliver_fields[i]) {
+            callbacks[i](deliver_fields[i], &meter_data, args[i]);
+        }
+    }
+}
+
+/**
+ * @brief Deliver coalesced updates at the end of the minimum interval of a subscriber
+ *
+ * @param[in] arg unused
+ */
+static void coalesce_timer_cb(void *arg) {
+    if (esp_event_post_to(app_loop_handle, DATA_MANAGER_EVENTS, DATA_MANAGER_DELIVER_SUBSCRIPTIONS, NULL, 0, 0) != ESP_OK) {
+        // The updates stay pending, and are delivered with the next notification
+        ESP_LOGW(TAG, "Failed to post coalesced updates");
+    }
+}
+
+/**
+ * @brief Update the locally calculated average demand and predicted peak with the current meter data
+ *
+ * @note The data manager data mutex must be held by the caller
+ */
+static void update_local_demand(void) {
+    static bool predicted_peak_mismatch = false;
+    data_manager_meter_data_t *meter_data = &data_manager_data.meter_data;
+    double energy = (double)meter_data->electricity_delivered_tariff1 + (double)meter_data->electricity_delivered_tariff2;
+
+    if (!demand_calculator_update(&demand_calculator, meter_data->p1_timestamp, meter_data->current_power_usage, energy)) {
+        return;
+    }
+
+    data_manager_demand_data_point_t local_predicted_peak = {
+            .timestamp = demand_calculator.predicted_peak_time,
+            .demand = demand_calculator.predicted_peak,
+    };
+    update_field(DM_DF_LOCAL_AVG_DEMAND, &meter_data->local_avg_demand, &demand_calculator.avg_demand, sizeof(float));
+    update_field(DM_DF_LOCAL_PREDICTED_PEAK, &meter_data->local_predicted_peak, &local_predicted_peak, sizeof(data_manager_demand_data_point_t));
+
+    ESP_LOGD(TAG, "Average demand: local %.3f kW, server %.3f kW", meter_data->local_avg_demand, meter_data->current_avg_demand);
+    ESP_LOGD(TAG, "Predicted peak: local %.3f kW, server %.3f kW", meter_data->local_predicted_peak.demand, meter_data->predicted_peak.demand);
+
+    // Show when the local and server predictions start and stop to disagree, without logging every sample
+    bool mismatch = meter_data->predicted_peak.timestamp != 0 &&
+                    fabsf(meter_data->local_predicted_peak.demand - meter_data->predicted_peak.demand) > DATA_MANAGER_PREDICTED_PEAK_MISMATCH_KW;
+    if (mismatch != predicted_peak_mismatch) {
+        ESP_LOGI(TAG, "Predicted peak: local %.3f kW, server %.3f kW (%s)", meter_data->local_predicted_peak.demand,
+                 meter_data->predicted_peak.demand, mismatch ? "differ" : "agree again");
+        predicted_peak_mismatch = mismatch;
+    }
+}
+
+/**
+ * @brief Add a demand sample to the statistics of all windows
+ *
+ * @note The data manager data mutex must be held by the caller
+ *
+ * @param[in] timestamp The timestamp of the sample
+ * @param[in] demand The average demand in kW
+ */
+static void add_demand_stats_sample(time_t timestamp, float demand) {
+    if (timestamp == 0) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < DM_DSW_LENGTH; i++) {
+        rolling_stats_add(&demand_stats[i], timestamp, demand);
+    }
+}
+
+/**
+ * @brief Add the current energy register values to the energy buckets
+ *
+ * @note The data manager data mutex must be held by the caller
+ *
+ * @return true if a bucket was completed
+ */
+static bool update_energy_buckets(void) {
+    data_manager_meter_data_t *meter_data = &data_manager_data.meter_data;
+    double energy = (double)meter_data->electricity_delivered_tariff1 + (double)meter_data->electricity_delivered_tariff2;
+    bool bucket_completed;
+
+    if (energy_buckets_update(&energy_buckets, meter_data->p1_timestamp, energy, &bucket_completed)) {
+        changed_fields |= DM_DF_MASK(DM_DF_ENERGY_BUCKETS);
+    }
+
+    return bucket_completed;
+}
+
+/**
+ * @brief Store the energy buckets in NVS
+ *
+ * @param[in] eb The buckets to store
+ * @return ESP_OK on success, ESP_FAIL otherwise
+ */
+static esp_err_t store_energy_buckets(const energy_buckets_t *eb) {
+    nvs_handle_t nvs_handle;
+    esp_err_t err;
+
+    if (nvs_open(DATA_MANAGER_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS with " DATA_MANAGER_NVS_NAMESPACE);
+        return ESP_FAIL;
+    }
+
+    err = nvs_set_blob(nvs_handle, DATA_MANAGER_NVS_KEY_ENERGY_BUCKETS, eb, sizeof(energy_buckets_t));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write energy buckets to NVS: %d", err);
+        return ESP_FAIL;
+    }
+
+    ESP_LOGD(TAG, "Energy buckets stored");
+    return ESP_OK;
+}
+
+/**
+ * @brief Read the energy buckets from NVS
+ *
+ * @note Only used during the initialization, before the data is shared
+ *
+ * @return ESP_OK on success
+ */
+static esp_err_t read_energy_buckets_nvs(void) {
+    nvs_handle_t nvs_handle;
+    size_t size = sizeof(energy_buckets_t);
+    esp_err_t err;
+
+    if (nvs_open(DATA_MANAGER_NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        ESP_LOGI(TAG, "No data stored in NVS yet");
+        return ESP_FAIL;
+    }
+
+    err = nvs_get_blob(nvs_handle, DATA_MANAGER_NVS_KEY_ENERGY_BUCKETS, &energy_buckets, &size);
+    nvs_close(nvs_handle);
+
+    if (err == ESP_OK && size != sizeof(energy_buckets_t)) {
+        ESP_LOGW(TAG, "Stored energy buckets have a different size, ignoring them");
+        err = ESP_ERR_INVALID_SIZE;
+    }
+    else if (err != ESP_OK) {
+        ESP_LOGI(TAG, "Energy buckets NOT found in NVS: %d", err);
+    }
+
+    return err;
 }
 
 /**
@@ -156,6 +635,7 @@ uint16_t data_manager_get_short_term_max_demand_history(data_manager_demand_data
  *
  * @note To set multiple fields, use the data structure directly using data_manager_get_data() and data_manager_get_data_mutex_handle()
  * @note The array for the MAX_DEMAND_YEAR should be DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS in size, or the timestamp of the last item should be 0
+ * @note Changed fields are delivered to the subscribers with the next data_manager_notify_new_meter_data_available()
  *
  * @param[in] field The field to set
  * @param[in] value A pointer to the value to set
@@ -165,39 +645,46 @@ void data_manager_set_field(enum data_manager_data_fields_e field, void * value)
     xSemaphoreTake(data_manager_data_mutex, portMAX_DELAY);
     switch (field) {
         case DM_DF_P1_TIMESTAMP:
-            data_manager_data.meter_data.p1_timestamp = *(time_t *)value;
+            update_field(field, &data_manager_data.meter_data.p1_timestamp, value, sizeof(time_t));
             break;
         case DM_DF_ELECTRICITY_DELIVERED_TARIFF1:
-            data_manager_data.meter_data.electricity_delivered_tariff1 = *(float *)value;
+            update_field(field, &data_manager_data.meter_data.electricity_delivered_tariff1, value, sizeof(float));
             break;
         case DM_DF_ELECTRICITY_DELIVERED_TARIFF2:
-            data_manager_data.meter_data.electricity_delivered_tariff2 = *(float *)value;
+            update_field(field, &data_manager_data.meter_data.electricity_delivered_tariff2, value, sizeof(float));
             break;
         case DM_DF_ELECTRICITY_RETURNED_TARIFF1:
-            data_manager_data.meter_data.electricity_returned_tariff1 = *(float *)value;
+            update_field(field, &data_manager_data.meter_data.electricity_returned_tariff1, value, sizeof(float));
             break;
         case DM_DF_ELECTRICITY_RETURNED_TARIFF2:
-            data_manager_data.meter_data.electricity_returned_tariff2 = *(float *)value;
+            update_field(field, &data_manager_data.meter_data.electricity_returned_tariff2, value, sizeof(float));
             break;
         case DM_DF_CURRENT_AVG_DEMAND:
-            data_manager_data.meter_data.current_avg_demand = *(float *)value;
+            update_field(field, &data_manager_data.meter_data.current_avg_demand, value, sizeof(float));
             break;
         case DM_DF_CURRENT_POWER_USAGE:
-            data_manager_data.meter_data.current_power_usage = *(float *)value;
+            update_field(field, &data_manager_data.meter_data.current_power_usage, value, sizeof(float));
             break;
         case DM_DF_CURRENT_POWER_RETURN:
-            data_manager_data.meter_data.current_power_return = *(float *)value;
+            update_field(field, &data_manager_data.meter_data.current_power_return, value, sizeof(float));
             break;
         case DM_DF_ELECTRICITY_ACTIVE_TARIFF:
-            data_manager_data.meter_data.electricity_active_tariff = *(uint8_t *)value;
+            update_field(field, &data_manager_data.meter_data.electricity_active_tariff, value, sizeof(uint8_t));
             break;
         case DM_DF_MAX_DEMAND_MONTH:
-            data_manager_data.meter_data.max_demand_active_month = *(data_manager_demand_data_point_t *)value;
+            update_field(field, &data_manager_data.meter_data.max_demand_active_month, value, sizeof(data_manager_demand_data_point_t));
             break;
         case DM_DF_PREDICTED_PEAK:
-            data_manager_data.meter_data.predicted_peak = *(data_manager_demand_data_point_t *)value;
+            update_field(field, &data_manager_data.meter_data.predicted_peak, value, sizeof(data_manager_demand_data_point_t));
+            break;
+        case DM_DF_LOCAL_AVG_DEMAND:
+            update_field(field, &data_manager_data.meter_data.local_avg_demand, value, sizeof(float));
+            break;
+        case DM_DF_LOCAL_PREDICTED_PEAK:
+            update_field(field, &data_manager_data.meter_data.local_predicted_peak, value, sizeof(data_manager_demand_data_point_t));
             break;
         case DM_DF_MAX_DEMAND_YEAR:
+            data_manager_data.history_data.max_demand_year_items = DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS;
             for (uint8_t i = 0; i < DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS; i++) {
                 if (((data_manager_demand_data_point_t *)value)[i].timestamp == 0) {
                     data_manager_data.history_data.max_demand_year_items = i;
@@ -206,10 +693,14 @@ void data_manager_set_field(enum data_manager_data_fields_e field, void * value)
                 data_manager_data.history_data.max_demand_year[i] = ((data_manager_demand_data_point_t *)value)[i];
 
             }
+            changed_fields |= DM_DF_MASK(field);
             break;
         case DM_DF_MAX_DEMAND_SHORT_TERM:
             // TODO: Implement setting of short term max demand
             break;
+        case DM_DF_ENERGY_BUCKETS:
+            ESP_LOGE(TAG, "Energy buckets are calculated from the energy registers, and can not be set");
+            break;
         case DM_DF_LENGTH:
             ESP_LOGE(TAG, "Invalid data manager data field");
             break;
@@ -223,6 +714,7 @@ void data_manager_set_field(enum data_manager_data_fields_e field, void * value)
  *
  * @note To get multiple fields, use the data structure directly using data_manager_get_data() and data_manager_get_data_mutex_handle()
  * @note The array for the MAX_DEMAND_YEAR should be at least DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS in size
+ * @note The array for the ENERGY_BUCKETS should be at least ENERGY_BUCKETS_COUNT in size
  *
  * @param[in] field The field to get
  * @param[out] value Where to store the value
@@ -268,9 +760,18 @@ void data_manager_get_field(enum data_manager_data_fields_e field, void * value)
         case DM_DF_PREDICTED_PEAK:
             *(data_manager_demand_data_point_t *) value = data_manager_data.meter_data.predicted_peak;
             break;
+        case DM_DF_LOCAL_AVG_DEMAND:
+            *(float *) value = data_manager_data.meter_data.local_avg_demand;
+            break;
+        case DM_DF_LOCAL_PREDICTED_PEAK:
+            *(data_manager_demand_data_point_t *) value = data_manager_data.meter_data.local_predicted_peak;
+            break;
         case DM_DF_MAX_DEMAND_SHORT_TERM:
             // TODO: Implement getting of short term max demand
             break;
+        case DM_DF_ENERGY_BUCKETS:
+            energy_buckets_get(&energy_buckets, (energy_buckets_bucket_t *) value);
+            break;
         case DM_DF_LENGTH:
             ESP_LOGE(TAG, "Invalid data manager data field");
             break;
@@ -278,3 +779,20 @@ void data_manager_get_field(enum data_manager_data_fields_e field, void * value)
 
     xSemaphoreGive(data_manager_data_mutex);
 }
+
+/**
+ * @brief Update a field, and mark it as changed if the value is different
+ *
+ * @note The data manager data mutex must be held by the caller
+ *
+ * @param[in] field The field being updated
+ * @param[out] dst The field in the data manager data
+ * @param[in] src The new value
+ * @param[in] size The size of the field
+ */
+static void update_field(enum data_manager_data_fields_e field, void *dst, const void *src, size_t size) {
+    if (memcmp(dst, src, size) != 0) {
+        memcpy(dst, src, size);
+        changed_fields |= DM_DF_MASK(field);
+    }
+}
@@ -0,0 +1,157 @@
+/**
+ * @file demand_calculator.c
+ * @brief Incremental quarter-hour demand calculator
+ *
+ * Calculates the running average demand of the current quarter-hour and predicts the average demand at the end of it,
+ * using the instantaneous power and the cumulative energy registers of the meter.
+ *
+ * The energy of the current period is integrated from the power samples (trapezoidal rule), which gives a smooth value
+ * between two ticks of the energy registers. The integrated energy is kept within the resolution of the registers,
+ * so it can not drift away from what the meter actually measures.
+ *
+ * The calculator does not depend on the rest of the application, it only keeps the state passed to it.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+#include "demand_calculator.h"
+
+// Function prototypes
+static void start_period(demand_calculator_t *calc, time_t timestamp, double power, double energy);
+static void limit_to_registers(demand_calculator_t *calc, double energy);
+
+
+/**
+ * @brief Reset the calculator
+ *
+ * All state is cleared, the next sample will start a new period.
+ *
+ * @param[out] calc The calculator to reset
+ */
+void demand_calculator_reset(demand_calculator_t *calc) {
+    memset(calc, 0, sizeof(demand_calculator_t));
+}
+
+/**
+ * @brief Process a new sample
+ *
+ * Updates the average demand and the predicted peak of the current period.
+ * Samples with a timestamp equal to the last sample are ignored, a timestamp before the last sample resets the calculator.
+ *
+ * @param[in, out] calc The calculator
+ * @param[in] timestamp The timestamp of the sample
+ * @param[in] power The instantaneous power at the timestamp in kW
+ * @param[in] energy The total delivered energy (sum of all tariffs) at the timestamp in kWh
+ * @return true if the results were updated, false if the sample was ignored
+ */
+bool demand_calculator_update(demand_calculator_t *calc, time_t timestamp, float power, double energy) {
+    time_t period_start = timestamp - (timestamp % DEMAND_CALCULATOR_PERIOD_S);
+
+    if (timestamp <= 0 || power < 0) {
+        return false;
+    }
+
+    if (calc->initialized && timestamp == calc->last_timestamp) {
+        return false;
+    }
+
+    if (calc->initialized && timestamp < calc->last_timestamp) {
+        // The clock went backwards, nothing we have is usable
+        demand_calculator_reset(calc);
+    }
+
+    if (!calc->initialized || timestamp - calc->last_timestamp > DEMAND_CALCULATOR_MAX_SAMPLE_GAP_S) {
+        if (calc->initialized && period_start == calc->period_start) {
+            // Resume after a gap within the same period, the registers tell us what happened in between
+            calc->period_energy = energy - calc->period_start_energy;
+            if (calc->period_energy < 0) {
+                start_period(calc, timestamp, power, energy);
+            }
+        }
+        else {
+            start_period(calc, timestamp, power, energy);
+        }
+    }
+    else if (period_start != calc->period_start) {
+        // A new period started between the last and this sample, only count the part after the start of the period
+        double avg_power = (calc->last_power + power) / 2;
+        calc->period_start = period_start;
+        calc->period_energy = avg_power * (double)(timestamp - period_start) / 3600;
+        calc->period_start_energy = energy - calc->period_energy;
+    }
+    else {
+        calc->period_energy += (calc->last_power + power) / 2 * (double)(timestamp - calc->last_timestamp) / 3600;
+    }
+
+    limit_to_registers(calc, energy);
+
+    calc->initialized = true;
+    calc->last_timestamp = timestamp;
+    calc->last_power = power;
+
+    // Calculate the results
+    time_t elapsed = timestamp - calc->period_start;
+    time_t remaining = DEMAND_CALCULATOR_PERIOD_S - elapsed;
+    if (elapsed > 0) {
+        calc->avg_demand = (float)(calc->period_energy * 3600 / (double)elapsed);
+    }
+    else {
+        calc->avg_demand = power;
+    }
+    calc->predicted_peak = (float)((calc->period_energy + (double)power * (double)remaining / 3600) * 3600 / DEMAND_CALCULATOR_PERIOD_S);
+    calc->predicted_peak_time = calc->period_start + DEMAND_CALCULATOR_PERIOD_S;
+
+    return true;
+}
+
+/**
+ * @brief Start a new period without knowing what happened before the given sample
+ *
+ * The power is assumed to have been constant since the start of the period.
+ *
+ * @param[in, out] calc The calculator
+ * @param[in] timestamp The timestamp of the sample
+ * @param[in] power The instantaneous power in kW
+ * @param[in] energy The energy register value in kWh
+ */
+static void start_period(demand_calculator_t *calc, time_t timestamp, double power, double energy) {
+    calc->period_start = timestamp - (timestamp % DEMAND_CALCULATOR_PERIOD_S);
+    calc->period_energy = power * (double)(timestamp - calc->period_start) / 3600;
+    calc->period_start_energy = energy - calc->period_energy;
+}
+
+/**
+ * @brief Keep the integrated energy within the resolution of the energy registers
+ *
+ * Both the register value at the start of the period and the current value are truncated by the meter,
+ * so the real energy of the period is within one resolution step of the register difference.
+ * A register value below the start of the period means the counter was reset, in that case the start is moved.
+ *
+ * @param[in, out] calc The calculator
+ * @param[in] energy The energy register value in kWh
+ */
+static void limit_to_registers(demand_calculator_t *calc, double energy) {
+    // Take the precision of the (float) register values into account as well
+    double tolerance = DEMAND_CALCULATOR_REGISTER_RESOLUTION_KWH + fabs(energy) * FLT_EPSILON;
+    double register_energy = energy - calc->period_start_energy;
+
+    if (register_energy < -tolerance) {
+        calc->period_start_energy = energy - calc->period_energy;
+        return;
+    }
+
+    if (calc->period_energy > register_energy + tolerance) {
+        calc->period_energy = register_energy + tolerance;
+    }
+    else if (calc->period_energy < register_energy - tolerance) {
+        calc->period_energy = register_energy - tolerance;
+    }
+
+    if (calc->period_energy < 0) {
+        calc->period_energy = 0;
+    }
+}
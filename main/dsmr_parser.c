@@ -0,0 +1,392 @@
+/**
+ * @file dsmr_parser.c
+ * @brief Streaming parser for DSMR P1 telegrams
+ *
+ * Parses the telegrams sent by a smart meter on the P1 port, byte by byte as they are received.
+ * Every line (OBIS code with its values) is parsed as soon as it is complete, the telegram is ready when the CRC
+ * after the '!' is received and checked.
+ *
+ * A telegram looks like this (DSMR 5 / e-MUCS, shortened):
+ *     /FLU5\253769484_A
+ *
+ *     0-0:1.0.0(230309154521W)
+ *     1-0:1.8.1(000123.456*kWh)
+ *     1-0:1.7.0(00.512*kW)
+ *     1-0:1.4.0(01.234*kW)
+ *     1-0:1.6.0(230301081500W)(03.123*kW)
+ *     !XXXX  (the CRC, 4 hexadecimal characters)
+ *
+ * The CRC is a CRC16 (ARC: polynomial 0xA001 reflected, initial value 0) over all characters from the '/' up to and including the '!'.
+ *
+ * This file does not depend on ESP-IDF, so it can also be built and tested on a PC.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "dsmr_parser.h"
+
+#define MAX_VALUE_GROUPS (3 + 3 * DSMR_PARSER_MAX_DEMAND_YEAR_ITEMS)    // Groups between parentheses on one line
+#define UTC_OFFSET_WINTER_S (1 * 3600)     // DSMR timestamps are local time (CET), 'W' suffix
+#define UTC_OFFSET_SUMMER_S (2 * 3600)     // 'S' suffix (CEST)
+
+// CRC16 lookup table for 4 bits at a time, small enough to stay in the cache
+static const uint16_t crc16_table[16] = {
+        0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+        0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400,
+};
+
+// Function prototypes
+static void start_telegram(dsmr_parser_t *parser);
+static void parse_line(dsmr_parser_t *parser);
+static uint8_t split_value_groups(char *values, char *groups[], uint8_t max_groups);
+static bool parse_number(const char *str, double *value);
+static bool parse_timestamp(const char *str, time_t *timestamp);
+static int64_t days_from_civil(int32_t year, uint32_t month, uint32_t day);
+static int8_t hex_value(uint8_t c);
+
+
+/**
+ * @brief Initialize the parser
+ *
+ * @param[out] parser The parser
+ */
+void dsmr_parser_init(dsmr_parser_t *parser) {
+    memset(parser, 0, sizeof(dsmr_parser_t));
+    parser->state = DSMR_PARSER_STATE_WAIT_START;
+}
+
+/**
+ * @brief Feed received bytes to the parser
+ *
+ * Stops after a complete telegram, so the caller can use it before the next telegram is started.
+ * The remaining bytes should be fed again.
+ *
+ * @param[in, out] parser The parser
+ * @param[in] data The received bytes
+ * @param[in] len The number of bytes
+ * @param[out] result DSMR_PARSER_RESULT_TELEGRAM if parser->telegram contains a new telegram
+ * @return The number of bytes used
+ */
+size_t dsmr_parser_feed(dsmr_parser_t *parser, const uint8_t *data, size_t len, dsmr_parser_result_t *result) {
+    *result = DSMR_PARSER_RESULT_NONE;
+
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = data[i];
+
+        switch (parser->state) {
+            case DSMR_PARSER_STATE_WAIT_START:
+                if (c == '/') {
+                    start_telegram(parser);
+                }
+                break;
+
+            case DSMR_PARSER_STATE_DATA:
+                if (c == '/') {
+                    // A new header, the previous telegram was incomplete
+                    start_telegram(parser);
+                    break;
+                }
+
+                parser->crc = dsmr_parser_crc16(parser->crc, &c, 1);
+
+                if (c == '!') {
+                    parser->state = DSMR_PARSER_STATE_CRC;
+                    parser->received_crc = 0;
+                    parser->received_crc_digits = 0;
+                }
+                else if (c == '\n') {
+                    if (!parser->line_overflow) {
+                        // Remove the '\r'
+                        if (parser->line_length > 0 && parser->line[parser->line_length - 1] == '\r') {
+                            parser->line_length--;
+                        }
+                        parser->line[parser->line_length] = '\0';
+                        parse_line(parser);
+                    }
+                    parser->line_length = 0;
+                    parser->line_overflow = false;
+                }
+                else if (parser->line_length < DSMR_PARSER_MAX_LINE_LENGTH) {
+                    parser->line[parser->line_length++] = (char)c;
+                }
+                else {
+                    parser->line_overflow = true;
+                }
+                break;
+
+            case DSMR_PARSER_STATE_CRC:
+                if (hex_value(c) >= 0 && parser->received_crc_digits < 4) {
+                    parser->received_crc = (uint16_t)((parser->received_crc << 4) | hex_value(c));
+                    parser->received_crc_digits++;
+                }
+                else if (c == '\n') {
+                    parser->state = DSMR_PARSER_STATE_WAIT_START;
+
+                    // Older DSMR versions do not send a CRC
+                    parser->telegram.crc_checked = parser->received_crc_digits == 4;
+                    if ((parser->received_crc_digits == 0) || (parser->telegram.crc_checked && parser->received_crc == parser->crc)) {
+                        parser->telegram_count++;
+                        *result = DSMR_PARSER_RESULT_TELEGRAM;
+                    }
+                    else {
+                        parser->crc_error_count++;
+                        *result = DSMR_PARSER_RESULT_CRC_ERROR;
+                    }
+                    return i + 1;
+                }
+                else if (c != '\r') {
+                    // Anything else is a corrupted trailer
+                    parser->received_crc_digits = 0xFF;
+                }
+                break;
+        }
+    }
+
+    return len;
+}
+
+/**
+ * @brief Update a CRC16 (ARC) with data
+ *
+ * @param[in] crc The CRC so far, 0 to start
+ * @param[in] data The data
+ * @param[in] len The length of the data
+ * @return The updated CRC
+ */
+uint16_t dsmr_parser_crc16(uint16_t crc, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc = (crc >> 4) ^ crc16_table[(crc ^ data[i]) & 0x0F];
+        crc = (crc >> 4) ^ crc16_table[(crc ^ (data[i] >> 4)) & 0x0F];
+    }
+    return crc;
+}
+
+/**
+ * @brief Start a new telegram after receiving the '/'
+ *
+ * @param[in, out] parser The parser
+ */
+static void start_telegram(dsmr_parser_t *parser) {
+    const uint8_t start = '/';
+
+    memset(&parser->telegram, 0, sizeof(dsmr_telegram_t));
+    parser->state = DSMR_PARSER_STATE_DATA;
+    parser->crc = dsmr_parser_crc16(0, &start, 1);
+    parser->line[0] = '/';
+    parser->line_length = 1;
+    parser->line_overflow = false;
+}
+
+/**
+ * @brief Parse a complete line of the telegram
+ *
+ * Unknown OBIS codes and lines that can not be parsed are ignored.
+ *
+ * @param[in, out] parser The parser, with the line in parser->line
+ */
+static void parse_line(dsmr_parser_t *parser) {
+    dsmr_telegram_t *telegram = &parser->telegram;
+    char *groups[MAX_VALUE_GROUPS];
+    uint8_t group_count;
+    double value;
+
+    char *values = strchr(parser->line, '(');
+    if (values == NULL) {
+        // Header or empty line
+        return;
+    }
+
+    size_t obis_length = values - parser->line;
+    const char *obis = parser->line;
+    group_count = split_value_groups(values, groups, MAX_VALUE_GROUPS);
+    if (group_count == 0) {
+        return;
+    }
+
+    #define OBIS_IS(code) (obis_length == sizeof(code) - 1 && strncmp(obis, code, obis_length) == 0)
+
+    if (OBIS_IS("0-0:1.0.0")) {
+        if (parse_timestamp(groups[0], &telegram->timestamp)) {
+            telegram->present_fields |= DSMR_FIELD_TIMESTAMP;
+        }
+    }
+    else if (OBIS_IS("1-0:1.8.1")) {
+        if (parse_number(groups[0], &telegram->delivered_tariff1)) {
+            telegram->present_fields |= DSMR_FIELD_DELIVERED_TARIFF1;
+        }
+    }
+    else if (OBIS_IS("1-0:1.8.2")) {
+        if (parse_number(groups[0], &telegram->delivered_tariff2)) {
+            telegram->present_fields |= DSMR_FIELD_DELIVERED_TARIFF2;
+        }
+    }
+    else if (OBIS_IS("1-0:2.8.1")) {
+        if (parse_number(groups[0], &telegram->returned_tariff1)) {
+            telegram->present_fields |= DSMR_FIELD_RETURNED_TARIFF1;
+        }
+    }
+    else if (OBIS_IS("1-0:2.8.2")) {
+        if (parse_number(groups[0], &telegram->returned_tariff2)) {
+            telegram->present_fields |= DSMR_FIELD_RETURNED_TARIFF2;
+        }
+    }
+    else if (OBIS_IS("0-0:96.14.0")) {
+        if (parse_number(groups[0], &value)) {
+            telegram->active_tariff = (uint8_t)value;
+            telegram->present_fields |= DSMR_FIELD_ACTIVE_TARIFF;
+        }
+    }
+    else if (OBIS_IS("1-0:1.7.0")) {
+        if (parse_number(groups[0], &value)) {
+            telegram->power_delivered = (float)value;
+            telegram->present_fields |= DSMR_FIELD_POWER_DELIVERED;
+        }
+    }
+    else if (OBIS_IS("1-0:2.7.0")) {
+        if (parse_number(groups[0], &value)) {
+            telegram->power_returned = (float)value;
+            telegram->present_fields |= DSMR_FIELD_POWER_RETURNED;
+        }
+    }
+    else if (OBIS_IS("1-0:1.4.0")) {
+        if (parse_number(groups[0], &value)) {
+            telegram->current_avg_demand = (float)value;
+            telegram->present_fields |= DSMR_FIELD_CURRENT_AVG_DEMAND;
+        }
+    }
+    else if (OBIS_IS("1-0:1.6.0")) {
+        // (timestamp of the peak)(peak)
+        if (group_count >= 2 && parse_timestamp(groups[0], &telegram->max_demand_month.timestamp) && parse_number(groups[1], &value)) {
+            telegram->max_demand_month.demand = (float)value;
+            telegram->present_fields |= DSMR_FIELD_MAX_DEMAND_MONTH;
+        }
+    }
+    else if (OBIS_IS("0-0:98.1.0")) {
+        // (number of items)(1-0:1.6.0)(1-0:1.6.0) followed by (start of month)(timestamp of the peak)(peak) for each item
+        if (parse_number(groups[0], &value)) {
+            uint8_t items = 0;
+            for (uint8_t i = 3; i + 2 < group_count && items < (uint8_t)value && items < DSMR_PARSER_MAX_DEMAND_YEAR_ITEMS; i += 3) {
+                double demand;
+                if (parse_timestamp(groups[i + 1], &telegram->max_demand_year[items].timestamp) && parse_number(groups[i + 2], &demand)) {
+                    telegram->max_demand_year[items].demand = (float)demand;
+                    items++;
+                }
+            }
+            telegram->max_demand_year_items = items;
+            telegram->present_fields |= DSMR_FIELD_MAX_DEMAND_YEAR;
+        }
+    }
+
+    #undef OBIS_IS
+}
+
+/**
+ * @brief Split the values of a line in the groups between parentheses
+ *
+ * The closing parentheses are replaced by '\0', so the groups are separate strings.
+ *
+ * @param[in, out] values The values, starting at the first '('
+ * @param[out] groups Pointers to the start of each group
+ * @param[in] max_groups The max number of groups
+ * @return The number of groups
+ */
+static uint8_t split_value_groups(char *values, char *groups[], uint8_t max_groups) {
+    uint8_t count = 0;
+
+    while (*values == '(' && count < max_groups) {
+        char *end = strchr(values, ')');
+        if (end == NULL) {
+            break;
+        }
+        *end = '\0';
+        groups[count++] = values + 1;
+        values = end + 1;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Parse a number with an optional unit (e.g. "000123.456*kWh")
+ *
+ * @param[in] str The string to parse
+ * @param[out] value The parsed number
+ * @return true if a number was found
+ */
+static bool parse_number(const char *str, double *value) {
+    char *end;
+    *value = strtod(str, &end);
+    return end != str && (*end == '\0' || *end == '*');
+}
+
+/**
+ * @brief Parse a DSMR timestamp (YYMMDDhhmmssX) to a unix timestamp
+ *
+ * X is 'S' for summer time, 'W' for winter time. The timestamps are local time of the Netherlands and Belgium.
+ * The conversion does not depend on the time zone of the system.
+ *
+ * @param[in] str The string to parse
+ * @param[out] timestamp The unix timestamp
+ * @return true on success
+ */
+static bool parse_timestamp(const char *str, time_t *timestamp) {
+    uint8_t fields[6];
+
+    for (uint8_t i = 0; i < 6; i++) {
+        if (str[2 * i] < '0' || str[2 * i] > '9' || str[2 * i + 1] < '0' || str[2 * i + 1] > '9') {
+            return false;
+        }
+        fields[i] = (uint8_t)((str[2 * i] - '0') * 10 + (str[2 * i + 1] - '0'));
+    }
+
+    if (fields[1] < 1 || fields[1] > 12 || fields[2] < 1 || fields[2] > 31) {
+        return false;
+    }
+
+    int64_t days = days_from_civil(2000 + fields[0], fields[1], fields[2]);
+    int64_t seconds = days * 86400 + fields[3] * 3600 + fields[4] * 60 + fields[5];
+    seconds -= (str[12] == 'S') ? UTC_OFFSET_SUMMER_S : UTC_OFFSET_WINTER_S;
+
+    *timestamp = (time_t)seconds;
+    return true;
+}
+
+/**
+ * @brief Get the number of days since 1970-01-01 of a date
+ *
+ * @param[in] year The year
+ * @param[in] month The month (1-12)
+ * @param[in] day The day of the month (1-31)
+ * @return The number of days since 1970-01-01
+ */
+static int64_t days_from_civil(int32_t year, uint32_t month, uint32_t day) {
+    year -= month <= 2;
+    const int32_t era = (year >= 0 ? year : year - 399) / 400;
+    const uint32_t year_of_era = (uint32_t)(year - era * 400);
+    const uint32_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const uint32_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return (int64_t)era * 146097 + (int64_t)day_of_era - 719468;
+}
+
+/**
+ * @brief Get the value of a hexadecimal digit
+ *
+ * @param[in] c The character
+ * @return The value, or -1 if the character is not a hexadecimal digit
+ */
+static int8_t hex_value(uint8_t c) {
+    if (c >= '0' && c <= '9') {
+        return (int8_t)(c - '0');
+    }
+    if (c >= 'A' && c <= 'F') {
+        return (int8_t)(c - 'A' + 10);
+    }
+    if (c >= 'a' && c <= 'f') {
+        return (int8_t)(c - 'a' + 10);
+    }
+    return -1;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file energy_buckets.c
+ * @brief Energy per interval
+ *
+ * Turns the cumulative energy registers of the meter into the energy used per interval (bucket).
+ * The buckets are aligned to multiples of ENERGY_BUCKETS_INTERVAL_S, and are kept in a ring buffer of the last 24 hours.
+ *
+ * The energy between two samples is spread over the buckets in between, proportional to the time spent in each bucket.
+ * When the register goes down (meter replaced or counter reset) or after a long gap, the energy of that interval is dropped.
+ *
+ * @note The functions are not thread safe, the caller has to protect the buckets.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "energy_buckets.h"
+
+// Function prototypes
+static bool add_energy(energy_buckets_t *eb, uint32_t bucket_start, double energy);
+static uint32_t get_bucket_start(uint32_t timestamp);
+
+
+/**
+ * @brief Remove all buckets
+ *
+ * @param[out] eb The buckets
+ */
+void energy_buckets_reset(energy_buckets_t *eb) {
+    memset(eb, 0, sizeof(energy_buckets_t));
+}
+
+/**
+ * @brief Process a new sample of the energy registers
+ *
+ * @param[in, out] eb The buckets
+ * @param[in] timestamp The timestamp of the sample
+ * @param[in] energy The total delivered energy (sum of all tariffs) in kWh
+ * @param[out] bucket_completed Set to true if the sample is in a later bucket than the previous sample, can be NULL
+ * @return true if a bucket changed
+ */
+bool energy_buckets_update(energy_buckets_t *eb, time_t timestamp, double energy, bool *bucket_completed) {
+    bool changed = false;
+    uint32_t t = (uint32_t)timestamp;
+
+    if (bucket_completed != NULL) {
+        *bucket_completed = false;
+    }
+
+    if (timestamp <= 0 || t == eb->last_timestamp) {
+        return false;
+    }
+
+    if (eb->last_timestamp != 0 && t > eb->last_timestamp) {
+        double delta = energy - eb->last_energy;
+        uint32_t gap = t - eb->last_timestamp;
+
+        if (bucket_completed != NULL) {
+            *bucket_completed = get_bucket_start(t) != get_bucket_start(eb->last_timestamp);
+        }
+
+        // Spread the energy over the buckets between the samples
+        if (delta > 0 && gap <= ENERGY_BUCKETS_MAX_GAP_S) {
+            uint32_t segment_start = eb->last_timestamp;
+            while (segment_start < t) {
+                uint32_t bucket_start = get_bucket_start(segment_start);
+                uint32_t segment_end = bucket_start + ENERGY_BUCKETS_INTERVAL_S;
+                if (segment_end > t) {
+                    segment_end = t;
+                }
+                changed |= add_energy(eb, bucket_start, delta * (segment_end - segment_start) / gap);
+                segment_start = segment_end;
+            }
+        }
+    }
+
+    // Make sure the bucket of this sample exists, also when no energy was used
+    changed |= add_energy(eb, get_bucket_start(t), 0);
+
+    // A lower register value (counter reset), a gap or a clock going backwards restarts from this sample
+    eb->last_timestamp = t;
+    eb->last_energy = energy;
+
+    return changed;
+}
+
+/**
+ * @brief Get the buckets in chronological order
+ *
+ * The last bucket is the bucket of the last sample, which is still in progress.
+ * Buckets without data have an energy of 0.
+ *
+ * @param[in] eb The buckets
+ * @param[out] buckets The buckets, oldest first
+ * @return The number of buckets returned, ENERGY_BUCKETS_COUNT or 0 if there are no samples yet
+ */
+uint8_t energy_buckets_get(const energy_buckets_t *eb, energy_buckets_bucket_t buckets[ENERGY_BUCKETS_COUNT]) {
+    if (eb->last_timestamp == 0) {
+        return 0;
+    }
+
+    uint32_t last_bucket_start = get_bucket_start(eb->last_timestamp);
+    for (uint8_t i = 0; i < ENERGY_BUCKETS_COUNT; i++) {
+        uint32_t start = last_bucket_start - (ENERGY_BUCKETS_COUNT - 1 - i) * ENERGY_BUCKETS_INTERVAL_S;
+        const energy_buckets_bucket_t *bucket = &eb->buckets[(start / ENERGY_BUCKETS_INTERVAL_S) % ENERGY_BUCKETS_COUNT];
+
+        buckets[i].start = start;
+        buckets[i].energy = bucket->start == start ? bucket->energy : 0;
+    }
+
+    return ENERGY_BUCKETS_COUNT;
+}
+
+/**
+ * @brief Add energy to a bucket
+ *
+ * A slot that still holds an older bucket is cleared first.
+ *
+ * @param[in, out] eb The buckets
+ * @param[in] bucket_start The start of the bucket
+ * @param[in] energy The energy to add in kWh
+ * @return true if the bucket changed
+ */
+static bool add_energy(energy_buckets_t *eb, uint32_t bucket_start, double energy) {
+    bool changed = false;
+    energy_buckets_bucket_t *bucket = &eb->buckets[(bucket_start / ENERGY_BUCKETS_INTERVAL_S) % ENERGY_BUCKETS_COUNT];
+
+    if (bucket->start != bucket_start) {
+        bucket->start = bucket_start;
+        bucket->energy = 0;
+        changed = true;
+    }
+
+    if (energy > 0) {
+        bucket->energy += (float)energy;
+        changed = true;
+    }
+
+    return changed;
+}
+
+/**
+ * @brief Get the start of the bucket a timestamp is in
+ *
+ * @param[in] timestamp The timestamp
+ * @return The start of the bucket
+ */
+static uint32_t get_bucket_start(uint32_t timestamp) {
+    return timestamp - (timestamp % ENERGY_BUCKETS_INTERVAL_S);
+}
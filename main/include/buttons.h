@@ -0,0 +1,47 @@
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#define BUTTONS_DEBOUNCE_MS 20          // A button is stable when its pin did not change for this long
+#define BUTTONS_LONG_PRESS_MS 500       // Time a button is held before BUTTONS_EVENT_LONG_PRESS
+#define BUTTONS_REPEAT_MS 150           // Period of BUTTONS_EVENT_REPEAT after the long press, while the button is held
+#define BUTTONS_QUEUE_LENGTH 16
+
+typedef enum {
+    BUTTONS_ID_LEFT,
+    BUTTONS_ID_RIGHT,
+    BUTTONS_ID_ENTER,
+    BUTTONS_ID_COUNT,
+} buttons_id_t;
+
+typedef enum {
+    BUTTONS_EVENT_PRESS,
+    BUTTONS_EVENT_RELEASE,
+    BUTTONS_EVENT_LONG_PRESS,   // Held for BUTTONS_LONG_PRESS_MS
+    BUTTONS_EVENT_REPEAT,       // Every BUTTONS_REPEAT_MS after the long press
+} buttons_event_type_t;
+
+typedef struct {
+    buttons_id_t button;
+    buttons_event_type_t type;
+    int64_t time_us;            // esp_timer time of the first edge of a press or release, or of the long press or repeat
+} buttons_event_t;
+
+typedef void (*buttons_event_cb_t)(void *arg);  // Called from the esp_timer task when events are queued
+
+typedef struct {
+    int pins[BUTTONS_ID_COUNT];         // GPIO of each button, active low
+    buttons_event_cb_t event_cb;        // Optional
+    void *event_cb_arg;
+} buttons_config_t;
+
+// Function prototypes
+esp_err_t buttons_init(const buttons_config_t *config);
+bool buttons_get_event(buttons_event_t *event);
+bool buttons_is_pressed(buttons_id_t button);
+bool buttons_any_pressed(void);
+
+#endif //BUTTONS_H
@@ -17,10 +17,11 @@ enum buzzer_beep_type_e {
     BUZZER_BEEP_TYPE_SHORT,
     BUZZER_BEEP_TYPE_LONG,
     BUZZER_BEEP_TYPE_DOUBLE,
+    BUZZER_BEEP_TYPE_COUNT,
 };
 
 // Function prototypes
-void buzzer_task(void *pvParameters);
+void buzzer_init(void);
 void buzzer_beep(enum buzzer_beep_type_e beep_type);
 
 #endif //BUZZER_H
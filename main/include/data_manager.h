@@ -2,20 +2,32 @@
 #define DATA_MANAGER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "esp_event.h"
+#include "rolling_stats.h"
+#include "energy_buckets.h"
 
 #define DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS 13
 
 #define DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS (60 * 15)  // 1 second * 15 minutes
 
+#define DATA_MANAGER_MAX_SUBSCRIBERS 8
+
+#define DATA_MANAGER_PREDICTED_PEAK_MISMATCH_KW 0.1f    // The local and server predicted peaks are logged at info level when they differ more
+
+#define DATA_MANAGER_NVS_NAMESPACE "data_manager"
+#define DATA_MANAGER_NVS_KEY_ENERGY_BUCKETS "energy_buckets"
+
+#define DM_DF_MASK(field) ((data_manager_field_mask_t)1 << (field))   // Bit of a data field in a field mask
+#define DM_DF_MASK_ALL (DM_DF_MASK(DM_DF_LENGTH) - 1)                   // All data fields
+
 ESP_EVENT_DECLARE_BASE(DATA_MANAGER_EVENTS);
 
 typedef enum {
-    DATA_MANAGER_NEW_METER_DATA_AVAILABLE,
-    DATA_MANAGER_NEW_METER_HISTORY_DATA_AVAILABLE,
+    DATA_MANAGER_DELIVER_SUBSCRIPTIONS,     // Internal, used to deliver updates to the subscribers from the app event loop
 } data_manager_event_id_t;
 
 
@@ -31,11 +43,21 @@ enum data_manager_data_fields_e {
     DM_DF_ELECTRICITY_ACTIVE_TARIFF,
     DM_DF_MAX_DEMAND_MONTH,
     DM_DF_PREDICTED_PEAK,
+    DM_DF_LOCAL_AVG_DEMAND,
+    DM_DF_LOCAL_PREDICTED_PEAK,
     DM_DF_MAX_DEMAND_YEAR,
     DM_DF_MAX_DEMAND_SHORT_TERM,
+    DM_DF_ENERGY_BUCKETS,
     DM_DF_LENGTH,
 };
 
+enum data_manager_demand_stats_window_e {
+    DM_DSW_1_MIN,
+    DM_DSW_15_MIN,
+    DM_DSW_1_HOUR,
+    DM_DSW_LENGTH,
+};
+
 typedef struct {
     time_t timestamp;
     float demand;
@@ -53,6 +75,8 @@ typedef struct {
     uint8_t electricity_active_tariff;
     data_manager_demand_data_point_t max_demand_active_month;
     data_manager_demand_data_point_t predicted_peak;
+    float local_avg_demand;                                 // Calculated on the device, see demand_calculator.c
+    data_manager_demand_data_point_t local_predicted_peak;  // Calculated on the device, timestamp is 0 if not available
 } data_manager_meter_data_t;
 
 typedef struct {
@@ -67,8 +91,32 @@ typedef struct {
     data_manager_history_data_t history_data;
 } data_manager_data_t;
 
+typedef uint32_t data_manager_field_mask_t;
+
+/**
+ * @brief Subscriber callback
+ *
+ * Called from the app event loop task, with the data manager data mutex released.
+ *
+ * @param[in] changed_fields The fields that changed since the last call (only the subscribed fields)
+ * @param[in] meter_data A copy of the meter data, taken when the update was delivered
+ * @param[in] arg The argument given when subscribing
+ */
+typedef void (*data_manager_subscriber_cb_t)(data_manager_field_mask_t changed_fields, const data_manager_meter_data_t *meter_data, void *arg);
+
+typedef struct {
+    data_manager_field_mask_t fields;       // Fields to receive updates for, use DM_DF_MASK()
+    uint32_t min_interval_ms;               // Minimum time between two calls of the callback, 0 for no limit
+    bool coalesce;                          // Deliver updates within min_interval_ms combined at the end of the interval, instead of dropping them
+    data_manager_subscriber_cb_t callback;
+    void *arg;                              // Passed to the callback
+} data_manager_subscription_config_t;
+
+typedef uint8_t data_manager_subscription_handle_t;
+
 // Function prototypes
 void data_manager_init(void);
+void data_manager_start_replay(void);
 SemaphoreHandle_t data_manager_get_data_mutex_handle(void);
 data_manager_meter_data_t * data_manager_get_meter_data(void);
 data_manager_history_data_t * data_manager_get_history_data(void);
@@ -78,6 +126,10 @@ void data_manager_add_max_demand_short_term_history_item(float value, time_t tim
 uint16_t data_manager_get_short_term_max_demand_history(data_manager_demand_data_point_t items[], uint16_t max_items);
 void data_manager_notify_new_meter_data_available(void);
 void data_manager_notify_new_meter_history_data_available(void);
+uint8_t data_manager_get_energy_buckets(energy_buckets_bucket_t buckets[ENERGY_BUCKETS_COUNT]);
+bool data_manager_get_demand_stats(enum data_manager_demand_stats_window_e window, rolling_stats_result_t *result);
+esp_err_t data_manager_subscribe(const data_manager_subscription_config_t *config, data_manager_subscription_handle_t *handle);
+esp_err_t data_manager_unsubscribe(data_manager_subscription_handle_t handle);
 
 
 #endif //DATA_MANAGER_H
\ No newline at end of file
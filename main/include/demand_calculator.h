@@ -0,0 +1,31 @@
+#ifndef DEMAND_CALCULATOR_H
+#define DEMAND_CALCULATOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define DEMAND_CALCULATOR_PERIOD_S 900                      // Length of a demand period in seconds (quarter-hour)
+#define DEMAND_CALCULATOR_MAX_SAMPLE_GAP_S 60               // Max time between two samples before the power integration is restarted
+#define DEMAND_CALCULATOR_REGISTER_RESOLUTION_KWH 0.001     // Resolution of the energy registers of the meter (1 Wh)
+
+typedef struct {
+    // Internal state
+    bool initialized;           // At least one sample has been processed
+    time_t period_start;        // Start of the current demand period
+    time_t last_timestamp;      // Timestamp of the last processed sample
+    double last_power;          // Power of the last processed sample in kW
+    double period_start_energy; // (Estimated) energy register value at the start of the period in kWh
+    double period_energy;       // Energy delivered in the current period in kWh
+
+    // Results
+    float avg_demand;           // Running average demand of the current period in kW
+    float predicted_peak;       // Predicted average demand at the end of the current period in kW
+    time_t predicted_peak_time; // End of the current period
+} demand_calculator_t;
+
+// Function prototypes
+void demand_calculator_reset(demand_calculator_t *calc);
+bool demand_calculator_update(demand_calculator_t *calc, time_t timestamp, float power, double energy);
+
+#endif //DEMAND_CALCULATOR_H
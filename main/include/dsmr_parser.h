@@ -0,0 +1,79 @@
+#ifndef DSMR_PARSER_H
+#define DSMR_PARSER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+#define DSMR_PARSER_MAX_LINE_LENGTH 1100    // Enough for the max demand of 13 months (0-0:98.1.0) on a single line
+#define DSMR_PARSER_MAX_DEMAND_YEAR_ITEMS 13
+
+// Fields present in the telegram, see dsmr_telegram_t.present_fields
+#define DSMR_FIELD_TIMESTAMP            (1 << 0)
+#define DSMR_FIELD_DELIVERED_TARIFF1    (1 << 1)
+#define DSMR_FIELD_DELIVERED_TARIFF2    (1 << 2)
+#define DSMR_FIELD_RETURNED_TARIFF1     (1 << 3)
+#define DSMR_FIELD_RETURNED_TARIFF2     (1 << 4)
+#define DSMR_FIELD_ACTIVE_TARIFF        (1 << 5)
+#define DSMR_FIELD_POWER_DELIVERED      (1 << 6)
+#define DSMR_FIELD_POWER_RETURNED       (1 << 7)
+#define DSMR_FIELD_CURRENT_AVG_DEMAND   (1 << 8)
+#define DSMR_FIELD_MAX_DEMAND_MONTH     (1 << 9)
+#define DSMR_FIELD_MAX_DEMAND_YEAR      (1 << 10)
+
+typedef struct {
+    time_t timestamp;
+    float demand;               // kW
+} dsmr_demand_t;
+
+typedef struct {
+    uint32_t present_fields;    // DSMR_FIELD_* flags of the fields found in the telegram
+    bool crc_checked;           // false for telegrams without CRC (DSMR 2.2 and 3)
+    time_t timestamp;           // 0-0:1.0.0
+    double delivered_tariff1;   // 1-0:1.8.1 in kWh
+    double delivered_tariff2;   // 1-0:1.8.2 in kWh
+    double returned_tariff1;    // 1-0:2.8.1 in kWh
+    double returned_tariff2;    // 1-0:2.8.2 in kWh
+    uint8_t active_tariff;      // 0-0:96.14.0
+    float power_delivered;      // 1-0:1.7.0 in kW
+    float power_returned;       // 1-0:2.7.0 in kW
+    float current_avg_demand;   // 1-0:1.4.0 in kW
+    dsmr_demand_t max_demand_month;     // 1-0:1.6.0
+    dsmr_demand_t max_demand_year[DSMR_PARSER_MAX_DEMAND_YEAR_ITEMS];   // 0-0:98.1.0
+    uint8_t max_demand_year_items;
+} dsmr_telegram_t;
+
+typedef enum {
+    DSMR_PARSER_RESULT_NONE,        // More data needed
+    DSMR_PARSER_RESULT_TELEGRAM,    // A complete and valid telegram was parsed
+    DSMR_PARSER_RESULT_CRC_ERROR,   // A complete telegram was received, but the CRC did not match
+} dsmr_parser_result_t;
+
+typedef enum {
+    DSMR_PARSER_STATE_WAIT_START,   // Waiting for the '/' of the header
+    DSMR_PARSER_STATE_DATA,         // Receiving the lines of the telegram, up to the '!'
+    DSMR_PARSER_STATE_CRC,          // Receiving the CRC after the '!'
+} dsmr_parser_state_t;
+
+typedef struct {
+    dsmr_parser_state_t state;
+    uint16_t crc;               // CRC of the telegram received so far
+    char line[DSMR_PARSER_MAX_LINE_LENGTH + 1];
+    uint16_t line_length;
+    bool line_overflow;         // The current line is too long, and is ignored
+    uint16_t received_crc;
+    uint8_t received_crc_digits;
+    dsmr_telegram_t telegram;   // The telegram being parsed, valid after DSMR_PARSER_RESULT_TELEGRAM
+
+    // Statistics
+    uint32_t telegram_count;
+    uint32_t crc_error_count;
+} dsmr_parser_t;
+
+// Function prototypes
+void dsmr_parser_init(dsmr_parser_t *parser);
+size_t dsmr_parser_feed(dsmr_parser_t *parser, const uint8_t *data, size_t len, dsmr_parser_result_t *result);
+uint16_t dsmr_parser_crc16(uint16_t crc, const uint8_t *data, size_t len);
+
+#endif //DSMR_PARSER_H
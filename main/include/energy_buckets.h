@@ -0,0 +1,28 @@
+#ifndef ENERGY_BUCKETS_H
+#define ENERGY_BUCKETS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define ENERGY_BUCKETS_COUNT 45                     // Number of buckets kept
+#define ENERGY_BUCKETS_INTERVAL_S (32 * 60)         // Length of a bucket, ENERGY_BUCKETS_COUNT buckets span 24 hours
+#define ENERGY_BUCKETS_MAX_GAP_S (4 * 60 * 60)      // Max time between two samples to spread the energy over, larger gaps are dropped
+
+typedef struct {
+    uint32_t start;             // Start of the bucket, 0 if the bucket is not used
+    float energy;               // Energy in the bucket in kWh
+} energy_buckets_bucket_t;
+
+typedef struct {
+    energy_buckets_bucket_t buckets[ENERGY_BUCKETS_COUNT];  // Ring buffer, the slot of a bucket is (start / ENERGY_BUCKETS_INTERVAL_S) % ENERGY_BUCKETS_COUNT
+    uint32_t last_timestamp;    // Timestamp of the last sample, 0 if there is none
+    double last_energy;         // Energy register value of the last sample in kWh
+} energy_buckets_t;
+
+// Function prototypes
+void energy_buckets_reset(energy_buckets_t *eb);
+bool energy_buckets_update(energy_buckets_t *eb, time_t timestamp, double energy, bool *bucket_completed);
+uint8_t energy_buckets_get(const energy_buckets_t *eb, energy_buckets_bucket_t buckets[ENERGY_BUCKETS_COUNT]);
+
+#endif //ENERGY_BUCKETS_H
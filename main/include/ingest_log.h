@@ -0,0 +1,36 @@
+#ifndef INGEST_LOG_H
+#define INGEST_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "data_manager.h"
+
+#define INGEST_LOG_MODE_OFF 0
+#define INGEST_LOG_MODE_RECORD 1            // Record all data received by the data manager
+#define INGEST_LOG_MODE_REPLAY 2            // Replay a recorded log instead of using a data provider
+#define INGEST_LOG_MODE INGEST_LOG_MODE_OFF
+
+#define INGEST_LOG_BASE_PATH "/storage"
+#define INGEST_LOG_PARTITION_LABEL "storage"
+#define INGEST_LOG_DEFAULT_PATH INGEST_LOG_BASE_PATH "/ingest.log"
+#define INGEST_LOG_REPLAY_SPEED 1           // Replay speed multiplier, e.g. 60 replays an hour in a minute
+
+#define INGEST_LOG_MAGIC "KWIL"
+#define INGEST_LOG_VERSION 1
+
+typedef enum {
+    INGEST_LOG_RECORD_METER_DATA = 1,
+    INGEST_LOG_RECORD_HISTORY_DATA = 2,
+} ingest_log_record_type_t;
+
+// Function prototypes
+esp_err_t ingest_log_mount_storage(void);
+esp_err_t ingest_log_start_recording(const char *path);
+void ingest_log_stop_recording(void);
+bool ingest_log_is_recording(void);
+void ingest_log_record_meter_data(const data_manager_meter_data_t *meter_data);
+void ingest_log_record_history_data(const data_manager_history_data_t *history_data);
+esp_err_t ingest_log_start_replay(const char *path, uint16_t speed);
+
+#endif //INGEST_LOG_H
@@ -0,0 +1,34 @@
+#ifndef LOCAL_CLOCK_H
+#define LOCAL_CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define LOCAL_CLOCK_TIMEZONE "CET-1CEST,M3.5.0,M10.5.0/3"   // POSIX TZ string used for the local time (Europe/Brussels)
+#define LOCAL_CLOCK_SNTP_SERVER "pool.ntp.org"
+#define LOCAL_CLOCK_STEP_THRESHOLD_MS 2000      // Larger corrections are stepped, smaller corrections are slewed
+#define LOCAL_CLOCK_SLEW_RATE_PPM 50000         // Max slew rate, 50000 ppm = 50 ms per second
+#define LOCAL_CLOCK_SOURCE_TIMEOUT_S 3600       // A source is only overruled by a worse source when it did not sync for this long
+#define LOCAL_CLOCK_UNBOUNDED_LAG 0             // The data can be received any time later, only correct the clock forward
+#define LOCAL_CLOCK_HTTP_MAX_LAG_S 2            // Max time between the Date header of a response and the moment it is received
+
+// Time sources, in order of increasing accuracy
+typedef enum {
+    LOCAL_CLOCK_SOURCE_NONE,
+    LOCAL_CLOCK_SOURCE_P1,      // Timestamps of the meter data
+    LOCAL_CLOCK_SOURCE_HTTP,    // Date header of the web client responses
+    LOCAL_CLOCK_SOURCE_SNTP,
+} local_clock_source_t;
+
+// Function prototypes
+void local_clock_init(bool network_sync);
+time_t local_clock_get_time(void);
+int64_t local_clock_get_time_us(void);
+bool local_clock_is_synced(void);
+local_clock_source_t local_clock_get_source(void);
+void local_clock_set_time_us(local_clock_source_t source, int64_t unix_time_us);
+void local_clock_discipline(local_clock_source_t source, time_t timestamp, uint16_t max_lag_s);
+bool local_clock_parse_http_date(const char *value, time_t *timestamp);
+
+#endif //LOCAL_CLOCK_H
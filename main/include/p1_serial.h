@@ -0,0 +1,15 @@
+#ifndef P1_SERIAL_H
+#define P1_SERIAL_H
+
+#define P1_SERIAL_ENABLED 0                 // Read the meter data from the P1 port instead of a Kwartiwi server
+
+#define P1_SERIAL_UART_NUM UART_NUM_1
+#define P1_SERIAL_PIN_NUM_RX 17
+#define P1_SERIAL_BAUD_RATE 115200          // DSMR 4 and 5, 8N1 (DSMR 2.2 uses 9600 7E1)
+#define P1_SERIAL_INVERT_RX 1               // The P1 data line is inverted, set to 0 if there is an inverting transistor on the board
+#define P1_SERIAL_RX_BUF_SIZE 2048
+
+// Function prototypes
+_Noreturn void p1_serial_task(void *pvParameters);
+
+#endif //P1_SERIAL_H
@@ -0,0 +1,57 @@
+#ifndef ROLLING_STATS_H
+#define ROLLING_STATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "esp_err.h"
+
+typedef struct {
+    uint32_t timestamp;
+    float value;
+} rolling_stats_sample_t;
+
+typedef struct {
+    uint32_t seq;               // Sequence number of the sample, used to find out if it left the window
+    float value;
+} rolling_stats_deque_item_t;
+
+typedef struct {
+    rolling_stats_deque_item_t *items;
+    uint16_t head;              // Index of the front (oldest) item
+    uint16_t count;
+} rolling_stats_deque_t;
+
+typedef struct {
+    uint32_t window_s;          // Length of the window in seconds
+    uint16_t capacity;          // Max number of samples in the window, older samples are dropped when full
+
+    rolling_stats_sample_t *samples;    // Ring buffer with all samples in the window
+    uint16_t head;              // Index of the oldest sample
+    uint16_t count;             // Number of samples in the window
+    uint32_t next_seq;          // Sequence number of the next sample
+    rolling_stats_deque_t max_deque;    // Candidates for the maximum, values are decreasing from front to back
+    rolling_stats_deque_t min_deque;    // Candidates for the minimum, values are increasing from front to back
+    double sum;
+    double sum_sq;
+    uint16_t removed_since_recalc;      // Removals since the sums were recalculated, to limit rounding drift
+} rolling_stats_t;
+
+typedef struct {
+    uint16_t count;
+    float min;
+    float max;
+    float mean;
+    float variance;
+    time_t first_timestamp;     // Timestamp of the oldest sample in the window
+    time_t last_timestamp;      // Timestamp of the newest sample in the window
+} rolling_stats_result_t;
+
+// Function prototypes
+esp_err_t rolling_stats_init(rolling_stats_t *stats, uint32_t window_s, uint16_t capacity);
+void rolling_stats_free(rolling_stats_t *stats);
+void rolling_stats_reset(rolling_stats_t *stats);
+void rolling_stats_add(rolling_stats_t *stats, time_t timestamp, float value);
+bool rolling_stats_get(const rolling_stats_t *stats, rolling_stats_result_t *result);
+
+#endif //ROLLING_STATS_H
@@ -15,6 +15,9 @@
 #define TSC2046_SPI_HOST            SPI2_HOST
 #define TSC2046_SPI_CLK_SPEED_HZ    (5*100*1000) // 500 kHz
 
+#define TSC2046_SAMPLE_COUNT        5   // Samples of x and y per read, of which the median is used (odd)
+#define TSC2046_FILTER_IIR_SHIFT    1   // IIR filter over the reads of a touch, new = old + (sample - old) / 2^shift
+
 #define TSC2046_NVS_NAMESPACE "tsc2046"
 #define TSC2046_NVS_KEY_CAL_DATA "cal_data"
 
@@ -37,9 +40,13 @@ typedef struct {
     uint16_t y_cal; // Target y coordinate
 } tsc2046_cal_data_point_t;
 
+typedef void (*tsc2046_touch_cb_t)(void *arg);   // Called from the PENIRQ ISR on touch down
+
 // Function prototypes
 esp_err_t tsc2046_init(void);
 tsc2046_data_t tsc2046_read(bool raw);
+void tsc2046_set_touch_cb(tsc2046_touch_cb_t cb, void *arg);
+bool tsc2046_is_touched(void);
 esp_err_t tsc2046_calibrate(const tsc2046_cal_data_point_t points[], size_t num_points);
 esp_err_t tsc2046_store_cal_data(void);
 bool tsc2046_is_calibrated(void);
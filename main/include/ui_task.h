@@ -3,6 +3,7 @@
 
 #include <sys/cdefs.h>
 #include "lvgl.h"
+#include "profiler_overlay.h"
 
 #define UI_TASK_PIN_NUM_LCD_DC          7
 #define UI_TASK_PIN_NUM_LCD_WR          15
@@ -26,12 +27,52 @@
 #define UI_TASK_DISPLAY_WIDTH  240
 #define UI_TASK_DISPLAY_HEIGHT 320
 
-#define UI_TASK_LVGL_TICK_PERIOD_MS 1
+#define UI_TASK_MAX_SLEEP_MS 1000   // Max time the UI task sleeps when no LVGL timer is due
+
+// Render buffer modes
+#define UI_TASK_RENDER_BUFFER_PARTIAL_DOUBLE    0   // Two DMA buffers of 1/5 of the screen in internal RAM, a band is rendered while the previous band is flushed
+#define UI_TASK_RENDER_BUFFER_FULL_PSRAM        1   // One full-frame buffer in PSRAM (LVGL direct mode), only the dirty areas are flushed
+#define UI_TASK_RENDER_BUFFER_SINGLE_SMALL      2   // One DMA buffer of 1/10 of the screen in internal RAM, for low-memory builds
+// Trade-offs for the 240x320 RGB565 display (full frame 153600 bytes), from the buffer sizes and the flush code:
+//   PARTIAL_DOUBLE  61440 bytes internal RAM, a full refresh is 5 bands of 64 rows (153600 bytes), a dirty area sends only its pixels
+//   FULL_PSRAM      153600 bytes PSRAM, a full refresh is 1 transfer (153600 bytes), a dirty area sends its full rows (480 bytes per row)
+//   SINGLE_SMALL    15360 bytes internal RAM, a full refresh is 10 bands of 32 rows (153600 bytes), no rendering during a transfer
+
+#define UI_TASK_RENDER_BUFFER_MODE UI_TASK_RENDER_BUFFER_PARTIAL_DOUBLE
+
+typedef struct {
+    uint32_t frames;                // Frames flushed
+    uint32_t bands;                 // Flushes (bands or dirty areas), bands / frames is the number of bands per frame
+    uint64_t flush_bytes;           // Bytes sent to the display
+    size_t internal_ram_bytes;      // Size of the render buffers in internal RAM
+    size_t psram_bytes;             // Size of the render buffers in PSRAM
+} ui_task_render_stats_t;
+
+// Tearing effect (TE) sync modes
+#define UI_TASK_TE_SYNC_OFF         0   // Flush the bands as soon as they are rendered
+#define UI_TASK_TE_SYNC_GPIO        1   // Start rendering every frame on the TE signal of the display
+#define UI_TASK_TE_SYNC_SIMULATED   2   // Start rendering every frame on a simulated TE signal (esp_timer), for testing without the TE line
+
+#define UI_TASK_TE_SYNC_MODE UI_TASK_TE_SYNC_OFF
+#define UI_TASK_TE_FRAME_PERIOD_US 16667    // Frame period of the display (ST7789 default frame rate is ~60 Hz)
+#define UI_TASK_TE_TIMEOUT_US UI_TASK_TE_FRAME_PERIOD_US    // Max wait for the TE signal (one frame), the frame is rendered anyway after this
+
+typedef struct {
+    uint32_t frames;        // Frames started on the TE signal
+    uint32_t missed_frames; // Frames not rendered and transferred before the next TE signal (can tear)
+    uint32_t te_timeouts;   // Frames started without a TE signal
+} ui_task_te_stats_t;
+
+#define UI_TASK_FRAME_STATS_PERIOD_MS 1000  // Period over which the frame statistics are averaged
 
 // Function prototypes
 _Noreturn void ui_task(void *pvParameters);
 void ui_task_calibrate_tp(lv_point_t src_points[], lv_point_t cal_points[], size_t len);
 void ui_task_store_tp_cal(void);
 void ui_task_use_raw_tp_data(bool raw);
+void ui_task_get_te_stats(ui_task_te_stats_t *stats);
+void ui_task_get_render_stats(ui_task_render_stats_t *stats);
+void ui_task_get_frame_stats(ui_frame_stats_t *stats);
+void ui_task_wake(void);
 
 #endif //UI_TASK_H
@@ -0,0 +1,494 @@
+/**
+ * @file ingest_log.c
+ * @brief Record and replay the data received by the data manager
+ *
+ * The data manager can record every update it receives from a data provider (web client or P1 port) in a binary log.
+ * The replay task feeds a recorded log back through the same path as the data providers, at the original speed or faster,
+ * so performance and behaviour can be compared between runs with the exact same data. The data manager is cleared before
+ * the replay, and does not store the energy buckets in NVS while replaying (see data_manager_start_replay()).
+ *
+ * The log is a file, on the device it is stored in the storage (SPIFFS) partition. It starts with a header:
+ *     magic "KWIL" (4 bytes), version (1 byte)
+ * followed by the records:
+ *     time since the previous record in ms (uint32), type (uint8), payload length (uint16), payload
+ * All values are little endian, floats are stored as their IEEE 754 bits.
+ *
+ * Meter data payload (49 bytes):
+ *     p1 timestamp (uint32), delivered tariff 1 and 2, returned tariff 1 and 2, current average demand,
+ *     current power usage, current power return (7 floats), active tariff (uint8),
+ *     max demand month timestamp (uint32) and demand (float), predicted peak timestamp (uint32) and demand (float)
+ *
+ * History data payload:
+ *     max demand year item count (uint8), items (uint32 timestamp, float demand),
+ *     short term write index (uint16), all DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS items of the ring buffer (uint32 timestamp, float demand)
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_spiffs.h"
+#include "data_manager.h"
+#include "ingest_log.h"
+
+#define RECORD_HEADER_SIZE 7
+#define METER_DATA_PAYLOAD_SIZE 49
+#define HISTORY_DATA_MAX_PAYLOAD_SIZE (1 + DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS * 8 + 2 + DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS * 8)
+#define HISTORY_DATA_MIN_PAYLOAD_SIZE (1 + 2 + DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS * 8)
+#define FLUSH_INTERVAL_RECORDS 10   // Records written before the file is flushed
+
+typedef struct {
+    char path[64];
+    uint16_t speed;
+} replay_args_t;
+
+static const char *TAG = "ingest_log";
+static SemaphoreHandle_t log_mutex = NULL;  // Protects the variables below
+static FILE *record_file = NULL;
+static int64_t last_record_time_us;
+static uint32_t records_since_flush;
+static uint8_t meter_data_payload[METER_DATA_PAYLOAD_SIZE];
+
+// Function prototypes
+static void write_record(ingest_log_record_type_t type, const uint8_t *payload, uint16_t length);
+static void replay_task(void *pvParameters);
+static void apply_meter_data(const uint8_t *payload, uint16_t length);
+static void apply_history_data(const uint8_t *payload, uint16_t length);
+static uint8_t * put_u32(uint8_t *buf, uint32_t value);
+static uint8_t * put_float(uint8_t *buf, float value);
+static uint32_t get_u32(const uint8_t *buf);
+static float get_float(const uint8_t *buf);
+
+
+/**
+ * @brief Mount the storage partition, where the logs are stored
+ *
+ * The partition is formatted if it can not be mounted.
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t ingest_log_mount_storage(void) {
+    const esp_vfs_spiffs_conf_t conf = {
+            .base_path = INGEST_LOG_BASE_PATH,
+            .partition_label = INGEST_LOG_PARTITION_LABEL,
+            .max_files = 2,
+            .format_if_mount_failed = true,
+    };
+
+    esp_err_t err = esp_vfs_spiffs_register(&conf);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to mount the storage partition: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    size_t total = 0, used = 0;
+    esp_spiffs_info(INGEST_LOG_PARTITION_LABEL, &total, &used);
+    ESP_LOGI(TAG, "Storage mounted, %d of %d bytes used", used, total);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Start recording the received data
+ *
+ * An existing log with the same path is overwritten.
+ *
+ * @param[in] path The path of the log
+ * @return ESP_OK on success, ESP_FAIL if the file could not be created
+ */
+esp_err_t ingest_log_start_recording(const char *path) {
+    if (log_mutex == NULL) {
+        log_mutex = xSemaphoreCreateMutex();
+        if (log_mutex == NULL) {
+            ESP_LOGE(TAG, "Failed to create log mutex");
+            abort();
+        }
+    }
+
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+
+    if (record_file != NULL) {
+        fclose(record_file);
+    }
+
+    record_file = fopen(path, "wb");
+    if (record_file == NULL) {
+        xSemaphoreGive(log_mutex);
+        ESP_LOGE(TAG, "Failed to create %s", path);
+        return ESP_FAIL;
+    }
+
+    const uint8_t version = INGEST_LOG_VERSION;
+    fwrite(INGEST_LOG_MAGIC, 1, 4, record_file);
+    fwrite(&version, 1, 1, record_file);
+    last_record_time_us = esp_timer_get_time();
+    records_since_flush = 0;
+
+    xSemaphoreGive(log_mutex);
+
+    ESP_LOGI(TAG, "Recording to %s", path);
+    return ESP_OK;
+}
+
+/**
+ * @brief Stop recording, and close the log
+ */
+void ingest_log_stop_recording(void) {
+    if (log_mutex == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    if (record_file != NULL) {
+        fclose(record_file);
+        record_file = NULL;
+        ESP_LOGI(TAG, "Recording stopped");
+    }
+    xSemaphoreGive(log_mutex);
+}
+
+/**
+ * @brief Check if the received data is being recorded
+ *
+ * @return true if recording
+ */
+bool ingest_log_is_recording(void) {
+    // Only used to skip the work when not recording, a stale value is checked again when writing
+    return record_file != NULL;
+}
+
+/**
+ * @brief Record the meter data received from a data provider
+ *
+ * Only the fields set by the data providers are recorded, the calculated fields are calculated again on replay.
+ *
+ * @param[in] meter_data The meter data
+ */
+void ingest_log_record_meter_data(const data_manager_meter_data_t *meter_data) {
+    if (!ingest_log_is_recording()) {
+        return;
+    }
+
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+
+    uint8_t *p = meter_data_payload;
+    p = put_u32(p, (uint32_t)meter_data->p1_timestamp);
+    p = put_float(p, meter_data->electricity_delivered_tariff1);
+    p = put_float(p, meter_data->electricity_delivered_tariff2);
+    p = put_float(p, meter_data->electricity_returned_tariff1);
+    p = put_float(p, meter_data->electricity_returned_tariff2);
+    p = put_float(p, meter_data->current_avg_demand);
+    p = put_float(p, meter_data->current_power_usage);
+    p = put_float(p, meter_data->current_power_return);
+    *p++ = meter_data->electricity_active_tariff;
+    p = put_u32(p, (uint32_t)meter_data->max_demand_active_month.timestamp);
+    p = put_float(p, meter_data->max_demand_active_month.demand);
+    p = put_u32(p, (uint32_t)meter_data->predicted_peak.timestamp);
+    p = put_float(p, meter_data->predicted_peak.demand);
+    assert(p - meter_data_payload == METER_DATA_PAYLOAD_SIZE);
+
+    write_record(INGEST_LOG_RECORD_METER_DATA, meter_data_payload, METER_DATA_PAYLOAD_SIZE);
+
+    xSemaphoreGive(log_mutex);
+}
+
+/**
+ * @brief Record the history data received from a data provider
+ *
+ * @param[in] history_data The history data
+ */
+void ingest_log_record_history_data(const data_manager_history_data_t *history_data) {
+    if (!ingest_log_is_recording()) {
+        return;
+    }
+
+    uint8_t *payload = heap_caps_malloc(HISTORY_DATA_MAX_PAYLOAD_SIZE, MALLOC_CAP_SPIRAM);
+    if (payload == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate memory for the history data record");
+        return;
+    }
+
+    uint8_t year_items = history_data->max_demand_year_items > DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS ? DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS : history_data->max_demand_year_items;
+    uint16_t short_term_index = history_data->max_demand_short_term_items;
+    uint8_t *p = payload;
+
+    *p++ = year_items;
+    for (uint8_t i = 0; i < year_items; i++) {
+        p = put_u32(p, (uint32_t)history_data->max_demand_year[i].timestamp);
+        p = put_float(p, history_data->max_demand_year[i].demand);
+    }
+    *p++ = (uint8_t)(short_term_index & 0xFF);
+    *p++ = (uint8_t)(short_term_index >> 8);
+    for (uint16_t i = 0; i < DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS; i++) {
+        p = put_u32(p, (uint32_t)history_data->max_demand_short_term[i].timestamp);
+        p = put_float(p, history_data->max_demand_short_term[i].demand);
+    }
+
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    write_record(INGEST_LOG_RECORD_HISTORY_DATA, payload, (uint16_t)(p - payload));
+    xSemaphoreGive(log_mutex);
+
+    heap_caps_free(payload);
+}
+
+/**
+ * @brief Start replaying a log
+ *
+ * The records are applied with the same timing as they were recorded, divided by the speed. Every record is due at
+ * its time in the log (divided by the speed) after the start of the replay, within one tick.
+ * Do not run a data provider (web client or P1 port) at the same time.
+ *
+ * @param[in] path The path of the log
+ * @param[in] speed The speed multiplier, 1 for the original speed
+ * @return ESP_OK if the replay task was started
+ */
+esp_err_t ingest_log_start_replay(const char *path, uint16_t speed) {
+    replay_args_t *args = malloc(sizeof(replay_args_t));
+    if (args == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    strlcpy(args->path, path, sizeof(args->path));
+    args->speed = speed > 0 ? speed : 1;
+
+    if (xTaskCreate(&replay_task, "ingest_replay", 4096, args, 5, NULL) != pdPASS) {
+        free(args);
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Write a record to the log
+ *
+ * @note The log mutex must be held by the caller
+ *
+ * @param[in] type The type of the record
+ * @param[in] payload The payload
+ * @param[in] length The length of the payload
+ */
+static void write_record(ingest_log_record_type_t type, const uint8_t *payload, uint16_t length) {
+    uint8_t header[RECORD_HEADER_SIZE];
+    int64_t now = esp_timer_get_time();
+
+    if (record_file == NULL) {
+        return;
+    }
+
+    put_u32(header, (uint32_t)((now - last_record_time_us) / 1000));
+    header[4] = (uint8_t)type;
+    header[5] = (uint8_t)(length & 0xFF);
+    header[6] = (uint8_t)(length >> 8);
+    last_record_time_us = now;
+
+    if (fwrite(header, 1, RECORD_HEADER_SIZE, record_file) != RECORD_HEADER_SIZE || fwrite(payload, 1, length, record_file) != length) {
+        ESP_LOGE(TAG, "Failed to write record, stopping the recording");
+        fclose(record_file);
+        record_file = NULL;
+        return;
+    }
+
+    records_since_flush++;
+    if (records_since_flush >= FLUSH_INTERVAL_RECORDS) {
+        fflush(record_file);
+        records_since_flush = 0;
+    }
+}
+
+/**
+ * @brief Replay a log, and delete the task at the end
+ *
+ * @param pvParameters The replay_args_t, freed by this task
+ */
+static void replay_task(void *pvParameters) {
+    replay_args_t *args = pvParameters;
+    uint8_t header[RECORD_HEADER_SIZE];
+    char magic[4];
+    uint8_t version;
+    uint32_t record_count = 0;
+    uint64_t recorded_ms = 0;       // Time of the current record since the start of the log
+    int64_t start_time = esp_timer_get_time();
+
+    uint8_t *payload = heap_caps_malloc(HISTORY_DATA_MAX_PAYLOAD_SIZE, MALLOC_CAP_SPIRAM);
+    FILE *file = fopen(args->path, "rb");
+
+    if (payload == NULL || file == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s for replay", args->path);
+        goto exit;
+    }
+
+    if (fread(magic, 1, 4, file) != 4 || memcmp(magic, INGEST_LOG_MAGIC, 4) != 0 || fread(&version, 1, 1, file) != 1 || version != INGEST_LOG_VERSION) {
+        ESP_LOGE(TAG, "%s is not a valid log", args->path);
+        goto exit;
+    }
+
+    // Replay into a clean data manager that does not store anything, so every replay gives the same results
+    data_manager_start_replay();
+    ESP_LOGI(TAG, "Replaying %s at %dx", args->path, args->speed);
+
+    // Every record is scheduled from the start of the replay, so the rounding to ticks does not add up over the log
+    TickType_t replay_start_ticks = xTaskGetTickCount();
+    TickType_t wake_ticks = replay_start_ticks;
+
+    while (fread(header, 1, RECORD_HEADER_SIZE, file) == RECORD_HEADER_SIZE) {
+        uint16_t length = (uint16_t)(header[5] | (header[6] << 8));
+
+        if (length > HISTORY_DATA_MAX_PAYLOAD_SIZE || fread(payload, 1, length, file) != length) {
+            ESP_LOGE(TAG, "Truncated or corrupted record %lu", record_count);
+            break;
+        }
+
+        recorded_ms += get_u32(header);
+        TickType_t due_ticks = replay_start_ticks + (TickType_t)(recorded_ms * configTICK_RATE_HZ / (1000ULL * args->speed));
+        if (due_ticks != wake_ticks) {
+            // Returns immediately when the replay is behind, the next records catch up
+            vTaskDelayUntil(&wake_ticks, due_ticks - wake_ticks);
+        }
+
+        switch ((ingest_log_record_type_t)header[4]) {
+            case INGEST_LOG_RECORD_METER_DATA:
+                apply_meter_data(payload, length);
+                break;
+            case INGEST_LOG_RECORD_HISTORY_DATA:
+                apply_history_data(payload, length);
+                break;
+            default:
+                ESP_LOGW(TAG, "Unknown record type %d", header[4]);
+        }
+        record_count++;
+    }
+
+    ESP_LOGI(TAG, "Replay done, %lu records in %lld ms (%llu ms recorded)", record_count,
+             (esp_timer_get_time() - start_time) / 1000, recorded_ms);
+
+exit:
+    if (file != NULL) {
+        fclose(file);
+    }
+    heap_caps_free(payload);
+    free(args);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Give a recorded meter data record to the data manager, the same way the data providers do
+ *
+ * @param[in] payload The payload of the record
+ * @param[in] length The length of the payload
+ */
+static void apply_meter_data(const uint8_t *payload, uint16_t length) {
+    if (length != METER_DATA_PAYLOAD_SIZE) {
+        ESP_LOGW(TAG, "Invalid meter data record");
+        return;
+    }
+
+    time_t p1_timestamp = get_u32(payload);
+    float tmp_float;
+    uint8_t active_tariff = payload[32];
+    data_manager_demand_data_point_t max_demand_month = {.timestamp = get_u32(payload + 33), .demand = get_float(payload + 37)};
+    data_manager_demand_data_point_t predicted_peak = {.timestamp = get_u32(payload + 41), .demand = get_float(payload + 45)};
+
+    data_manager_set_field(DM_DF_P1_TIMESTAMP, &p1_timestamp);
+    tmp_float = get_float(payload + 4);
+    data_manager_set_field(DM_DF_ELECTRICITY_DELIVERED_TARIFF1, &tmp_float);
+    tmp_float = get_float(payload + 8);
+    data_manager_set_field(DM_DF_ELECTRICITY_DELIVERED_TARIFF2, &tmp_float);
+    tmp_float = get_float(payload + 12);
+    data_manager_set_field(DM_DF_ELECTRICITY_RETURNED_TARIFF1, &tmp_float);
+    tmp_float = get_float(payload + 16);
+    data_manager_set_field(DM_DF_ELECTRICITY_RETURNED_TARIFF2, &tmp_float);
+    tmp_float = get_float(payload + 20);
+    data_manager_set_field(DM_DF_CURRENT_AVG_DEMAND, &tmp_float);
+    data_manager_add_max_demand_short_term_history_item(tmp_float, p1_timestamp);
+    tmp_float = get_float(payload + 24);
+    data_manager_set_field(DM_DF_CURRENT_POWER_USAGE, &tmp_float);
+    tmp_float = get_float(payload + 28);
+    data_manager_set_field(DM_DF_CURRENT_POWER_RETURN, &tmp_float);
+    data_manager_set_field(DM_DF_ELECTRICITY_ACTIVE_TARIFF, &active_tariff);
+    data_manager_set_field(DM_DF_MAX_DEMAND_MONTH, &max_demand_month);
+    data_manager_set_field(DM_DF_PREDICTED_PEAK, &predicted_peak);
+
+    data_manager_notify_new_meter_data_available();
+}
+
+/**
+ * @brief Give a recorded history data record to the data manager, the same way the web client does
+ *
+ * @param[in] payload The payload of the record
+ * @param[in] length The length of the payload
+ */
+static void apply_history_data(const uint8_t *payload, uint16_t length) {
+    SemaphoreHandle_t data_manager_mutex = data_manager_get_data_mutex_handle();
+    data_manager_history_data_t *history_data = data_manager_get_history_data();
+    const uint8_t *p = payload;
+
+    if (length < HISTORY_DATA_MIN_PAYLOAD_SIZE) {
+        ESP_LOGW(TAG, "Invalid history data record");
+        return;
+    }
+
+    uint8_t year_items = *p++;
+    if (year_items > DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS || length != HISTORY_DATA_MIN_PAYLOAD_SIZE + year_items * 8) {
+        ESP_LOGW(TAG, "Invalid history data record");
+        return;
+    }
+    uint16_t short_term_index = (uint16_t)(p[year_items * 8] | (p[year_items * 8 + 1] << 8));
+    if (short_term_index >= DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS) {
+        ESP_LOGW(TAG, "Invalid history data record");
+        return;
+    }
+
+    xSemaphoreTake(data_manager_mutex, portMAX_DELAY);
+
+    for (uint8_t i = 0; i < year_items; i++, p += 8) {
+        history_data->max_demand_year[i].timestamp = get_u32(p);
+        history_data->max_demand_year[i].demand = get_float(p + 4);
+    }
+    history_data->max_demand_year_items = year_items;
+    p += 2;
+
+    for (uint16_t i = 0; i < DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS; i++, p += 8) {
+        history_data->max_demand_short_term[i].timestamp = get_u32(p);
+        history_data->max_demand_short_term[i].demand = get_float(p + 4);
+    }
+    history_data->max_demand_short_term_items = short_term_index;
+
+    xSemaphoreGive(data_manager_mutex);
+
+    data_manager_notify_new_meter_history_data_available();
+}
+
+static uint8_t * put_u32(uint8_t *buf, uint32_t value) {
+    buf[0] = (uint8_t)(value & 0xFF);
+    buf[1] = (uint8_t)((value >> 8) & 0xFF);
+    buf[2] = (uint8_t)((value >> 16) & 0xFF);
+    buf[3] = (uint8_t)(value >> 24);
+    return buf + 4;
+}
+
+static uint8_t * put_float(uint8_t *buf, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return put_u32(buf, bits);
+}
+
+static uint32_t get_u32(const uint8_t *buf) {
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static float get_float(const uint8_t *buf) {
+    uint32_t bits = get_u32(buf);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
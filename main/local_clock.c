@@ -0,0 +1,329 @@
+/**
+ * @file local_clock.c
+ * @brief Local clock
+ *
+ * The local clock provides the current (unix) time to the application, also when no new meter data is received.
+ * It runs on the monotonic esp_timer, with an offset that is corrected by the time sources:
+ *   - SNTP, started when the Wi-Fi connection is made
+ *   - The Date header of the web client responses
+ *   - The timestamps of the meter data (P1 timestamps)
+ *
+ * Small corrections are slewed (the clock runs at most LOCAL_CLOCK_SLEW_RATE_PPM faster or slower), so the time
+ * does not jump and never goes backwards. Only corrections larger than LOCAL_CLOCK_STEP_THRESHOLD_MS, and the first
+ * sync, are stepped.
+ *
+ * A timestamp from the P1 or HTTP source is the time the data was created, which is before it is received.
+ * These sources can only tell the clock is wrong when it is before the timestamp, or later than the timestamp
+ * plus the maximum lag. Within these bounds the clock is left as is, so the delay of the data does not make it jitter.
+ * The lag of the P1 timestamps is unbounded (the data provider can stall), so they only move the clock forward.
+ *
+ * A source does not overrule a more accurate source, unless the more accurate source did not sync for LOCAL_CLOCK_SOURCE_TIMEOUT_S.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_event.h"
+#include "esp_timer.h"
+#include "esp_sntp.h"
+#include "networking.h"
+#include "local_clock.h"
+
+#define US_PER_S 1000000LL
+
+extern esp_event_loop_handle_t app_loop_handle;
+
+static const char *TAG = "local_clock";
+static portMUX_TYPE clock_lock = portMUX_INITIALIZER_UNLOCKED;    // Protects the variables below
+static int64_t offset_us = 0;                   // Unix time = esp_timer_get_time() + offset_us
+static int64_t slew_remaining_us = 0;           // Part of the last correction that is not applied yet
+static int64_t slew_last_us = 0;                // esp_timer time the slew was last applied
+static local_clock_source_t clock_source = LOCAL_CLOCK_SOURCE_NONE;
+static int64_t last_sync_us = 0;                // esp_timer time of the last sync with clock_source
+static bool network_sync_enabled = false;
+
+// Function prototypes
+static int64_t get_time_us_locked(int64_t now);
+static bool accept_source(local_clock_source_t source, int64_t now);
+static bool apply_correction(int64_t now, int64_t correction_us, bool force_step);
+static void start_sntp(void* handler_arg, esp_event_base_t base, int32_t id, void* event_data);
+static void sntp_sync_cb(struct timeval *tv);
+
+
+/**
+ * @brief Initialize the local clock
+ *
+ * Sets the timezone used by localtime(). With network sync, SNTP is started when the Wi-Fi is connected,
+ * and the HTTP source is accepted.
+ *
+ * @note Must be called after the app event loop is created
+ *
+ * @param[in] network_sync Use the network time sources (SNTP and HTTP), false to only follow the P1 timestamps (e.g. when replaying old data)
+ */
+void local_clock_init(bool network_sync) {
+    setenv("TZ", LOCAL_CLOCK_TIMEZONE, 1);
+    tzset();
+
+    network_sync_enabled = network_sync;
+    if (network_sync) {
+        ESP_ERROR_CHECK(esp_event_handler_register_with(app_loop_handle, NETWORKING_EVENTS, NETWORKING_EVENT_WIFI_CONNECTED, &start_sntp, NULL));
+    }
+}
+
+/**
+ * @brief Get the current time
+ *
+ * @return The current unix time in seconds
+ */
+time_t local_clock_get_time(void) {
+    return (time_t)(local_clock_get_time_us() / US_PER_S);
+}
+
+/**
+ * @brief Get the current time in microseconds
+ *
+ * @return The current unix time in microseconds
+ */
+int64_t local_clock_get_time_us(void) {
+    int64_t now = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&clock_lock);
+    int64_t time_us = get_time_us_locked(now);
+    taskEXIT_CRITICAL(&clock_lock);
+
+    return time_us;
+}
+
+/**
+ * @brief Check if the clock was set by a time source
+ *
+ * @return true if the clock was set
+ */
+bool local_clock_is_synced(void) {
+    return clock_source != LOCAL_CLOCK_SOURCE_NONE;
+}
+
+/**
+ * @brief Get the source of the last sync
+ *
+ * @return The time source
+ */
+local_clock_source_t local_clock_get_source(void) {
+    return clock_source;
+}
+
+/**
+ * @brief Set the clock to an accurate time
+ *
+ * Used for sources that provide the time of the moment they are received, e.g. SNTP.
+ *
+ * @param[in] source The time source
+ * @param[in] unix_time_us The current unix time in microseconds
+ */
+void local_clock_set_time_us(local_clock_source_t source, int64_t unix_time_us) {
+    int64_t now = esp_timer_get_time();
+    int64_t correction_us = 0;
+    bool stepped = false;
+
+    if (source != LOCAL_CLOCK_SOURCE_P1 && !network_sync_enabled) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&clock_lock);
+    bool first_sync = clock_source == LOCAL_CLOCK_SOURCE_NONE;
+    if (accept_source(source, now)) {
+        correction_us = unix_time_us - get_time_us_locked(now);
+        stepped = apply_correction(now, correction_us, first_sync);
+    }
+    taskEXIT_CRITICAL(&clock_lock);
+
+    if (stepped) {
+        ESP_LOGI(TAG, "Clock stepped %lld ms (source %d)", correction_us / 1000, source);
+    }
+    else if (correction_us != 0) {
+        ESP_LOGD(TAG, "Clock slewing %lld ms (source %d)", correction_us / 1000, source);
+    }
+}
+
+/**
+ * @brief Correct the clock with the timestamp of received data
+ *
+ * The data was created at the timestamp (with a resolution of 1 second), and received at most max_lag_s later.
+ * The clock is only corrected when it is outside these bounds.
+ *
+ * @param[in] source The time source
+ * @param[in] timestamp The timestamp of the data
+ * @param[in] max_lag_s The maximum time between the timestamp and the moment the data is received, LOCAL_CLOCK_UNBOUNDED_LAG to only correct forward
+ */
+void local_clock_discipline(local_clock_source_t source, time_t timestamp, uint16_t max_lag_s) {
+    int64_t now = esp_timer_get_time();
+    int64_t lower_us = (int64_t)timestamp * US_PER_S;
+    int64_t upper_us = lower_us + (1 + max_lag_s) * US_PER_S;
+    int64_t correction_us = 0;
+    bool stepped = false;
+
+    if (timestamp <= 0 || (source != LOCAL_CLOCK_SOURCE_P1 && !network_sync_enabled)) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&clock_lock);
+    bool first_sync = clock_source == LOCAL_CLOCK_SOURCE_NONE;
+    if (accept_source(source, now)) {
+        int64_t time_us = get_time_us_locked(now);
+        if (time_us < lower_us || first_sync) {
+            correction_us = lower_us - time_us;
+        }
+        else if (max_lag_s != LOCAL_CLOCK_UNBOUNDED_LAG && time_us > upper_us) {
+            correction_us = upper_us - time_us;
+        }
+        stepped = apply_correction(now, correction_us, first_sync);
+    }
+    taskEXIT_CRITICAL(&clock_lock);
+
+    if (stepped) {
+        ESP_LOGI(TAG, "Clock stepped %lld ms (source %d)", correction_us / 1000, source);
+    }
+    else if (correction_us != 0) {
+        ESP_LOGD(TAG, "Clock slewing %lld ms (source %d)", correction_us / 1000, source);
+    }
+}
+
+/**
+ * @brief Parse the value of a HTTP Date header
+ *
+ * Only the preferred format of RFC 7231 is supported, e.g. "Sun, 06 Nov 1994 08:49:37 GMT".
+ *
+ * @param[in] value The value of the header
+ * @param[out] timestamp The unix time
+ * @return true on success
+ */
+bool local_clock_parse_http_date(const char *value, time_t *timestamp) {
+    static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    char month_str[4];
+    int day, year, hour, min, sec;
+
+    if (sscanf(value, "%*3s, %2d %3s %4d %2d:%2d:%2d GMT", &day, month_str, &year, &hour, &min, &sec) != 6) {
+        return false;
+    }
+
+    const char *month_pos = strstr(months, month_str);
+    if (month_pos == NULL || (month_pos - months) % 3 != 0 || year < 1970) {
+        return false;
+    }
+    int month = (int)(month_pos - months) / 3 + 1;
+
+    // Days since 1970-01-01 of the civil date (proleptic Gregorian calendar)
+    int y = year - (month <= 2);
+    int era = y / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    int64_t days = (int64_t)era * 146097 + doe - 719468;
+
+    *timestamp = (time_t)(days * 86400 + hour * 3600 + min * 60 + sec);
+    return true;
+}
+
+/**
+ * @brief Get the current time, and apply the pending slew
+ *
+ * @note The clock lock must be held by the caller
+ *
+ * @param[in] now The current esp_timer time
+ * @return The current unix time in microseconds
+ */
+static int64_t get_time_us_locked(int64_t now) {
+    if (slew_remaining_us != 0) {
+        int64_t max_step = (now - slew_last_us) * LOCAL_CLOCK_SLEW_RATE_PPM / US_PER_S;
+        if (max_step == 0) {
+            // Too short to apply a step, keep slew_last_us so the time is not lost
+            return now + offset_us;
+        }
+        int64_t step = slew_remaining_us > 0 ? (slew_remaining_us < max_step ? slew_remaining_us : max_step)
+                                             : (slew_remaining_us > -max_step ? slew_remaining_us : -max_step);
+        offset_us += step;
+        slew_remaining_us -= step;
+    }
+    slew_last_us = now;
+
+    return now + offset_us;
+}
+
+/**
+ * @brief Check if a source may correct the clock, and make it the current source
+ *
+ * @note The clock lock must be held by the caller
+ *
+ * @param[in] source The time source
+ * @param[in] now The current esp_timer time
+ * @return true if the source may correct the clock
+ */
+static bool accept_source(local_clock_source_t source, int64_t now) {
+    if (source < clock_source && now - last_sync_us < LOCAL_CLOCK_SOURCE_TIMEOUT_S * US_PER_S) {
+        return false;
+    }
+
+    clock_source = source;
+    last_sync_us = now;
+    return true;
+}
+
+/**
+ * @brief Step or slew the clock
+ *
+ * A new correction replaces the part of the previous correction that is not applied yet,
+ * since it is measured against the current (partially corrected) time.
+ *
+ * @note The clock lock must be held by the caller, and the time must be read with get_time_us_locked() first
+ *
+ * @param[in] now The current esp_timer time
+ * @param[in] correction_us The correction
+ * @param[in] force_step Step the clock, also for small corrections (first sync)
+ * @return true if the clock was stepped
+ */
+static bool apply_correction(int64_t now, int64_t correction_us, bool force_step) {
+    if (force_step || llabs(correction_us) > LOCAL_CLOCK_STEP_THRESHOLD_MS * 1000LL) {
+        offset_us += correction_us;
+        slew_remaining_us = 0;
+        return correction_us != 0;
+    }
+
+    slew_remaining_us = correction_us;
+    slew_last_us = now;
+    return false;
+}
+
+/**
+ * @brief Start SNTP when the Wi-Fi is connected
+ *
+ * @param handler_arg
+ * @param base
+ * @param id
+ * @param event_data
+ */
+static void start_sntp(void* handler_arg, esp_event_base_t base, int32_t id, void* event_data) {
+    if (sntp_enabled()) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "Starting SNTP with server %s", LOCAL_CLOCK_SNTP_SERVER);
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    sntp_setservername(0, LOCAL_CLOCK_SNTP_SERVER);
+    sntp_set_time_sync_notification_cb(&sntp_sync_cb);
+    sntp_init();
+}
+
+/**
+ * @brief Called by SNTP with the received time
+ *
+ * @param[in] tv The received time
+ */
+static void sntp_sync_cb(struct timeval *tv) {
+    local_clock_set_time_us(LOCAL_CLOCK_SOURCE_SNTP, (int64_t)tv->tv_sec * US_PER_S + tv->tv_usec);
+}
@@ -12,6 +12,9 @@
 #include "tsc2046.h"
 #include "web_client.h"
 #include "data_manager.h"
+#include "p1_serial.h"
+#include "ingest_log.h"
+#include "local_clock.h"
 
 esp_event_loop_handle_t app_loop_handle;
 
@@ -52,9 +55,13 @@ void app_main(void) {
     };
     cJSON_InitHooks(&hooks);
 
+    // Initialize the local clock, a replayed log is not synced to the network time
+    esp_log_level_set("local_clock", ESP_LOG_INFO);
+    local_clock_init(INGEST_LOG_MODE != INGEST_LOG_MODE_REPLAY);
+
     // Initialize the buzzer
     esp_log_level_set("buzzer", ESP_LOG_DEBUG);
-    xTaskCreate(&buzzer_task, "buzzer_task", 4096, NULL, 5, NULL);
+    buzzer_init();
 
     // Initialize the touchscreen
     esp_log_level_set("tsc2046", ESP_LOG_INFO);
@@ -64,6 +71,12 @@ void app_main(void) {
     esp_log_level_set("data_manager", ESP_LOG_DEBUG);
     data_manager_init();
 
+#if INGEST_LOG_MODE == INGEST_LOG_MODE_RECORD
+    // Record all data given to the data manager
+    ESP_ERROR_CHECK(ingest_log_mount_storage());
+    ingest_log_start_recording(INGEST_LOG_DEFAULT_PATH);
+#endif
+
     // Initialize the UI
     esp_log_level_set("ui_task", ESP_LOG_DEBUG);
     esp_log_level_set("ui", ESP_LOG_DEBUG);
@@ -75,4 +88,15 @@ void app_main(void) {
 
     esp_log_level_set("web_client", ESP_LOG_DEBUG);
 
+#if INGEST_LOG_MODE == INGEST_LOG_MODE_REPLAY
+    // Replay a recorded log instead of using a data provider (the web client is not started)
+    esp_log_level_set("ingest_log", ESP_LOG_INFO);
+    ESP_ERROR_CHECK(ingest_log_mount_storage());
+    ESP_ERROR_CHECK(ingest_log_start_replay(INGEST_LOG_DEFAULT_PATH, INGEST_LOG_REPLAY_SPEED));
+#elif P1_SERIAL_ENABLED
+    // Read the meter data from the P1 port (the web client is not started)
+    esp_log_level_set("p1_serial", ESP_LOG_INFO);
+    xTaskCreate(&p1_serial_task, "p1_serial_task", 4096, NULL, 5, NULL);
+#endif
+
 }
@@ -0,0 +1,186 @@
+/**
+ * @file p1_serial.c
+ * @brief P1 serial data provider
+ *
+ * Reads the DSMR telegrams from the P1 port of the meter, and publishes the meter data to the data manager.
+ * This is an alternative for the web client, which gets the data from a Kwartiwi server.
+ * Enable it with P1_SERIAL_ENABLED in p1_serial.h.
+ *
+ * The predicted peak is not in the telegram, it is calculated by the data manager.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "data_manager.h"
+#include "dsmr_parser.h"
+#include "p1_serial.h"
+
+#define READ_BUF_SIZE 256
+#define READ_TIMEOUT_MS 100
+
+static const char *TAG = "p1_serial";
+static dsmr_parser_t parser;
+
+// Function prototypes
+static void init_uart(void);
+static bool publish_telegram(const dsmr_telegram_t *telegram);
+
+
+/**
+ * @brief P1 serial task
+ *
+ * Initializes the UART, and parses the received bytes.
+ * Every valid telegram with a timestamp is published to the data manager, and the subscribers are notified.
+ *
+ * @note This task should only be started after the data manager has been initialized
+ *
+ * @param pvParameters unused
+ */
+_Noreturn void p1_serial_task(void *pvParameters) {
+    static uint8_t buf[READ_BUF_SIZE];
+    bool first_telegram = true;
+
+    ESP_LOGI(TAG, "Starting P1 serial task");
+    init_uart();
+    dsmr_parser_init(&parser);
+
+    for (;;) {
+        int len = uart_read_bytes(P1_SERIAL_UART_NUM, buf, READ_BUF_SIZE, pdMS_TO_TICKS(READ_TIMEOUT_MS));
+        if (len < 0) {
+            ESP_LOGE(TAG, "Failed to read from UART");
+            vTaskDelay(pdMS_TO_TICKS(READ_TIMEOUT_MS));
+            continue;
+        }
+
+        // A read can contain the end of a telegram and the start of the next one
+        size_t offset = 0;
+        while (offset < (size_t)len) {
+            dsmr_parser_result_t result;
+            offset += dsmr_parser_feed(&parser, buf + offset, len - offset, &result);
+
+            if (result == DSMR_PARSER_RESULT_TELEGRAM) {
+                if (!publish_telegram(&parser.telegram)) {
+                    continue;
+                }
+
+                // There is no history on the P1 port, let the subscribers know the (empty) history is complete
+                if (first_telegram) {
+                    first_telegram = false;
+                    data_manager_notify_new_meter_history_data_available();
+                }
+                data_manager_notify_new_meter_data_available();
+            }
+            else if (result == DSMR_PARSER_RESULT_CRC_ERROR) {
+                ESP_LOGW(TAG, "CRC error in telegram (%lu errors, %lu telegrams)", parser.crc_error_count, parser.telegram_count);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Initialize the UART connected to the P1 port
+ */
+static void init_uart(void) {
+    const uart_config_t uart_config = {
+            .baud_rate = P1_SERIAL_BAUD_RATE,
+            .data_bits = UART_DATA_8_BITS,
+            .parity = UART_PARITY_DISABLE,
+            .stop_bits = UART_STOP_BITS_1,
+            .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+            .source_clk = UART_SCLK_DEFAULT,
+    };
+
+    ESP_ERROR_CHECK(uart_driver_install(P1_SERIAL_UART_NUM, P1_SERIAL_RX_BUF_SIZE, 0, 0, NULL, 0));
+    ESP_ERROR_CHECK(uart_param_config(P1_SERIAL_UART_NUM, &uart_config));
+    ESP_ERROR_CHECK(uart_set_pin(P1_SERIAL_UART_NUM, UART_PIN_NO_CHANGE, P1_SERIAL_PIN_NUM_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+#if P1_SERIAL_INVERT_RX
+    ESP_ERROR_CHECK(uart_set_line_inverse(P1_SERIAL_UART_NUM, UART_SIGNAL_RXD_INV));
+#endif
+}
+
+/**
+ * @brief Publish the fields of a telegram to the data manager
+ *
+ * Uses the same fields as the web client, only the fields present in the telegram are set.
+ *
+ * @param[in] telegram The parsed telegram
+ * @return true if the telegram was published, false if it was ignored (no timestamp)
+ */
+static bool publish_telegram(const dsmr_telegram_t *telegram) {
+    float tmp_float;
+    time_t p1_timestamp = telegram->timestamp;
+
+    if (!(telegram->present_fields & DSMR_FIELD_TIMESTAMP)) {
+        ESP_LOGW(TAG, "Telegram without timestamp, ignoring it");
+        return false;
+    }
+    data_manager_set_field(DM_DF_P1_TIMESTAMP, &p1_timestamp);
+
+    if (telegram->present_fields & DSMR_FIELD_DELIVERED_TARIFF1) {
+        tmp_float = (float)telegram->delivered_tariff1;
+        data_manager_set_field(DM_DF_ELECTRICITY_DELIVERED_TARIFF1, &tmp_float);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_DELIVERED_TARIFF2) {
+        tmp_float = (float)telegram->delivered_tariff2;
+        data_manager_set_field(DM_DF_ELECTRICITY_DELIVERED_TARIFF2, &tmp_float);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_RETURNED_TARIFF1) {
+        tmp_float = (float)telegram->returned_tariff1;
+        data_manager_set_field(DM_DF_ELECTRICITY_RETURNED_TARIFF1, &tmp_float);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_RETURNED_TARIFF2) {
+        tmp_float = (float)telegram->returned_tariff2;
+        data_manager_set_field(DM_DF_ELECTRICITY_RETURNED_TARIFF2, &tmp_float);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_ACTIVE_TARIFF) {
+        uint8_t active_tariff = telegram->active_tariff;
+        data_manager_set_field(DM_DF_ELECTRICITY_ACTIVE_TARIFF, &active_tariff);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_CURRENT_AVG_DEMAND) {
+        tmp_float = telegram->current_avg_demand;
+        data_manager_set_field(DM_DF_CURRENT_AVG_DEMAND, &tmp_float);
+        data_manager_add_max_demand_short_term_history_item(tmp_float, p1_timestamp);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_POWER_DELIVERED) {
+        tmp_float = telegram->power_delivered;
+        data_manager_set_field(DM_DF_CURRENT_POWER_USAGE, &tmp_float);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_POWER_RETURNED) {
+        tmp_float = telegram->power_returned;
+        data_manager_set_field(DM_DF_CURRENT_POWER_RETURN, &tmp_float);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_MAX_DEMAND_MONTH) {
+        data_manager_demand_data_point_t max_demand_month = {
+                .timestamp = telegram->max_demand_month.timestamp,
+                .demand = telegram->max_demand_month.demand,
+        };
+        data_manager_set_field(DM_DF_MAX_DEMAND_MONTH, &max_demand_month);
+    }
+
+    if (telegram->present_fields & DSMR_FIELD_MAX_DEMAND_YEAR) {
+        // The timestamp of the item after the last one should be 0
+        data_manager_demand_data_point_t max_demand_year[DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS] = {0};
+        for (uint8_t i = 0; i < telegram->max_demand_year_items && i < DATA_MANAGER_MAX_DEMAND_YEAR_ITEMS; i++) {
+            max_demand_year[i].timestamp = telegram->max_demand_year[i].timestamp;
+            max_demand_year[i].demand = telegram->max_demand_year[i].demand;
+        }
+        data_manager_set_field(DM_DF_MAX_DEMAND_YEAR, max_demand_year);
+    }
+
+    return true;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file rolling_stats.c
+ * @brief Sliding window statistics
+ *
+ * Keeps the minimum, maximum, mean and variance of the samples in a time window, ending at the newest sample.
+ * Adding a sample takes amortised O(1) time, getting the statistics takes O(1) time:
+ *   - The minimum and maximum are kept with monotonic deques, the front of the deque is the min/max of the window.
+ *   - The mean and variance are calculated from a running sum and sum of squares.
+ *
+ * The buffers are allocated in the PSRAM, a window of 1 hour with a sample every second takes about 86 kB.
+ *
+ * @note The functions are not thread safe, the caller has to protect the statistics.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "esp_heap_caps.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "rolling_stats.h"
+
+static const char *TAG = "rolling_stats";
+
+// Function prototypes
+static void remove_oldest(rolling_stats_t *stats);
+static void recalculate_sums(rolling_stats_t *stats);
+static void deque_push(rolling_stats_deque_t *deque, uint16_t capacity, uint32_t seq, float value, bool keep_max);
+static void deque_expire(rolling_stats_deque_t *deque, uint16_t capacity, uint32_t oldest_seq);
+
+
+/**
+ * @brief Initialize the statistics, and allocate the buffers
+ *
+ * @param[out] stats The statistics to initialize
+ * @param[in] window_s The length of the window in seconds
+ * @param[in] capacity The max number of samples in the window (e.g. window_s for a sample every second)
+ * @return
+ *   - ESP_OK on success
+ *   - ESP_ERR_INVALID_ARG if the window or capacity is 0
+ *   - ESP_ERR_NO_MEM if the buffers could not be allocated
+ */
+esp_err_t rolling_stats_init(rolling_stats_t *stats, uint32_t window_s, uint16_t capacity) {
+    if (window_s == 0 || capacity == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(stats, 0, sizeof(rolling_stats_t));
+    stats->window_s = window_s;
+    stats->capacity = capacity;
+    stats->samples = heap_caps_malloc(capacity * sizeof(rolling_stats_sample_t), MALLOC_CAP_SPIRAM);
+    stats->max_deque.items = heap_caps_malloc(capacity * sizeof(rolling_stats_deque_item_t), MALLOC_CAP_SPIRAM);
+    stats->min_deque.items = heap_caps_malloc(capacity * sizeof(rolling_stats_deque_item_t), MALLOC_CAP_SPIRAM);
+
+    if (stats->samples == NULL || stats->max_deque.items == NULL || stats->min_deque.items == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate buffers for %d samples", capacity);
+        rolling_stats_free(stats);
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Free the buffers of the statistics
+ *
+ * @param[in, out] stats The statistics
+ */
+void rolling_stats_free(rolling_stats_t *stats) {
+    heap_caps_free(stats->samples);
+    heap_caps_free(stats->max_deque.items);
+    heap_caps_free(stats->min_deque.items);
+    stats->samples = NULL;
+    stats->max_deque.items = NULL;
+    stats->min_deque.items = NULL;
+    stats->count = 0;
+}
+
+/**
+ * @brief Remove all samples
+ *
+ * @param[in, out] stats The statistics
+ */
+void rolling_stats_reset(rolling_stats_t *stats) {
+    stats->head = 0;
+    stats->count = 0;
+    stats->max_deque.head = 0;
+    stats->max_deque.count = 0;
+    stats->min_deque.head = 0;
+    stats->min_deque.count = 0;
+    stats->sum = 0;
+    stats->sum_sq = 0;
+    stats->removed_since_recalc = 0;
+}
+
+/**
+ * @brief Add a sample
+ *
+ * Samples that are older than the window (relative to this sample) are removed.
+ * A sample with the same timestamp as the newest sample is ignored, a sample older than the newest sample resets the statistics.
+ *
+ * @param[in, out] stats The statistics
+ * @param[in] timestamp The timestamp of the sample
+ * @param[in] value The value of the sample
+ */
+void rolling_stats_add(rolling_stats_t *stats, time_t timestamp, float value) {
+    if (stats->samples == NULL) {
+        return;
+    }
+
+    if (stats->count > 0) {
+        uint32_t last_timestamp = stats->samples[(stats->head + stats->count - 1) % stats->capacity].timestamp;
+        if ((uint32_t)timestamp == last_timestamp) {
+            return;
+        }
+        if ((uint32_t)timestamp < last_timestamp) {
+            rolling_stats_reset(stats);
+        }
+    }
+
+    // Remove the samples that left the window, and make room for the new sample
+    while (stats->count > 0 && stats->samples[stats->head].timestamp + stats->window_s <= (uint32_t)timestamp) {
+        remove_oldest(stats);
+    }
+    if (stats->count == stats->capacity) {
+        remove_oldest(stats);
+    }
+
+    // Add the new sample
+    uint16_t index = (stats->head + stats->count) % stats->capacity;
+    stats->samples[index].timestamp = (uint32_t)timestamp;
+    stats->samples[index].value = value;
+    stats->count++;
+    stats->sum += value;
+    stats->sum_sq += (double)value * value;
+
+    deque_push(&stats->max_deque, stats->capacity, stats->next_seq, value, true);
+    deque_push(&stats->min_deque, stats->capacity, stats->next_seq, value, false);
+    stats->next_seq++;
+
+    if (stats->removed_since_recalc >= stats->capacity) {
+        recalculate_sums(stats);
+    }
+}
+
+/**
+ * @brief Get the statistics of the samples in the window
+ *
+ * @note The window ends at the newest sample, samples are not removed when time passes without new samples.
+ *
+ * @param[in] stats The statistics
+ * @param[out] result The statistics of the window
+ * @return true if there are samples in the window, false otherwise (result is not changed)
+ */
+bool rolling_stats_get(const rolling_stats_t *stats, rolling_stats_result_t *result) {
+    if (stats->count == 0) {
+        return false;
+    }
+
+    double mean = stats->sum / stats->count;
+    double variance = stats->sum_sq / stats->count - mean * mean;
+
+    result->count = stats->count;
+    result->max = stats->max_deque.items[stats->max_deque.head].value;
+    result->min = stats->min_deque.items[stats->min_deque.head].value;
+    result->mean = (float)mean;
+    result->variance = variance > 0 ? (float)variance : 0;  // Rounding can make it slightly negative
+    result->first_timestamp = stats->samples[stats->head].timestamp;
+    result->last_timestamp = stats->samples[(stats->head + stats->count - 1) % stats->capacity].timestamp;
+
+    return true;
+}
+
+/**
+ * @brief Remove the oldest sample from the window
+ *
+ * @param[in, out] stats The statistics, must contain at least one sample
+ */
+static void remove_oldest(rolling_stats_t *stats) {
+    float value = stats->samples[stats->head].value;
+
+    stats->sum -= value;
+    stats->sum_sq -= (double)value * value;
+    stats->head = (stats->head + 1) % stats->capacity;
+    stats->count--;
+    stats->removed_since_recalc++;
+
+    // The sequence number of the oldest sample still in the window
+    uint32_t oldest_seq = stats->next_seq - stats->count;
+    deque_expire(&stats->max_deque, stats->capacity, oldest_seq);
+    deque_expire(&stats->min_deque, stats->capacity, oldest_seq);
+}
+
+/**
+ * @brief Recalculate the running sums from the samples
+ *
+ * Adding and removing values accumulates rounding errors, this is done once every capacity removals,
+ * so it stays amortised O(1).
+ *
+ * @param[in, out] stats The statistics
+ */
+static void recalculate_sums(rolling_stats_t *stats) {
+    stats->sum = 0;
+    stats->sum_sq = 0;
+    for (uint16_t i = 0; i < stats->count; i++) {
+        float value = stats->samples[(stats->head + i) % stats->capacity].value;
+        stats->sum += value;
+        stats->sum_sq += (double)value * value;
+    }
+    stats->removed_since_recalc = 0;
+}
+
+/**
+ * @brief Add a value to the back of a monotonic deque
+ *
+ * Values at the back that can never become the min/max anymore (because the new value is newer and larger/smaller) are removed.
+ *
+ * @param[in, out] deque The deque
+ * @param[in] capacity The capacity of the deque
+ * @param[in] seq The sequence number of the value
+ * @param[in] value The value
+ * @param[in] keep_max true for a max deque, false for a min deque
+ */
+static void deque_push(rolling_stats_deque_t *deque, uint16_t capacity, uint32_t seq, float value, bool keep_max) {
+    while (deque->count > 0) {
+        float back = deque->items[(deque->head + deque->count - 1) % capacity].value;
+        if (keep_max ? back > value : back < value) {
+            break;
+        }
+        deque->count--;
+    }
+
+    uint16_t index = (deque->head + deque->count) % capacity;
+    deque->items[index].seq = seq;
+    deque->items[index].value = value;
+    deque->count++;
+}
+
+/**
+ * @brief Remove the values that left the window from the front of a monotonic deque
+ *
+ * @param[in, out] deque The deque
+ * @param[in] capacity The capacity of the deque
+ * @param[in] oldest_seq The sequence number of the oldest sample in the window
+ */
+static void deque_expire(rolling_stats_deque_t *deque, uint16_t capacity, uint32_t oldest_seq) {
+    // Compare the difference, so a wrap of the sequence number is handled
+    while (deque->count > 0 && (int32_t)(deque->items[deque->head].seq - oldest_seq) < 0) {
+        deque->head = (deque->head + 1) % capacity;
+        deque->count--;
+    }
+}
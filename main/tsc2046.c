@@ -1,15 +1,33 @@
 /**
  * @file tsc2046.c
  * @brief TSC2046 touch screen controller driver
+ *
+ * Touches are detected with the PENIRQ line of the controller, which is pulled low while the screen is pressed.
+ * The SPI bus is only sampled while PENIRQ is low or a touch is in progress. The falling edge of PENIRQ calls the
+ * touch callback (tsc2046_set_touch_cb()), so the reader can be woken instead of polling the controller.
+ *
+ * A read is one queued DMA transaction, which clocks out the whole command sequence (see init_read_sequence()):
+ * the pressure, TSC2046_SAMPLE_COUNT samples of x and of y, and the power down command. The conversions overlap,
+ * the command of the next conversion is sent while the result of the previous one is received.
+ * The samples are filtered with a median, which ignores outliers, and an IIR low-pass filter over the reads of a touch.
+ *
+ * @note PENIRQ is only enabled while the controller is powered down between conversions (PD1=0, PD0=0),
+ * every read ends with a power down command.
  */
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "esp_system.h"
+#include "esp_attr.h"
 #include "esp_log.h"
 #include "driver/spi_master.h"
+#include "driver/gpio.h"
 #include "nvs.h"
 #include "tsc2046.h"
 
@@ -18,33 +36,70 @@
 #define CMD_X_READ  0b11010011
 #define CMD_Z1_READ 0b10110011
 #define CMD_Z2_READ 0b11000011
+#define CMD_POWER_DOWN 0b10010000   // Y read, then power down between conversions with PENIRQ enabled (PD1=0, PD0=0)
 
-#define BUFFER_SIZE 5   // 2 * 2 * 1 = 2 measurements * 2 bytes/measurement + 1 (first(rx) or last(tx) byte is a 0 byte)
+#define POWER_DOWN_BUFFER_SIZE 3    // 1 measurement * 2 bytes/measurement + 1
 #define Z_THRESHOLD 100 // Minimum z value to be considered a valid touch
-#define SAMPLE_COUNT 3  // Number of samples to average
+
+// Conversions of a read: z1, z2, the discarded first x, the x samples, the discarded first y, the y samples, power down
+#define READ_CONVERSIONS (2 + 1 + TSC2046_SAMPLE_COUNT + 1 + TSC2046_SAMPLE_COUNT + 1)
+#define READ_BUFFER_SIZE (READ_CONVERSIONS * 2 + 1)     // 2 bytes/measurement + 1 (the first rx byte is a 0 byte)
+#define READ_Z1_INDEX 0
+#define READ_Z2_INDEX 1
+#define READ_X_INDEX 3                                  // First x sample, after the discarded one
+#define READ_Y_INDEX (READ_X_INDEX + TSC2046_SAMPLE_COUNT + 1)
+
+#if TSC2046_SAMPLE_COUNT < 1 || TSC2046_SAMPLE_COUNT % 2 == 0
+#error "TSC2046_SAMPLE_COUNT must be odd"
+#endif
+#define CAL_DATA_COUNT 6
+#define CAL_FIXED_SHIFT 16                      // The fixed point coefficients are Q16.16
+#define CAL_FIXED_ONE (1 << CAL_FIXED_SHIFT)
 
 
 static char *TAG = "tsc2046";
 static spi_device_handle_t tsc2046_spi_dev;
 static SemaphoreHandle_t tsc2046_cal_data_mutex;
+static volatile bool pen_down = false;              // A touch is in progress, set by the PENIRQ ISR, cleared by tsc2046_read()
+static volatile tsc2046_touch_cb_t touch_cb = NULL;
+static void * volatile touch_cb_arg = NULL;
+DMA_ATTR static uint8_t read_tx_buffer[READ_BUFFER_SIZE];
+DMA_ATTR static uint8_t read_rx_buffer[READ_BUFFER_SIZE];
+static bool filter_valid = false;                   // The IIR filter has a value, false until the first sample of a touch
+static uint32_t filtered_x;                         // Filtered raw coordinates, scaled by 1 << TSC2046_FILTER_IIR_SHIFT
+static uint32_t filtered_y;
 
 /**
  * Calibration data
  * X = cal_data[0] * x_raw + cal_data[1] * y_raw + cal_data[2]
  * Y = cal_data[3] * x_raw + cal_data[4] * y_raw + cal_data[5]
+ *
+ * cal_data is the calibration as computed and stored in NVS, protected by tsc2046_cal_data_mutex.
+ * tsc2046_read() uses the fixed point copy cal_fixed, which is published with a sequence lock (cal_fixed_seq),
+ * so reading it takes no lock. The sequence number is odd while cal_fixed is written.
  */
-static double cal_data[6];
+static double cal_data[CAL_DATA_COUNT];
 static size_t cal_data_size = sizeof(cal_data);
 static bool calibrated = false;
+static int32_t cal_fixed[CAL_DATA_COUNT] = {CAL_FIXED_ONE, 0, 0, 0, CAL_FIXED_ONE, 0};
+static atomic_uint cal_fixed_seq = 0;
 
 // Function prototypes
 static esp_err_t read_cal_data_nvs(void);
+static void init_read_sequence(void);
+static uint16_t get_conversion(uint8_t index);
+static uint16_t median_of_conversions(uint8_t first_index);
+static void power_down(void);
+static void penirq_isr_handler(void *arg);
+static void publish_cal_data(void);
+static void apply_cal_data(uint16_t x_raw, uint16_t y_raw, uint16_t *x, uint16_t *y);
+static uint16_t clamp_coordinate(int64_t value);
 
 
 /**
  * @brief Initialize the TSC2046 touch screen controller
  *
- * This function will setup the SPI bus and device, and read the calibration data from NVS.
+ * This function will setup the SPI bus and device, the PENIRQ interrupt, and read the calibration data from NVS.
  */
 esp_err_t tsc2046_init(void) {
     ESP_LOGI(TAG, "Initializing TSC2046 touch screen controller");
@@ -94,6 +149,32 @@ esp_err_t tsc2046_init(void) {
         return ESP_FAIL;
     }
 
+    // Enable PENIRQ, and interrupt on its falling edge (touch down)
+    init_read_sequence();
+    power_down();
+    const gpio_config_t irq_gpio_config = {
+            .pin_bit_mask = 1ULL << TSC2046_PIN_NUM_IRQ,
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = GPIO_PULLUP_ENABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_NEGEDGE,
+    };
+    if (gpio_config(&irq_gpio_config) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure the PENIRQ pin");
+        return ESP_FAIL;
+    }
+
+    // The ISR service may already be installed by another driver
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "Failed to install the GPIO ISR service");
+        return ESP_FAIL;
+    }
+    if (gpio_isr_handler_add(TSC2046_PIN_NUM_IRQ, penirq_isr_handler, NULL) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add the PENIRQ interrupt handler");
+        return ESP_FAIL;
+    }
+
     // Read the calibration data from NVS
     if (read_cal_data_nvs() != ESP_OK) {
         ESP_LOGE(TAG, "Failed to read cal data from NVS");
@@ -109,7 +190,9 @@ esp_err_t tsc2046_init(void) {
  * This function will read the touch screen controller.
  * If a valid touch is detected, it will return the X and Y coordinates.
  * If no touch is detected, it will return 0 for X and Y.
- * SAMPLE_COUNT + 1 samples will be taken. The first one will be discarded, and the remaining ones will be averaged.
+ * TSC2046_SAMPLE_COUNT + 1 samples of x and y will be taken in one transaction. The first one will be discarded,
+ * the median of the remaining ones is filtered with the previous reads of the touch (IIR low-pass filter).
+ * The controller is only sampled while a touch is in progress or PENIRQ is low, otherwise no SPI transaction is done.
  *
  * @warning This function is not thread safe. It should only be called from one task.
  *
@@ -120,44 +203,53 @@ esp_err_t tsc2046_init(void) {
  */
 tsc2046_data_t tsc2046_read(bool raw) {
     tsc2046_data_t result;
-    const uint8_t tx_data_z[BUFFER_SIZE] =  {CMD_Z1_READ, 0, CMD_Z2_READ, 0, 0};
-    const uint8_t tx_data_xy[BUFFER_SIZE] = {CMD_X_READ, 0, CMD_Y_READ, 0, 0};
-    uint8_t rx_data[5];
     uint16_t z1;
     uint16_t z2;
 
-    spi_transaction_t spi_tran = {
-            .length = BUFFER_SIZE * 8,
-            .rxlength = 0,
-            .tx_buffer = tx_data_z,
-            .rx_buffer = rx_data,
-    };
-
-    ESP_ERROR_CHECK(spi_device_polling_transmit(tsc2046_spi_dev, &spi_tran));
-    z1 = ((rx_data[1] << 8) + rx_data[2]) >> 3;
-    z2 = ((rx_data[3] << 8) + rx_data[4]) >> 3;
-
     result.x = 0;
     result.y = 0;
     result.state = TSC2046_STATE_RELEASED;
 
-    // If the touch screen is not pressed, return
+    // Not touched, PENIRQ is only valid while the controller is powered down, which it is between reads
+    if (!pen_down && gpio_get_level(TSC2046_PIN_NUM_IRQ) != 0) {
+        return result;
+    }
+    pen_down = true;
+
+    // Read the pressure and the samples, and power down again, in one transaction
+    spi_transaction_t spi_tran = {
+            .length = READ_BUFFER_SIZE * 8,
+            .rxlength = 0,
+            .tx_buffer = read_tx_buffer,
+            .rx_buffer = read_rx_buffer,
+    };
+    ESP_ERROR_CHECK(spi_device_transmit(tsc2046_spi_dev, &spi_tran));
+    z1 = get_conversion(READ_Z1_INDEX);
+    z2 = get_conversion(READ_Z2_INDEX);
+
+    // If the touch screen is not pressed, PENIRQ is enabled again, ignore the samples and return
     if (z1 < Z_THRESHOLD || z2 > 4095 - Z_THRESHOLD) {
+        filter_valid = false;
+        pen_down = false;
         return result;
     }
 
-    // The touch screen is pressed, sample the x and y coordinates, and average the result
+    // The touch screen is pressed, filter the medians of the samples
     result.state = TSC2046_STATE_PRESSED;
-    spi_tran.tx_buffer = tx_data_xy;
-    spi_tran.rx_buffer = rx_data;
-    ESP_ERROR_CHECK(spi_device_polling_transmit(tsc2046_spi_dev, &spi_tran));  // Discard the first sample as it is not accurate
-    for (uint8_t i = 0; i < SAMPLE_COUNT; i++) {
-        ESP_ERROR_CHECK(spi_device_polling_transmit(tsc2046_spi_dev, &spi_tran));
-        result.x += ((rx_data[1] << 8) + rx_data[2]) >> 3;
-        result.y += ((rx_data[3] << 8) + rx_data[4]) >> 3;
+    uint32_t x = median_of_conversions(READ_X_INDEX);
+    uint32_t y = median_of_conversions(READ_Y_INDEX);
+    if (filter_valid) {
+        filtered_x += x - (filtered_x >> TSC2046_FILTER_IIR_SHIFT);
+        filtered_y += y - (filtered_y >> TSC2046_FILTER_IIR_SHIFT);
+    }
+    else {
+        // Start the filter at the first sample of a touch, so a new touch does not move from the previous one
+        filtered_x = x << TSC2046_FILTER_IIR_SHIFT;
+        filtered_y = y << TSC2046_FILTER_IIR_SHIFT;
+        filter_valid = true;
     }
-    result.x /= SAMPLE_COUNT;
-    result.y /= SAMPLE_COUNT;
+    result.x = (uint16_t)(filtered_x >> TSC2046_FILTER_IIR_SHIFT);
+    result.y = (uint16_t)(filtered_y >> TSC2046_FILTER_IIR_SHIFT);
 
     // Correct for orientation
     result.x = 4095 - result.x;
@@ -165,10 +257,7 @@ tsc2046_data_t tsc2046_read(bool raw) {
 
     // Apply calibration data if not in raw mode
     if (!raw) {
-        xSemaphoreTake(tsc2046_cal_data_mutex, portMAX_DELAY);
-        result.x = (uint16_t)(cal_data[0] * (double)result.x + cal_data[1] * (double)result.y + cal_data[2]);
-        result.y = (uint16_t)(cal_data[3] * (double)result.x + cal_data[4] * (double)result.y + cal_data[5]);
-        xSemaphoreGive(tsc2046_cal_data_mutex);
+        apply_cal_data(result.x, result.y, &result.x, &result.y);
     }
 
     ESP_LOGD(TAG, "Pressed: x: %d, y: %d", result.x, result.y);
@@ -176,6 +265,33 @@ tsc2046_data_t tsc2046_read(bool raw) {
     return result;
 }
 
+/**
+ * @brief Set the function called when the screen is touched
+ *
+ * The callback is called from the PENIRQ ISR on touch down, not for every sample of a touch.
+ * Read the touch with tsc2046_read() until it is released.
+ *
+ * @param[in] cb The callback, must be in IRAM (IRAM_ATTR), or NULL to remove the callback
+ * @param[in] arg The argument passed to the callback
+ */
+void tsc2046_set_touch_cb(tsc2046_touch_cb_t cb, void *arg) {
+    touch_cb = NULL;
+    touch_cb_arg = arg;
+    touch_cb = cb;
+}
+
+/**
+ * @brief Check if a touch is in progress
+ *
+ * A touch is in progress from touch down until tsc2046_read() returns released and PENIRQ is high.
+ * Use this to decide whether tsc2046_read() must still be called, without accessing the SPI bus.
+ *
+ * @return true if the screen is touched
+ */
+bool tsc2046_is_touched(void) {
+    return pen_down || gpio_get_level(TSC2046_PIN_NUM_IRQ) == 0;
+}
+
 /**
  * @brief Calibrate the touch screen to the supplied calibration points
  *
@@ -276,6 +392,7 @@ esp_err_t tsc2046_calibrate(const tsc2046_cal_data_point_t points[], const size_
                            + b[2] * (a[1] * d[0] - a[0] * d[1])
                           ) / k);
     ESP_LOGD(TAG, "Calibration data: %f %f %f %f %f %f", cal_data[0], cal_data[1], cal_data[2], cal_data[3], cal_data[4], cal_data[5]);
+    publish_cal_data();
     calibrated = true;
     xSemaphoreGive(tsc2046_cal_data_mutex);
 
@@ -385,10 +502,174 @@ static esp_err_t read_cal_data_nvs(void) {
         ESP_LOGI(TAG, "Calibration data found: %f, %f, %f, %f, %f, %f", cal_data[0], cal_data[1], cal_data[2], cal_data[3], cal_data[4], cal_data[5]);
         calibrated = true;
     }
+    publish_cal_data();
 
     // Free resources
     xSemaphoreGive(tsc2046_cal_data_mutex);
     nvs_close(nvs_handle);
 
     return err;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Fill the command sequence of a read
+ *
+ * Every conversion takes 16 clocks: the command byte, and 2 bytes of which the first 12 bits are the result.
+ * The command of the next conversion is sent with the last byte of the previous one.
+ */
+static void init_read_sequence(void) {
+    uint8_t commands[READ_CONVERSIONS];
+    uint8_t n = 0;
+
+    commands[n++] = CMD_Z1_READ;
+    commands[n++] = CMD_Z2_READ;
+    for (uint8_t i = 0; i < TSC2046_SAMPLE_COUNT + 1; i++) {
+        commands[n++] = CMD_X_READ;
+    }
+    for (uint8_t i = 0; i < TSC2046_SAMPLE_COUNT + 1; i++) {
+        commands[n++] = CMD_Y_READ;
+    }
+    commands[n++] = CMD_POWER_DOWN;
+    assert(n == READ_CONVERSIONS);
+
+    memset(read_tx_buffer, 0, sizeof(read_tx_buffer));
+    for (uint8_t i = 0; i < READ_CONVERSIONS; i++) {
+        read_tx_buffer[i * 2] = commands[i];
+    }
+}
+
+/**
+ * @brief Get the result of a conversion of the last read
+ *
+ * @param[in] index The index of the conversion in the command sequence
+ * @return The 12-bit result
+ */
+static uint16_t get_conversion(uint8_t index) {
+    return (uint16_t)(((read_rx_buffer[index * 2 + 1] << 8) + read_rx_buffer[index * 2 + 2]) >> 3);
+}
+
+/**
+ * @brief Get the median of TSC2046_SAMPLE_COUNT conversions of the last read
+ *
+ * @param[in] first_index The index of the first conversion in the command sequence
+ * @return The median
+ */
+static uint16_t median_of_conversions(uint8_t first_index) {
+    uint16_t samples[TSC2046_SAMPLE_COUNT];
+
+    // Insertion sort, the sample count is small
+    for (uint8_t i = 0; i < TSC2046_SAMPLE_COUNT; i++) {
+        uint16_t sample = get_conversion(first_index + i);
+        uint8_t j = i;
+        while (j > 0 && samples[j - 1] > sample) {
+            samples[j] = samples[j - 1];
+            j--;
+        }
+        samples[j] = sample;
+    }
+
+    return samples[TSC2046_SAMPLE_COUNT / 2];
+}
+
+/**
+ * @brief Power down the controller between conversions, which enables PENIRQ
+ */
+static void power_down(void) {
+    const uint8_t tx_data[POWER_DOWN_BUFFER_SIZE] = {CMD_POWER_DOWN, 0, 0};
+    uint8_t rx_data[POWER_DOWN_BUFFER_SIZE];
+
+    spi_transaction_t spi_tran = {
+            .length = POWER_DOWN_BUFFER_SIZE * 8,
+            .rxlength = 0,
+            .tx_buffer = tx_data,
+            .rx_buffer = rx_data,
+    };
+    ESP_ERROR_CHECK(spi_device_polling_transmit(tsc2046_spi_dev, &spi_tran));
+}
+
+/**
+ * @brief Handle the falling edge of PENIRQ (touch down)
+ *
+ * The conversions of a read also pull PENIRQ low, the callback is only called when no touch is in progress.
+ *
+ * @param arg unused
+ */
+static void IRAM_ATTR penirq_isr_handler(void *arg) {
+    tsc2046_touch_cb_t cb = touch_cb;
+
+    if (pen_down) {
+        return;
+    }
+    pen_down = true;
+    if (cb != NULL) {
+        cb(touch_cb_arg);
+    }
+}
+
+/**
+ * @brief Convert the calibration data to fixed point, and publish it to tsc2046_read()
+ *
+ * @note Call with tsc2046_cal_data_mutex taken, there is only one writer at a time
+ * @uses cal_data, cal_fixed, cal_fixed_seq
+ */
+static void publish_cal_data(void) {
+    int32_t fixed[CAL_DATA_COUNT];
+
+    for (uint8_t i = 0; i < CAL_DATA_COUNT; i++) {
+        double value = round(cal_data[i] * CAL_FIXED_ONE);
+        if (value > INT32_MAX || value < INT32_MIN) {
+            ESP_LOGW(TAG, "Calibration coefficient %d (%f) is out of range", i, cal_data[i]);
+            value = value > 0 ? INT32_MAX : INT32_MIN;
+        }
+        fixed[i] = (int32_t)value;
+    }
+
+    // Odd sequence number while writing, the readers retry until it is even and unchanged
+    unsigned seq = atomic_load_explicit(&cal_fixed_seq, memory_order_relaxed);
+    atomic_store_explicit(&cal_fixed_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(cal_fixed, fixed, sizeof(cal_fixed));
+    atomic_store_explicit(&cal_fixed_seq, seq + 2, memory_order_release);
+}
+
+/**
+ * @brief Apply the calibration to a raw touch point
+ *
+ * Takes no lock, the coefficients are read again if they were changed while reading them.
+ *
+ * @param[in] x_raw The raw x coordinate
+ * @param[in] y_raw The raw y coordinate
+ * @param[out] x The calibrated x coordinate
+ * @param[out] y The calibrated y coordinate
+ * @uses cal_fixed, cal_fixed_seq
+ */
+static void apply_cal_data(uint16_t x_raw, uint16_t y_raw, uint16_t *x, uint16_t *y) {
+    int32_t c[CAL_DATA_COUNT];
+    unsigned seq;
+
+    do {
+        seq = atomic_load_explicit(&cal_fixed_seq, memory_order_acquire);
+        memcpy(c, cal_fixed, sizeof(c));
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) != 0 || seq != atomic_load_explicit(&cal_fixed_seq, memory_order_relaxed));
+
+    // Both coordinates are computed from the raw point, rounded to the nearest pixel
+    *x = clamp_coordinate(((int64_t)c[0] * x_raw + (int64_t)c[1] * y_raw + c[2] + CAL_FIXED_ONE / 2) >> CAL_FIXED_SHIFT);
+    *y = clamp_coordinate(((int64_t)c[3] * x_raw + (int64_t)c[4] * y_raw + c[5] + CAL_FIXED_ONE / 2) >> CAL_FIXED_SHIFT);
+}
+
+/**
+ * @brief Clamp a calibrated coordinate to the range of tsc2046_data_t
+ *
+ * @param[in] value The coordinate
+ * @return The coordinate, 0 if it is negative
+ */
+static uint16_t clamp_coordinate(int64_t value) {
+    if (value < 0) {
+        return 0;
+    }
+    if (value > UINT16_MAX) {
+        return UINT16_MAX;
+    }
+    return (uint16_t)value;
+}
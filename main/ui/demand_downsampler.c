@@ -0,0 +1,127 @@
+/**
+ * @file demand_downsampler.c
+ * @brief Downsample demand samples to chart columns
+ *
+ * Maps the samples of a period (e.g. 900 samples of 1 second in a quarter-hour) to a smaller number of columns.
+ * Every column shows the highest sample in it, so short peaks stay visible.
+ * Columns without samples between two samples are linearly interpolated. The columns before the first sample stay empty.
+ *
+ * The columns are updated incrementally, every sample reports the range of columns that changed.
+ *
+ * A period is finished when a newer period starts, or by demand_downsampler_finish_period() (e.g. when the clock passed
+ * its end). Late samples of a finished period are ignored, also after a reset, so they can not start it again.
+ *
+ * @note The functions are not thread safe, the caller has to protect the downsampler.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <assert.h>
+#include "demand_downsampler.h"
+
+
+/**
+ * @brief Initialize the downsampler
+ *
+ * @param[out] ds The downsampler
+ * @param[in] column_count The number of columns (max DEMAND_DOWNSAMPLER_MAX_COLUMNS)
+ * @param[in] seconds_per_column The time covered by a column, the period is column_count * seconds_per_column
+ */
+void demand_downsampler_init(demand_downsampler_t *ds, uint16_t column_count, uint16_t seconds_per_column) {
+    assert(column_count > 0 && column_count <= DEMAND_DOWNSAMPLER_MAX_COLUMNS);
+    assert(seconds_per_column > 0);
+
+    ds->column_count = column_count;
+    ds->seconds_per_column = seconds_per_column;
+    ds->finished_period_start = 0;
+    demand_downsampler_reset(ds);
+}
+
+/**
+ * @brief Clear all columns
+ *
+ * The finished period is kept, its samples are still ignored.
+ *
+ * @param[in, out] ds The downsampler
+ */
+void demand_downsampler_reset(demand_downsampler_t *ds) {
+    ds->period_start = 0;
+    ds->last_column = -1;
+    for (uint16_t i = 0; i < ds->column_count; i++) {
+        ds->values[i] = DEMAND_DOWNSAMPLER_NO_VALUE;
+    }
+}
+
+/**
+ * @brief Finish the current period and clear all columns
+ *
+ * The samples of the finished period and older periods are ignored from now on.
+ *
+ * @param[in, out] ds The downsampler
+ */
+void demand_downsampler_finish_period(demand_downsampler_t *ds) {
+    if (ds->period_start > ds->finished_period_start) {
+        ds->finished_period_start = ds->period_start;
+    }
+    demand_downsampler_reset(ds);
+}
+
+/**
+ * @brief Add a sample
+ *
+ * A sample in a newer period finishes the current period, clears the columns and starts the new period.
+ * Samples of an older or a finished period are ignored.
+ *
+ * @param[in, out] ds The downsampler
+ * @param[in] time The time of the sample
+ * @param[in] value The value of the sample
+ * @param[out] first_changed The first column that changed
+ * @param[out] last_changed The last column that changed
+ * @return The result, first_changed and last_changed are only set if the sample was not ignored
+ */
+demand_downsampler_result_t demand_downsampler_add(demand_downsampler_t *ds, time_t time, uint16_t value, uint16_t *first_changed, uint16_t *last_changed) {
+    const time_t period = (time_t)ds->column_count * ds->seconds_per_column;
+    demand_downsampler_result_t result = DEMAND_DOWNSAMPLER_UPDATED;
+    time_t period_start = time - (time % period);
+
+    if (value == DEMAND_DOWNSAMPLER_NO_VALUE) {
+        value--;
+    }
+
+    if ((ds->finished_period_start != 0 && period_start <= ds->finished_period_start) ||
+        (ds->period_start != 0 && period_start < ds->period_start)) {
+        return DEMAND_DOWNSAMPLER_IGNORED;
+    }
+    if (period_start != ds->period_start) {
+        demand_downsampler_finish_period(ds);
+        ds->period_start = period_start;
+        result = DEMAND_DOWNSAMPLER_NEW_PERIOD;
+    }
+
+    int16_t column = (int16_t)((time - period_start) / ds->seconds_per_column);
+    *first_changed = (uint16_t)column;
+    *last_changed = (uint16_t)column;
+
+    if (column > ds->last_column && ds->last_column >= 0) {
+        // Interpolate the columns between the previous sample and this sample
+        int32_t previous = ds->values[ds->last_column];
+        int32_t distance = column - ds->last_column;
+        for (int16_t i = (int16_t)(ds->last_column + 1); i < column; i++) {
+            ds->values[i] = (uint16_t)(previous + ((int32_t)value - previous) * (i - ds->last_column) / distance);
+        }
+        *first_changed = (uint16_t)(ds->last_column + 1);
+    }
+
+    if (column > ds->last_column) {
+        // First sample in the column
+        ds->values[column] = value;
+        ds->last_column = column;
+    }
+    else if (ds->values[column] == DEMAND_DOWNSAMPLER_NO_VALUE || value > ds->values[column]) {
+        // Keep the highest sample of the column (also for late samples in an older column)
+        ds->values[column] = value;
+    }
+
+    return result;
+}
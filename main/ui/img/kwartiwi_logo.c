@@ -1,3 +1,5 @@
+/* Generated by tools/assets/gen_assets.py from src/kwartiwi_logo.png (qoi), do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -17,163 +19,316 @@
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
-#ifndef LV_ATTRIBUTE_IMG_KWARTIWI_LOGO_V1_240W_NA
-#define LV_ATTRIBUTE_IMG_KWARTIWI_LOGO_V1_240W_NA
+#ifndef LV_ATTRIBUTE_IMG_KWARTIWI_LOGO_240
+#define LV_ATTRIBUTE_IMG_KWARTIWI_LOGO_240
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_KWARTIWI_LOGO_V1_240W_NA uint8_t kwartiwi_logo_240_map[] = {
-  0xfe, 0xfe, 0xfe, 0xff, 	/*Color of index 0*/
-  0xdf, 0xdf, 0xdf, 0xff, 	/*Color of index 1*/
-  0xcc, 0xcc, 0xcc, 0xff, 	/*Color of index 2*/
-  0xb7, 0xb7, 0xb7, 0xff, 	/*Color of index 3*/
-  0xa6, 0xa6, 0xa6, 0xff, 	/*Color of index 4*/
-  0x94, 0x94, 0x94, 0xff, 	/*Color of index 5*/
-  0x74, 0x74, 0x74, 0xff, 	/*Color of index 6*/
-  0x4d, 0x4d, 0x4d, 0xff, 	/*Color of index 7*/
-  0xee, 0xf0, 0xf6, 0xff, 	/*Color of index 8*/
-  0xce, 0xda, 0xf7, 0xff, 	/*Color of index 9*/
-  0x3e, 0x72, 0xec, 0xff, 	/*Color of index 10*/
-  0xa8, 0xc0, 0xf3, 0xff, 	/*Color of index 11*/
-  0x7f, 0xa7, 0xf0, 0xff, 	/*Color of index 12*/
-  0x4d, 0x97, 0xed, 0xff, 	/*Color of index 13*/
-  0x0d, 0x8e, 0xec, 0xff, 	/*Color of index 14*/
-  0x10, 0x5b, 0xeb, 0xff, 	/*Color of index 15*/
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9b, 0xbc, 0xcc, 0xdd, 0xee, 0xdd, 0xcc, 0xbb, 0x99, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xbd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdb, 0xb8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xca, 0xee, 0xea, 0xed, 0xbb, 0x99, 0x88, 0x80, 0x80, 0x88, 0x88, 0x99, 0xbb, 0xcd, 0xee, 0xee, 0xec, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbd, 0xae, 0xae, 0xdb, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xbc, 0xee, 0xee, 0xdb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xda, 0xaa, 0xdb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbd, 0xee, 0xec, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xaa, 0xae, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xde, 0xee, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xaa, 0xac, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbe, 0xee, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xaf, 0xec, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbe, 0xee, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xaa, 0xab, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xee, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xaa, 0xfb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xed, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xda, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xce, 0xeb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xde, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xee, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xec, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xce, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xee, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xde, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xde, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xde, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xee, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xde, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x25, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x25, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x55, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x55, 0x55, 0x55, 0x55, 0x43, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x03, 0x55, 0x40, 0x00, 0x00, 0x25, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x55, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x55, 0x10, 0x00, 0x00, 0x55, 0x52, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x40, 0x00, 0x00, 0x37, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x38, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x27, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x76, 0x80, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x10, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x86, 0x77, 0x78, 0x00, 0x00, 0x27, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x10, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x27, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x80, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x30, 0x00, 0x00, 0x27, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x57, 0x77, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x76, 0x66, 0x66, 0x77, 0x77, 0x77, 0x68, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x80, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x02, 0x77, 0x75, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x08, 0x77, 0x77, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x57, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x77, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x08, 0x27, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x87, 0x77, 0x20, 0x00, 0x00, 0x00, 0x08, 0x67, 0x77, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x86, 0x77, 0x78, 0x00, 0x00, 0x00, 0x87, 0x77, 0x20, 0x00, 0x00, 0x00, 0x01, 0x77, 0x74, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x67, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x76, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x08, 0x67, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x07, 0x77, 0x30, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x57, 0x76, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x57, 0x77, 0x20, 0x00, 0x00, 0x00, 0x87, 0x77, 0x30, 0x00, 0x00, 0x00, 0x04, 0x77, 0x61, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x71, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x03, 0x77, 0x71, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x67, 0x75, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x02, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x06, 0x77, 0x38, 0x77, 0x72, 0x00, 0x00, 0x00, 0x08, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x40, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x06, 0x77, 0x50, 0x00, 0x00, 0x00, 0x05, 0x77, 0x40, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 0x77, 0x74, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x87, 0x77, 0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x50, 0x00, 0x00, 0x00, 0x87, 0x77, 0x20, 0x57, 0x75, 0x00, 0x00, 0x00, 0x08, 0x77, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x20, 0x47, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x07, 0x77, 0x20, 0x47, 0x76, 0x00, 0x00, 0x00, 0x08, 0x77, 0x73, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x67, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x27, 0x77, 0x00, 0x37, 0x77, 0x00, 0x00, 0x00, 0x01, 0x77, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x00, 0x17, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x04, 0x77, 0x70, 0x00, 0x00, 0x00, 0x17, 0x77, 0x10, 0x27, 0x77, 0x80, 0x00, 0x00, 0x08, 0x77, 0x72, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x03, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x70, 0x00, 0x00, 0x00, 0x47, 0x75, 0x00, 0x17, 0x77, 0x10, 0x00, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x75, 0x00, 0x07, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x03, 0x77, 0x78, 0x00, 0x00, 0x00, 0x37, 0x76, 0x00, 0x87, 0x77, 0x20, 0x00, 0x00, 0x01, 0x77, 0x72, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x17, 0x77, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x70, 0x00, 0x00, 0x00, 0x67, 0x73, 0x00, 0x07, 0x77, 0x30, 0x00, 0x00, 0x03, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x72, 0x00, 0x04, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x02, 0x77, 0x78, 0x00, 0x00, 0x00, 0x67, 0x74, 0x00, 0x06, 0x77, 0x40, 0x00, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x67, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x71, 0x00, 0x00, 0x01, 0x77, 0x71, 0x00, 0x04, 0x77, 0x50, 0x00, 0x00, 0x03, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x78, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x08, 0x77, 0x72, 0x00, 0x03, 0x77, 0x60, 0x00, 0x00, 0x02, 0x77, 0x78, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x03, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x02, 0x77, 0x70, 0x00, 0x02, 0x77, 0x70, 0x00, 0x00, 0x05, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x50, 0x00, 0x00, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x01, 0x77, 0x72, 0x00, 0x00, 0x02, 0x77, 0x78, 0x00, 0x02, 0x77, 0x78, 0x00, 0x00, 0x03, 0x77, 0x78, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x17, 0x77, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x72, 0x00, 0x00, 0x05, 0x77, 0x50, 0x00, 0x01, 0x77, 0x71, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x20, 0x00, 0x00, 0x57, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x02, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x08, 0x77, 0x73, 0x00, 0x00, 0x04, 0x77, 0x60, 0x00, 0x00, 0x77, 0x72, 0x00, 0x00, 0x04, 0x77, 0x70, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x67, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x72, 0x00, 0x00, 0x07, 0x77, 0x30, 0x00, 0x00, 0x67, 0x73, 0x00, 0x00, 0x06, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x80, 0x00, 0x00, 0x27, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x31, 0x11, 0x11, 0x12, 0x67, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x08, 0x77, 0x73, 0x00, 0x00, 0x06, 0x77, 0x40, 0x00, 0x00, 0x57, 0x75, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x84, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x73, 0x00, 0x00, 0x17, 0x77, 0x10, 0x00, 0x00, 0x47, 0x76, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x57, 0x76, 0x00, 0x00, 0x00, 0x87, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x77, 0x75, 0x00, 0x00, 0x87, 0x77, 0x10, 0x00, 0x00, 0x37, 0x77, 0x00, 0x00, 0x06, 0x77, 0x50, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x27, 0x77, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x74, 0x00, 0x00, 0x37, 0x77, 0x00, 0x00, 0x00, 0x27, 0x77, 0x80, 0x00, 0x87, 0x77, 0x30, 0x00, 0x00, 0x00, 0x08, 0x77, 0x73, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x67, 0x75, 0x00, 0x00, 0x27, 0x77, 0x80, 0x00, 0x00, 0x17, 0x77, 0x10, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x67, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x75, 0x00, 0x00, 0x67, 0x74, 0x00, 0x00, 0x00, 0x87, 0x77, 0x20, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x00, 0x03, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x57, 0x76, 0x00, 0x00, 0x57, 0x76, 0x00, 0x00, 0x00, 0x07, 0x77, 0x30, 0x00, 0x87, 0x77, 0x30, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x17, 0x77, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x76, 0x00, 0x08, 0x77, 0x72, 0x00, 0x00, 0x00, 0x06, 0x77, 0x40, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x05, 0x77, 0x71, 0x22, 0x22, 0x22, 0x22, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x31, 0x25, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x47, 0x77, 0x00, 0x00, 0x77, 0x73, 0x00, 0x00, 0x00, 0x05, 0x77, 0x50, 0x00, 0x87, 0x77, 0x30, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x02, 0x77, 0x76, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x77, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x00, 0x04, 0x77, 0x60, 0x00, 0x27, 0x77, 0x10, 0x00, 0x00, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x37, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x37, 0x77, 0x80, 0x01, 0x77, 0x71, 0x00, 0x00, 0x00, 0x03, 0x77, 0x78, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x47, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x80, 0x04, 0x77, 0x60, 0x00, 0x00, 0x00, 0x01, 0x77, 0x71, 0x00, 0x37, 0x77, 0x80, 0x00, 0x00, 0x00, 0x27, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x05, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x27, 0x77, 0x10, 0x03, 0x77, 0x70, 0x00, 0x00, 0x00, 0x01, 0x77, 0x71, 0x00, 0x27, 0x77, 0x10, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x86, 0x77, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x80, 0x06, 0x77, 0x40, 0x00, 0x00, 0x00, 0x08, 0x77, 0x72, 0x00, 0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x57, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x20, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x08, 0x67, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x27, 0x77, 0x10, 0x05, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x77, 0x73, 0x00, 0x37, 0x77, 0x80, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x02, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x10, 0x87, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x67, 0x75, 0x00, 0x57, 0x77, 0x00, 0x00, 0x00, 0x00, 0x77, 0x75, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x77, 0x50, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x27, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x87, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x47, 0x76, 0x00, 0x37, 0x77, 0x80, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x47, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x27, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x00, 0x67, 0x76, 0x00, 0x00, 0x00, 0x02, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x78, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x05, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x87, 0x77, 0x30, 0x17, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x80, 0x57, 0x77, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x06, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x30, 0x47, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x10, 0x67, 0x75, 0x00, 0x00, 0x00, 0x04, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x72, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x01, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x87, 0x77, 0x30, 0x37, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x20, 0x57, 0x76, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x01, 0x77, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x30, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x38, 0x77, 0x74, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x75, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x47, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x07, 0x77, 0x50, 0x67, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x40, 0x67, 0x75, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x37, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x51, 0x77, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x58, 0x77, 0x73, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x80, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x87, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x06, 0x77, 0x58, 0x77, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x68, 0x77, 0x75, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x05, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x53, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x72, 0x77, 0x72, 0x00, 0x00, 0x00, 0x47, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x04, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x05, 0x77, 0x62, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x71, 0x77, 0x73, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x01, 0x77, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x66, 0x77, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x75, 0x77, 0x72, 0x00, 0x00, 0x00, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x50, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x08, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x04, 0x77, 0x75, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x75, 0x77, 0x73, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x27, 0x77, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x77, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x71, 0x00, 0x00, 0x01, 0x77, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x78, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x77, 0x77, 0x72, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x05, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x77, 0x78, 0x00, 0x00, 0x04, 0x77, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x72, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x86, 0x77, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x77, 0x71, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x08, 0x67, 0x77, 0x20, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x77, 0x78, 0x00, 0x00, 0x86, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x74, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x02, 0x77, 0x77, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x77, 0x71, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x78, 0x00, 0x00, 0x00, 0x02, 0x77, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x70, 0x00, 0x00, 0x17, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x77, 0x00, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x60, 0x00, 0x00, 0x00, 0x01, 0x77, 0x77, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x77, 0x78, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x76, 0x00, 0x00, 0x00, 0x01, 0x77, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x77, 0x60, 0x00, 0x00, 0x47, 0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x20, 0x00, 0x17, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x60, 0x00, 0x00, 0x00, 0x01, 0x77, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x77, 0x77, 0x70, 0x00, 0x00, 0x00, 0x08, 0x77, 0x74, 
-  0x81, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x08, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x81, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x80, 0x00, 0x81, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xb0, 0x00, 0x00, 0x8a, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x00, 0x00, 0x09, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00, 0x09, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x0d, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfb, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfd, 0x00, 0x00, 0x00, 0x8b, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xb0, 0x00, 0x00, 0x00, 0xce, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0xba, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xd9, 0x00, 0x00, 0x00, 0x09, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa0, 0x00, 0x00, 0x00, 0x0b, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x90, 0x00, 0x00, 0x00, 0x0c, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xca, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xdb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xca, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xeb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xca, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xeb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9d, 0xac, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbd, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xda, 0xc9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9b, 0xdc, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xaa, 0xb9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9b, 0xdd, 0xc9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xde, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xaa, 0xcb, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x89, 0xbc, 0xdd, 0xbb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9b, 0xcd, 0xea, 0xcc, 0xb9, 0x99, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x89, 0x9b, 0xbc, 0xde, 0xcc, 0x99, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x99, 0xbb, 0xcc, 0xdd, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xdd, 0xcc, 0xb9, 0x99, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xee, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xde, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xde, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xee, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xee, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xce, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xdf, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xec, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xee, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xde, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xca, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xce, 0xeb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xaa, 0xfb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbe, 0xed, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xaf, 0xab, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xed, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfa, 0xac, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbe, 0xee, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xaa, 0xac, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xce, 0xee, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xaa, 0xae, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xde, 0xed, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xda, 0xea, 0xdb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbd, 0xee, 0xec, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbd, 0xae, 0xae, 0xdb, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xbc, 0xee, 0xee, 0xd9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xca, 0xea, 0xee, 0xec, 0xbb, 0x99, 0x88, 0x80, 0x80, 0x88, 0x88, 0x99, 0xbb, 0xce, 0xee, 0xee, 0xec, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xcd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdb, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x9b, 0xbc, 0xcc, 0xdd, 0xee, 0xdd, 0xcc, 0xbb, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_KWARTIWI_LOGO_240 uint8_t kwartiwi_logo_240_map[] = {
+  0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x7f, 0x04, 0x00, 0x40, 0xfd,
+  0xd7, 0xfe, 0xf7, 0xda, 0xce, 0xc0, 0xfe, 0xf3, 0xc0, 0xa8, 0xc0, 0xfe, 0xf0, 0xa7, 0x7f, 0xc1,
+  0xfe, 0xed, 0x97, 0x4d, 0xc0, 0xfe, 0xec, 0x8e, 0x0d, 0xc0, 0x0a, 0xc0, 0x01, 0xc0, 0x26, 0xc0,
+  0x3e, 0xc0, 0xfe, 0xf6, 0xf0, 0xee, 0xc0, 0x17, 0xfd, 0xfd, 0xea, 0x3e, 0x26, 0xc0, 0x0a, 0x1a,
+  0xd4, 0x0a, 0x26, 0xc0, 0x09, 0xc0, 0x17, 0xfd, 0xfd, 0xe1, 0x09, 0x26, 0x01, 0xfe, 0xec, 0x72,
+  0x3e, 0x1a, 0xc1, 0x25, 0x1a, 0x0a, 0x26, 0xc0, 0x3e, 0xc0, 0x09, 0xc1, 0x17, 0x09, 0x17, 0x09,
+  0xc2, 0x3e, 0xc0, 0x26, 0xc0, 0x01, 0x0a, 0x1a, 0xc3, 0x01, 0x3e, 0x09, 0x17, 0xfd, 0xfd, 0xdb,
+  0x09, 0x26, 0x0a, 0x25, 0x1a, 0x25, 0x1a, 0x0a, 0x26, 0x3e, 0x09, 0x17, 0xd4, 0x09, 0x3e, 0x26,
+  0x01, 0x1a, 0xc2, 0x0a, 0x26, 0x09, 0x17, 0xfd, 0xfd, 0xd6, 0x26, 0x0a, 0x25, 0xc1, 0x0a, 0x26,
+  0x3e, 0x17, 0xde, 0x3e, 0x26, 0x0a, 0x1a, 0xc1, 0x01, 0x3e, 0x17, 0xfd, 0xfd, 0xd1, 0x09, 0x26,
+  0x25, 0xc1, 0x1a, 0x26, 0x3e, 0x17, 0xe4, 0x09, 0x26, 0x0a, 0x1a, 0xc1, 0x26, 0x09, 0x17, 0xfd,
+  0xfd, 0xcc, 0x09, 0x01, 0x25, 0xc1, 0x01, 0x3e, 0x17, 0xea, 0x3e, 0x26, 0x1a, 0xc1, 0x26, 0x09,
+  0x17, 0xfd, 0xfd, 0xc8, 0x09, 0x01, 0x25, 0xfe, 0xeb, 0x5b, 0x10, 0x1a, 0x01, 0x09, 0x17, 0xee,
+  0x09, 0x26, 0x1a, 0xc1, 0x26, 0x09, 0x17, 0xfd, 0xfd, 0xc4, 0x09, 0x26, 0x25, 0xc1, 0x26, 0x09,
+  0x17, 0xf3, 0x26, 0x1a, 0xc1, 0x26, 0x17, 0xfd, 0xfd, 0xc2, 0x3e, 0x25, 0xc0, 0x2d, 0x26, 0x09,
+  0x17, 0xf7, 0x26, 0x1a, 0xc0, 0x0a, 0x3e, 0x17, 0xfd, 0xfc, 0x09, 0x0a, 0x25, 0x2d, 0x01, 0x09,
+  0x17, 0xfa, 0x09, 0x01, 0x1a, 0xc0, 0x26, 0x09, 0x17, 0xfd, 0xf9, 0x3e, 0x25, 0x2d, 0x25, 0x3e,
+  0x17, 0xfd, 0xc0, 0x3e, 0x0a, 0x1a, 0x0a, 0x3e, 0x17, 0xfd, 0xf7, 0x01, 0x2d, 0xc0, 0x01, 0x17,
+  0xfd, 0xc3, 0x09, 0x26, 0x1a, 0xc0, 0x26, 0x17, 0xfd, 0xf4, 0x09, 0x25, 0xc1, 0x3e, 0x17, 0xfd,
+  0xc6, 0x3e, 0x0a, 0x1a, 0x01, 0x09, 0x17, 0xfd, 0xf1, 0x3e, 0x25, 0x2d, 0x0a, 0x09, 0x17, 0xfd,
+  0xc8, 0x09, 0x01, 0x1a, 0x0a, 0x3e, 0x17, 0xfd, 0xef, 0x26, 0x2d, 0xc0, 0x01, 0x17, 0xfd, 0xcc,
+  0x26, 0x1a, 0xc0, 0x3e, 0x17, 0xfd, 0xed, 0x26, 0x2d, 0xc0, 0x26, 0x17, 0xfd, 0xce, 0x3e, 0x1a,
+  0xc0, 0x26, 0x17, 0xfd, 0xeb, 0x01, 0x2d, 0x25, 0x3e, 0x17, 0xfd, 0xd0, 0x3e, 0x0a, 0x1a, 0x26,
+  0x17, 0xfd, 0xe9, 0x01, 0x2d, 0x25, 0x3e, 0x17, 0xfd, 0xd2, 0x09, 0x0a, 0x1a, 0x26, 0x17, 0xfd,
+  0xe7, 0x01, 0x2d, 0x25, 0x3e, 0x17, 0xfd, 0xd4, 0x09, 0x0a, 0x1a, 0x26, 0x17, 0xfd, 0xe5, 0x01,
+  0x2d, 0x25, 0x09, 0x17, 0xfd, 0xd6, 0x09, 0x0a, 0x1a, 0x26, 0x17, 0xfd, 0xe3, 0x26, 0x2d, 0x25,
+  0x3e, 0x17, 0xfd, 0xd8, 0x09, 0x0a, 0x1a, 0x26, 0x17, 0xfd, 0xe1, 0x3e, 0x2d, 0xc0, 0x3e, 0x17,
+  0xfd, 0xda, 0x09, 0x1a, 0xc0, 0x3e, 0x17, 0xfd, 0xdf, 0x3e, 0x2d, 0xc0, 0x3e, 0x17, 0xfd, 0xdc,
+  0x3e, 0x1a, 0xc0, 0x09, 0x17, 0xfd, 0xdd, 0x09, 0x25, 0x2d, 0x26, 0x17, 0xfd, 0xde, 0x26, 0x1a,
+  0x0a, 0x09, 0x17, 0xfd, 0xdc, 0x0a, 0x2d, 0x0a, 0x17, 0xfd, 0xe0, 0x26, 0x1a, 0x01, 0x17, 0xfd,
+  0xdb, 0x26, 0x2d, 0x25, 0x09, 0x17, 0xfd, 0xe0, 0x09, 0x0a, 0x1a, 0x3e, 0x17, 0xfd, 0xd9, 0x3e,
+  0x2d, 0xc0, 0x3e, 0x17, 0xfd, 0xe2, 0x09, 0x1a, 0xc0, 0x09, 0x17, 0xfd, 0xd8, 0x25, 0x2d, 0x26,
+  0x17, 0xfd, 0xe4, 0x3e, 0x1a, 0x0a, 0x17, 0xfd, 0xd7, 0x26, 0x2d, 0x25, 0x17, 0xfd, 0xe6, 0x01,
+  0x1a, 0x3e, 0x17, 0xfd, 0xd5, 0x09, 0x2d, 0xc0, 0x09, 0x17, 0xfd, 0xe6, 0x09, 0x1a, 0xc0, 0x09,
+  0x17, 0xfd, 0xd4, 0x0a, 0x2d, 0x01, 0x17, 0xfd, 0xe8, 0x26, 0x1a, 0x01, 0x17, 0xfd, 0xd3, 0x3e,
+  0x2d, 0x25, 0x17, 0xfd, 0xea, 0x0a, 0x1a, 0x3e, 0x17, 0xfd, 0xd2, 0x25, 0x2d, 0x26, 0x17, 0xfd,
+  0xea, 0x3e, 0x1a, 0x01, 0x17, 0xfd, 0xd1, 0x26, 0x2d, 0x25, 0x17, 0xfd, 0xec, 0x01, 0x1a, 0x3e,
+  0x17, 0xfd, 0xd0, 0x25, 0x2d, 0x3e, 0x17, 0xfd, 0xec, 0x3e, 0x1a, 0x0a, 0x17, 0xfd, 0xcf, 0x26,
+  0x2d, 0x25, 0x17, 0xfd, 0xee, 0x01, 0x1a, 0x3e, 0x17, 0xfd, 0xce, 0x25, 0x2d, 0x3e, 0x17, 0xfd,
+  0xee, 0x3e, 0x1a, 0x01, 0x17, 0xfd, 0xcd, 0x3e, 0x2d, 0x25, 0x17, 0xfd, 0xf0, 0x0a, 0x1a, 0x3e,
+  0x17, 0xfd, 0xcc, 0x0a, 0x2d, 0x26, 0x17, 0xfd, 0xf0, 0x3e, 0x1a, 0x26, 0x17, 0xfd, 0xcd, 0x09,
+  0x17, 0xfd, 0xf3, 0x09, 0x17, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xce, 0xfe, 0xcc, 0xcc, 0xcc, 0xfe, 0x94, 0x94, 0x94, 0xc1, 0x17,
+  0xca, 0xfe, 0xa6, 0xa6, 0xa6, 0xc0, 0x17, 0xc4, 0x29, 0x21, 0xc0, 0x2f, 0x17, 0xc8, 0x09, 0x2f,
+  0x21, 0xc1, 0x29, 0x17, 0xc8, 0x81, 0x88, 0x21, 0xc1, 0x09, 0x17, 0xca, 0x29, 0x21, 0xc1, 0x06,
+  0x17, 0xcc, 0x09, 0x21, 0xc7, 0x2f, 0xb1, 0x88, 0x06, 0x09, 0x17, 0xc8, 0x2f, 0x21, 0xd2, 0x06,
+  0x17, 0xc3, 0x2e, 0x21, 0xc0, 0x2f, 0x17, 0xc3, 0x29, 0x21, 0xc1, 0x17, 0xc9, 0x2f, 0x21, 0xc1,
+  0x2e, 0x17, 0xc8, 0x09, 0x21, 0xc1, 0x06, 0x17, 0xc3, 0x21, 0xc1, 0x29, 0x2f, 0xfe, 0x4d, 0x4d,
+  0x4d, 0xc1, 0x09, 0x17, 0xc8, 0x06, 0x38, 0xc0, 0x2f, 0x17, 0xc3, 0x2e, 0x38, 0xc1, 0x09, 0x17,
+  0xc7, 0x06, 0x38, 0xc2, 0xfe, 0x74, 0x74, 0x74, 0x17, 0xc8, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xca,
+  0x01, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x06, 0x38, 0xcb, 0x2e, 0x09, 0x17, 0xc6, 0x38, 0xd3, 0x2e,
+  0x17, 0xc3, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc3, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc7, 0x09, 0x38,
+  0xc2, 0x01, 0x09, 0x17, 0xc7, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc2, 0x09, 0x38, 0xc1, 0x2f, 0xc0,
+  0x38, 0xc1, 0x09, 0x17, 0xc7, 0x09, 0x01, 0x38, 0xc1, 0x09, 0x17, 0xc2, 0x29, 0x38, 0xc1, 0x09,
+  0x17, 0xc7, 0x2e, 0x38, 0xc3, 0x09, 0x17, 0xc7, 0x2e, 0x38, 0xc1, 0x17, 0xca, 0x06, 0x38, 0xc2,
+  0x01, 0x17, 0xcc, 0x06, 0x38, 0xcc, 0x01, 0x06, 0x17, 0xc5, 0x38, 0xd3, 0x29, 0x17, 0xc3, 0x21,
+  0x38, 0xc0, 0x01, 0x17, 0xc3, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc7, 0x29, 0x38, 0xc3, 0x09, 0x17,
+  0xc7, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc2, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17,
+  0xc7, 0x2f, 0x38, 0xc1, 0x2e, 0x17, 0xc3, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc7, 0x21, 0x38, 0xc3,
+  0x29, 0x17, 0xc7, 0x2f, 0x38, 0xc1, 0x17, 0xca, 0x2e, 0x38, 0xc3, 0x06, 0x17, 0xcb, 0x06, 0x38,
+  0xc2, 0x01, 0xc3, 0x38, 0xc4, 0x01, 0x09, 0x17, 0xc4, 0x38, 0xd3, 0x2e, 0x17, 0xc3, 0x01, 0x38,
+  0xc0, 0x01, 0x17, 0xc3, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc7, 0x2f, 0x38, 0xc3, 0x2e, 0x17, 0xc7,
+  0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc2, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc6,
+  0x29, 0x38, 0xc1, 0x21, 0x17, 0xc4, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x09, 0x38, 0xc4, 0x2f,
+  0x17, 0xc7, 0x21, 0x38, 0xc0, 0x21, 0x17, 0xca, 0x01, 0x38, 0xc3, 0x2f, 0x17, 0xcb, 0x06, 0x38,
+  0xc1, 0x29, 0x17, 0xc4, 0x09, 0x29, 0x38, 0xc2, 0x21, 0x17, 0xcd, 0x38, 0xc1, 0x2f, 0x17, 0xcc,
+  0x21, 0x38, 0xc0, 0x01, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x09, 0x01, 0x38, 0xc3,
+  0x21, 0x17, 0xc7, 0x2f, 0x38, 0xc1, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09,
+  0x17, 0xc5, 0x09, 0x01, 0x38, 0xc1, 0x09, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x06,
+  0x38, 0xc1, 0x2f, 0x38, 0xc0, 0x01, 0x17, 0xc7, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc9, 0x09, 0x38,
+  0xc1, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xcb, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x09, 0x01, 0x38,
+  0xc1, 0x06, 0x17, 0xcb, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc4,
+  0x38, 0xc1, 0x2e, 0x17, 0xc6, 0x09, 0x38, 0xc1, 0x2f, 0x38, 0xc1, 0x17, 0xc7, 0x21, 0x38, 0xc0,
+  0x01, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc5, 0x21, 0x38, 0xc1,
+  0x29, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc6, 0x2f, 0x38, 0xc0, 0x01, 0x06, 0x38, 0xc1,
+  0x09, 0x17, 0xc6, 0x38, 0xc1, 0x2f, 0x17, 0xc9, 0x2e, 0x38, 0xc1, 0x06, 0x38, 0xc1, 0x06, 0x17,
+  0xca, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc7, 0x29, 0x38, 0xc1, 0x2e, 0x17, 0xcc, 0x38, 0xc1, 0x2f,
+  0x17, 0xcc, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc4, 0x38, 0xc1, 0x2f, 0x17, 0xc6, 0x2e, 0x38, 0xc1,
+  0x06, 0x38, 0xc1, 0x06, 0x17, 0xc6, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f,
+  0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc4, 0x29, 0x38, 0xc1, 0x21, 0x17, 0xc7, 0x38, 0xc1, 0x2f, 0x17,
+  0xc6, 0x01, 0x38, 0xc0, 0x2e, 0x09, 0x38, 0xc1, 0x29, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2e, 0x17,
+  0xc9, 0x01, 0x38, 0xc0, 0x2f, 0x17, 0x01, 0x38, 0xc0, 0x2e, 0x17, 0xca, 0x06, 0x38, 0xc1, 0x29,
+  0x17, 0xc8, 0x38, 0xc1, 0x21, 0x17, 0xcb, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0,
+  0x01, 0x17, 0xc4, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc6, 0x21, 0x38, 0xc0, 0x2f, 0x17, 0x01, 0x38,
+  0xc0, 0x2e, 0x17, 0xc6, 0x38, 0xc1, 0x2f, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1,
+  0x09, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x01, 0x09, 0x17, 0xc7, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc5,
+  0x09, 0x38, 0xc1, 0x29, 0x17, 0x21, 0x38, 0xc0, 0x21, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x29, 0x17,
+  0xc8, 0x09, 0x38, 0xc1, 0x29, 0x17, 0x2f, 0x38, 0xc0, 0x01, 0x17, 0xca, 0x06, 0x38, 0xc1, 0x29,
+  0x17, 0xc8, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xcc, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38, 0xc0,
+  0x01, 0x17, 0xc4, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x38, 0xc1, 0x29, 0x17, 0x2f, 0x38, 0xc0,
+  0x01, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1,
+  0x09, 0x17, 0xc3, 0x01, 0x38, 0xc1, 0x29, 0x17, 0xc8, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x29,
+  0x38, 0xc1, 0x17, 0xc0, 0x2e, 0x38, 0xc1, 0x17, 0xc5, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc8, 0x2e,
+  0x38, 0xc1, 0x17, 0xc0, 0x06, 0x38, 0xc1, 0x06, 0x17, 0xc9, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc8,
+  0x2f, 0x38, 0xc1, 0x17, 0xcb, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17,
+  0xc4, 0x2f, 0x38, 0xc1, 0x17, 0xc5, 0x06, 0x38, 0xc1, 0x06, 0x17, 0x29, 0x38, 0xc1, 0x09, 0x17,
+  0xc4, 0x09, 0x38, 0xc1, 0x29, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17,
+  0xc2, 0x2e, 0x38, 0xc1, 0x2f, 0x17, 0xc9, 0x2f, 0x38, 0xc1, 0x17, 0xc5, 0x2f, 0x38, 0xc0, 0x21,
+  0x17, 0xc0, 0x06, 0x38, 0xc1, 0x06, 0x17, 0xc4, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc8, 0x21, 0x38,
+  0xc0, 0x21, 0x17, 0xc1, 0x38, 0xc1, 0x2e, 0x17, 0xc9, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc8, 0x21,
+  0x38, 0xc1, 0x17, 0xcc, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc4, 0x2e,
+  0x38, 0xc1, 0x09, 0x17, 0xc4, 0x2e, 0x38, 0xc0, 0x01, 0x17, 0xc0, 0x09, 0x38, 0xc1, 0x29, 0x17,
+  0xc4, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17,
+  0xc1, 0x06, 0x38, 0xc1, 0x01, 0x09, 0x17, 0xc9, 0x2e, 0x38, 0xc1, 0x17, 0xc5, 0x01, 0x38, 0xc0,
+  0x2e, 0x17, 0xc1, 0x38, 0xc1, 0x2e, 0x17, 0xc4, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc7, 0x09, 0x38,
+  0xc1, 0x29, 0x17, 0xc1, 0x2f, 0x38, 0xc0, 0x01, 0x17, 0xc9, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc8,
+  0x21, 0x38, 0xc0, 0x01, 0x17, 0xcb, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01,
+  0x17, 0xc4, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc4, 0x01, 0x38, 0xc0, 0x2f, 0x17, 0xc1, 0x01, 0x38,
+  0xc0, 0x2f, 0x17, 0xc4, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38,
+  0xc1, 0x09, 0x17, 0xc1, 0x01, 0x38, 0xc1, 0x06, 0x17, 0xca, 0x2e, 0x38, 0xc1, 0x06, 0x17, 0xc3,
+  0x06, 0x38, 0xc1, 0x06, 0x17, 0xc1, 0x2f, 0x38, 0xc0, 0x21, 0x17, 0xc4, 0x2e, 0x38, 0xc1, 0x17,
+  0xc8, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc1, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc8, 0x06, 0x38, 0xc1,
+  0x29, 0x17, 0xc7, 0x09, 0x38, 0xc1, 0x21, 0x17, 0xcc, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38,
+  0xc0, 0x01, 0x17, 0xc4, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x29, 0x17, 0xc1,
+  0x2e, 0x38, 0xc0, 0x01, 0x17, 0xc4, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f,
+  0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc0, 0x2e, 0x38, 0xc1, 0x2e, 0x17, 0xcb, 0x29, 0x38, 0xc1, 0x06,
+  0x17, 0xc3, 0x29, 0x38, 0xc1, 0x17, 0xc2, 0x29, 0x38, 0xc1, 0x17, 0xc4, 0x21, 0x38, 0xc1, 0x17,
+  0xc8, 0x21, 0x38, 0xc0, 0x21, 0x17, 0xc3, 0x38, 0xc1, 0x2e, 0x17, 0xc8, 0x06, 0x38, 0xc1, 0x29,
+  0x17, 0xc7, 0x2e, 0x38, 0xc1, 0x29, 0x17, 0xcb, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38,
+  0xc0, 0x01, 0x17, 0xc4, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc3, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc1,
+  0x29, 0x38, 0xc1, 0x09, 0x17, 0xc3, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc3, 0x09, 0x38, 0xc1, 0x2f,
+  0xc0, 0x38, 0xc1, 0x09, 0x17, 0x06, 0x38, 0xc1, 0x01, 0x09, 0x17, 0xcb, 0x06, 0x38, 0xc1, 0x29,
+  0x17, 0xc3, 0x21, 0x38, 0xc0, 0x21, 0x17, 0xc2, 0x06, 0x38, 0xc1, 0x06, 0x17, 0xc3, 0x21, 0x38,
+  0xc0, 0x01, 0x17, 0xc7, 0x09, 0x38, 0xc1, 0x29, 0x17, 0xc3, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc8,
+  0x06, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x29, 0x38, 0xc2, 0x09, 0x17, 0xcc, 0x38, 0xc1, 0x2f, 0x17,
+  0xcc, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc3, 0x2f, 0x38, 0xc0,
+  0x01, 0x17, 0xc3, 0x38, 0xc1, 0x29, 0x17, 0xc3, 0x2f, 0x38, 0xc1, 0x17, 0xc4, 0x09, 0x38, 0xc1,
+  0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0x01, 0x38, 0xc1, 0x06, 0x17, 0xcc, 0x09, 0x38, 0xc1, 0x29,
+  0x17, 0xc3, 0x38, 0xc1, 0x2e, 0x17, 0xc3, 0x01, 0x38, 0xc0, 0x2e, 0x17, 0xc3, 0x01, 0x38, 0xc0,
+  0x21, 0x17, 0xc7, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc3, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc7, 0x06,
+  0x38, 0xc1, 0x2e, 0x06, 0xc4, 0x29, 0x01, 0x38, 0xc2, 0x2e, 0x17, 0xcc, 0x09, 0x38, 0xc1, 0x2f,
+  0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc3, 0x01, 0x38,
+  0xc0, 0x2f, 0x17, 0xc3, 0x21, 0x38, 0xc0, 0x21, 0x17, 0xc3, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc4,
+  0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x2f, 0x38, 0xc1, 0x2e, 0x17, 0xcd, 0x09, 0x38,
+  0xc1, 0x2e, 0x17, 0xc2, 0x06, 0x38, 0xc1, 0x06, 0x17, 0xc3, 0x2f, 0x38, 0xc0, 0x01, 0x17, 0xc3,
+  0x38, 0xc1, 0x2f, 0x17, 0xc7, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2e, 0x17,
+  0xc7, 0x06, 0x38, 0xcd, 0x21, 0x17, 0xce, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38, 0xc0, 0x01,
+  0x17, 0xc5, 0x38, 0xc1, 0x21, 0x17, 0xc2, 0x09, 0x38, 0xc1, 0x06, 0x17, 0xc3, 0x2e, 0x38, 0xc1,
+  0x17, 0xc3, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x29,
+  0x38, 0xc1, 0x21, 0x09, 0x17, 0xce, 0x38, 0xc1, 0x2f, 0x17, 0xc2, 0x2e, 0x38, 0xc1, 0x17, 0xc4,
+  0x29, 0x38, 0xc1, 0x09, 0x17, 0xc1, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc6, 0x09, 0x38, 0xc1, 0x2e,
+  0x17, 0xc5, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc7, 0x06, 0x38, 0xcc, 0x2f, 0x09, 0x17, 0xcd, 0x09,
+  0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x01, 0x38, 0xc0, 0x21, 0x17,
+  0xc2, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc3, 0x06, 0x38, 0xc1, 0x06, 0x17, 0xc2, 0x38, 0xc1, 0x2f,
+  0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x01, 0x38, 0xc1, 0x2f, 0x17, 0xcf, 0x01,
+  0x38, 0xc0, 0x21, 0x17, 0xc2, 0x01, 0x38, 0xc0, 0x2f, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x29, 0x17,
+  0xc1, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc5, 0x2e, 0x38, 0xc1,
+  0x09, 0x17, 0xc6, 0x06, 0x38, 0xca, 0x21, 0x06, 0x17, 0xd0, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21,
+  0x38, 0xc0, 0x01, 0x17, 0xc5, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc2, 0x21, 0x38, 0xc0, 0x01, 0x17,
+  0xc5, 0x38, 0xc1, 0x2e, 0x17, 0xc1, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2f,
+  0xc0, 0x38, 0xc1, 0x06, 0x38, 0xc2, 0x29, 0x17, 0xce, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc1, 0x09,
+  0x38, 0xc1, 0x29, 0x17, 0xc5, 0x01, 0x38, 0xc0, 0x2f, 0x17, 0xc1, 0x06, 0x38, 0xc1, 0x29, 0x17,
+  0xc6, 0x21, 0x38, 0xc1, 0x06, 0x29, 0xc6, 0x38, 0xc1, 0x2e, 0x17, 0xc6, 0x06, 0x38, 0xc1, 0x2e,
+  0x06, 0x29, 0x21, 0x38, 0xc1, 0x2f, 0x17, 0xd2, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38,
+  0xc0, 0x01, 0x17, 0xc5, 0x2f, 0x38, 0xc1, 0x17, 0xc2, 0x38, 0xc1, 0x2e, 0x17, 0xc5, 0x21, 0x38,
+  0xc0, 0x21, 0x17, 0xc1, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38,
+  0xc1, 0x17, 0x29, 0x38, 0xc1, 0x01, 0x09, 0x17, 0xcd, 0x21, 0x38, 0xc1, 0x17, 0xc1, 0x29, 0x38,
+  0xc1, 0x06, 0x17, 0xc5, 0x2f, 0x38, 0xc0, 0x01, 0x17, 0xc1, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc6,
+  0x38, 0xce, 0x21, 0x17, 0xc6, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc1, 0x2e, 0x38, 0xc1, 0x29, 0x17,
+  0xd2, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x2e, 0x38, 0xc1, 0x09,
+  0x17, 0xc0, 0x06, 0x38, 0xc1, 0x06, 0x17, 0xc5, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc0, 0x06, 0x38,
+  0xc1, 0x29, 0x17, 0xc4, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0x2f, 0x38, 0xc1,
+  0x21, 0x17, 0xcd, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc0, 0x2f, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x06,
+  0x38, 0xc1, 0x06, 0x17, 0xc0, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc5, 0x29, 0x38, 0xcf, 0x09, 0x17,
+  0xc5, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc2, 0x21, 0x38, 0xc1, 0x09, 0x17, 0xd0, 0x09, 0x38, 0xc1,
+  0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc0, 0x2e,
+  0x38, 0xc1, 0x17, 0xc6, 0x06, 0x38, 0xc1, 0x06, 0x17, 0xc0, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc4,
+  0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0x09, 0x01, 0x38, 0xc1, 0x29, 0x17, 0xcc,
+  0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc0, 0x01, 0x38, 0xc0, 0x2f, 0x17, 0xc6, 0x09, 0x38, 0xc1, 0x29,
+  0x17, 0xc0, 0x2f, 0x38, 0xc1, 0x09, 0x17, 0xc5, 0x21, 0x38, 0xcf, 0x29, 0x17, 0xc5, 0x06, 0x38,
+  0xc1, 0x29, 0x17, 0xc2, 0x09, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xd1, 0x38, 0xc1, 0x2f, 0x17, 0xcc,
+  0x21, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc0, 0x21, 0x38, 0xc0, 0x21,
+  0x17, 0xc7, 0x38, 0xc1, 0x2e, 0x17, 0xc0, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc4, 0x09, 0x38, 0xc1,
+  0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc0, 0x29, 0x38, 0xc2, 0x09, 0x17, 0xcb, 0x29, 0x38, 0xc1,
+  0x06, 0x17, 0x09, 0x38, 0xc1, 0x29, 0x17, 0xc7, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc0, 0x21, 0x38,
+  0xc1, 0x17, 0xc6, 0x38, 0xc1, 0x21, 0x29, 0xc9, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc5, 0x06, 0x38,
+  0xc1, 0x29, 0x17, 0xc3, 0x29, 0x38, 0xc1, 0x2e, 0x17, 0xcf, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc,
+  0x01, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x06, 0x38, 0xc1, 0x29, 0x17, 0x09, 0x38, 0xc1, 0x2e, 0x17,
+  0xc7, 0x2f, 0x38, 0xc0, 0x01, 0x17, 0xc0, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc4, 0x09, 0x38, 0xc1,
+  0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc1, 0x2f, 0x38, 0xc1, 0x01, 0x17, 0xcb, 0x06, 0x38, 0xc1,
+  0x29, 0x17, 0x29, 0x38, 0xc1, 0x09, 0x17, 0xc7, 0x2e, 0x38, 0xc1, 0x17, 0xc0, 0x01, 0x38, 0xc0,
+  0x01, 0x17, 0xc5, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc9, 0x2e, 0x38, 0xc1, 0x09, 0x17, 0xc4, 0x06,
+  0x38, 0xc1, 0x29, 0x17, 0xc4, 0x21, 0x38, 0xc1, 0x06, 0x17, 0xcf, 0x38, 0xc1, 0x2f, 0x17, 0xcc,
+  0x21, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0x06, 0x38, 0xc1, 0x06, 0x17,
+  0xc7, 0x29, 0x38, 0xc1, 0x09, 0x17, 0x21, 0x38, 0xc1, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2f, 0xc0,
+  0x38, 0xc1, 0x09, 0x17, 0xc2, 0x01, 0x38, 0xc1, 0x2e, 0x17, 0xca, 0x06, 0x38, 0xc1, 0x2e, 0x17,
+  0x2f, 0x38, 0xc0, 0x01, 0x17, 0xc8, 0x06, 0x38, 0xc1, 0x06, 0x17, 0x01, 0x38, 0xc0, 0x21, 0x17,
+  0xc5, 0x2f, 0x38, 0xc1, 0x17, 0xca, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc4, 0x06, 0x38, 0xc1, 0x29,
+  0x17, 0xc4, 0x06, 0x38, 0xc1, 0x21, 0x17, 0xce, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38,
+  0xc0, 0x01, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0x2e, 0x38, 0xc1, 0x17, 0xc8, 0x09, 0x38,
+  0xc1, 0x29, 0x17, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1,
+  0x09, 0x17, 0xc2, 0x06, 0x38, 0xc2, 0x06, 0x17, 0xc9, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0x38, 0xc1,
+  0x2e, 0x17, 0xc9, 0x38, 0xc1, 0x2e, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xc5, 0x38, 0xc1, 0x2f, 0x17,
+  0xca, 0x09, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc4, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc5, 0x2f, 0x38,
+  0xc1, 0x29, 0x17, 0xce, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x38,
+  0xc1, 0x21, 0x17, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xc9, 0x01, 0x38, 0xc0, 0x2f, 0x17, 0x01, 0x38,
+  0xc0, 0x21, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc3, 0x2e, 0x38,
+  0xc1, 0x01, 0x17, 0xca, 0x38, 0xc1, 0x21, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc9, 0x21, 0x38, 0xc0,
+  0x21, 0x09, 0x38, 0xc1, 0x2e, 0x17, 0xc4, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xcb, 0x2f, 0x38, 0xc1,
+  0x09, 0x17, 0xc3, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x01, 0x17, 0xcd, 0x09,
+  0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x01, 0x38, 0xc0, 0x21, 0x09,
+  0x38, 0xc1, 0x29, 0x17, 0xc9, 0x2f, 0x38, 0xc0, 0x01, 0x09, 0x38, 0xc1, 0x21, 0x17, 0xc5, 0x09,
+  0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc4, 0x21, 0x38, 0xc1, 0x2f, 0x17, 0xc9, 0x01,
+  0x38, 0xc0, 0x21, 0x2e, 0x38, 0xc1, 0x17, 0xca, 0x2e, 0x38, 0xc1, 0x29, 0x38, 0xc1, 0x29, 0x17,
+  0xc4, 0x2f, 0x38, 0xc1, 0x17, 0xcc, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc3, 0x06, 0x38, 0xc1, 0x29,
+  0x17, 0xc6, 0x2f, 0x38, 0xc1, 0x2e, 0x17, 0xcd, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38, 0xc0,
+  0x01, 0x17, 0xc6, 0x21, 0x38, 0xc0, 0x01, 0x29, 0x38, 0xc1, 0x06, 0x17, 0xc9, 0x29, 0x38, 0xc1,
+  0x06, 0x38, 0xc1, 0x2e, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc4,
+  0x06, 0x38, 0xc2, 0x06, 0x17, 0xc8, 0x21, 0x38, 0xc0, 0x01, 0xc0, 0x38, 0xc0, 0x21, 0x09, 0x17,
+  0xc9, 0x06, 0x38, 0xc1, 0x21, 0x38, 0xc1, 0x29, 0x17, 0xc4, 0x38, 0xc1, 0x21, 0x17, 0xcd, 0x38,
+  0xc1, 0x21, 0x17, 0xc3, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x09, 0x38, 0xc2, 0x17, 0xcc, 0x09,
+  0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x2f, 0x38, 0xc1, 0x21, 0x38,
+  0xc0, 0x01, 0x17, 0xca, 0x09, 0x38, 0xc1, 0x21, 0x38, 0xc1, 0x2e, 0x17, 0xc5, 0x09, 0x38, 0xc1,
+  0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc5, 0x29, 0x38, 0xc1, 0x01, 0x09, 0x17, 0xc7, 0x21, 0x38,
+  0xc4, 0x2e, 0x17, 0xcb, 0x38, 0xc5, 0x06, 0x17, 0xc3, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xcd, 0x2f,
+  0x38, 0xc1, 0x09, 0x17, 0xc2, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc7, 0x2e, 0x38, 0xc1, 0x2f, 0x17,
+  0xcc, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x2e, 0x38, 0xc4, 0x2f,
+  0x17, 0xcb, 0x01, 0x38, 0xc4, 0x29, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09,
+  0x17, 0xc6, 0x21, 0x38, 0xc1, 0x21, 0x17, 0xc7, 0x2e, 0x38, 0xc4, 0x06, 0x17, 0xcb, 0x2f, 0x38,
+  0xc4, 0x09, 0x17, 0xc3, 0x2f, 0x38, 0xc1, 0x09, 0x17, 0xcd, 0x29, 0x38, 0xc1, 0x29, 0x17, 0xc2,
+  0x06, 0x38, 0xc1, 0x29, 0x17, 0xc7, 0x09, 0x01, 0x38, 0xc1, 0x06, 0x17, 0xca, 0x09, 0x38, 0xc1,
+  0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x2e, 0x38, 0xc4, 0x29, 0x17, 0xcb, 0x2e,
+  0x38, 0xc4, 0x06, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc6, 0x09,
+  0x01, 0x38, 0xc1, 0x29, 0x17, 0xc6, 0x2e, 0x38, 0xc4, 0x17, 0xcc, 0x29, 0x38, 0xc4, 0x09, 0x17,
+  0xc2, 0x09, 0x01, 0x38, 0xc0, 0x21, 0x17, 0xcf, 0x38, 0xc1, 0x2f, 0x17, 0xc2, 0x06, 0x38, 0xc1,
+  0x29, 0x17, 0xc8, 0x2e, 0x38, 0xc1, 0x21, 0x17, 0xcb, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x21, 0x38,
+  0xc0, 0x01, 0x17, 0xc6, 0x29, 0x38, 0xc4, 0x09, 0x17, 0xcb, 0x29, 0x38, 0xc4, 0x06, 0x17, 0xc5,
+  0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1, 0x09, 0x17, 0xc7, 0x29, 0x38, 0xc2, 0x09, 0x17, 0xc5,
+  0x29, 0x38, 0xc3, 0x21, 0x17, 0xcc, 0x06, 0x38, 0xc4, 0x17, 0xc3, 0x06, 0x38, 0xc1, 0x2e, 0x17,
+  0xcf, 0x21, 0x38, 0xc1, 0x17, 0xc2, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc9, 0x01, 0x38, 0xc1, 0x06,
+  0x17, 0xc9, 0x09, 0x38, 0xc1, 0x2f, 0x17, 0xcc, 0x01, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x06, 0x38,
+  0xc3, 0x01, 0x17, 0xcd, 0x38, 0xc4, 0x09, 0x17, 0xc5, 0x09, 0x38, 0xc1, 0x2f, 0xc0, 0x38, 0xc1,
+  0x09, 0x17, 0xc8, 0x2f, 0x38, 0xc1, 0x01, 0x17, 0xc5, 0x06, 0x38, 0xc3, 0x2e, 0x17, 0xcd, 0x01,
+  0x38, 0xc2, 0x01, 0x17, 0xc3, 0x2f, 0x38, 0xc1, 0x09, 0x17, 0xcf, 0x29, 0x38, 0xc1, 0x29, 0x17,
+  0xc1, 0x06, 0x38, 0xc1, 0x29, 0x17, 0xc9, 0x29, 0x38, 0xc1, 0x01, 0x17, 0xca, 0x38, 0xc1, 0x2f,
+  0x17, 0xcc, 0x21, 0x38, 0xc0, 0x01, 0x17, 0xc6, 0x06, 0x38, 0xc3, 0x2f, 0x17, 0xcc, 0x09, 0x21,
+  0x38, 0xc3, 0x17, 0xc6, 0x09, 0x38, 0xc1, 0x2f, 0x09, 0x06, 0xc1, 0x17, 0xca, 0x06, 0xc2, 0x17,
+  0xc5, 0x09, 0x06, 0xc3, 0x17, 0xce, 0x06, 0xc4, 0x17, 0xc3, 0x09, 0x06, 0xc1, 0x17, 0xd1, 0x06,
+  0xc1, 0x09, 0x17, 0xc1, 0x09, 0x06, 0xc1, 0x09, 0x17, 0xca, 0x06, 0xc2, 0x17, 0xca, 0x06, 0xc1,
+  0x09, 0x17, 0xcc, 0x06, 0xc2, 0x17, 0xc7, 0x06, 0xc3, 0x09, 0x17, 0xcd, 0x09, 0x06, 0xc3, 0x17,
+  0xc7, 0x06, 0xc1, 0x09, 0x17, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xc6, 0x09, 0x17, 0xfd, 0xfd, 0xfd, 0xc5, 0xfe, 0xf0, 0xa7, 0x7f, 0x2d, 0x26, 0x17,
+  0xc3, 0x09, 0x25, 0x3e, 0x17, 0xfd, 0xe0, 0x3e, 0x0a, 0x09, 0x17, 0xc3, 0x3e, 0x1a, 0x01, 0x17,
+  0xfd, 0xcc, 0x3e, 0x2d, 0x25, 0x17, 0xc4, 0x3e, 0x25, 0x09, 0x17, 0xfd, 0xdf, 0x0a, 0x3e, 0x17,
+  0xc4, 0x0a, 0x1a, 0x09, 0x17, 0xfd, 0xcd, 0x25, 0x2d, 0x26, 0x17, 0xc4, 0x26, 0x25, 0x17, 0xfd,
+  0xde, 0x01, 0x26, 0x17, 0xc4, 0x3e, 0x1a, 0x01, 0x17, 0xfd, 0xce, 0x26, 0x2d, 0x0a, 0x17, 0xc4,
+  0x09, 0x26, 0x25, 0x09, 0x17, 0xfd, 0xda, 0x09, 0x01, 0x26, 0x17, 0xc5, 0x01, 0x1a, 0x3e, 0x17,
+  0xfd, 0xcf, 0x25, 0x2d, 0x3e, 0x17, 0xc5, 0x26, 0x25, 0x3e, 0x17, 0xfd, 0xd8, 0x09, 0x0a, 0x3e,
+  0x17, 0xc5, 0x3e, 0x1a, 0x0a, 0x17, 0xfd, 0xd0, 0x26, 0x2d, 0x25, 0x17, 0xc6, 0x26, 0x25, 0x26,
+  0x17, 0xfd, 0xd6, 0x3e, 0x0a, 0x3e, 0x17, 0xc6, 0x01, 0x1a, 0x3e, 0x17, 0xfd, 0xd1, 0x25, 0x2d,
+  0x26, 0x17, 0xc6, 0x09, 0x25, 0x01, 0x3e, 0x17, 0xfd, 0xd2, 0x09, 0x01, 0xc0, 0x09, 0x17, 0xc6,
+  0x3e, 0x1a, 0x01, 0x17, 0xfd, 0xd2, 0x3e, 0x2d, 0x25, 0x17, 0xc8, 0x26, 0x25, 0x01, 0x17, 0xfd,
+  0xd0, 0x26, 0x1a, 0x3e, 0x17, 0xc8, 0x0a, 0x1a, 0x3e, 0x17, 0xfd, 0xd3, 0x0a, 0x2d, 0x01, 0x17,
+  0xc8, 0x09, 0x01, 0x25, 0x26, 0x09, 0x17, 0xfd, 0xcb, 0x3e, 0x0a, 0x26, 0x09, 0x17, 0xc8, 0x26,
+  0x1a, 0x01, 0x17, 0xfd, 0xd4, 0x3e, 0x2d, 0xc0, 0x3e, 0x17, 0xc9, 0x3e, 0x01, 0x25, 0x26, 0x09,
+  0x17, 0xfd, 0xc6, 0x09, 0x26, 0x1a, 0x26, 0x09, 0x17, 0xc9, 0x09, 0x1a, 0xc0, 0x09, 0x17, 0xfd,
+  0xd5, 0x26, 0x2d, 0x25, 0x17, 0xcb, 0x09, 0x01, 0x25, 0x01, 0x3e, 0x17, 0xfd, 0xc2, 0x3e, 0x26,
+  0x1a, 0x26, 0x09, 0x17, 0xcb, 0x01, 0x1a, 0x3e, 0x17, 0xfd, 0xd7, 0x25, 0x2d, 0x26, 0x17, 0xcc,
+  0x09, 0x3e, 0x0a, 0x25, 0x01, 0x3e, 0x17, 0xfa, 0x09, 0x26, 0x0a, 0x01, 0x3e, 0x17, 0xcd, 0x26,
+  0x1a, 0x0a, 0x17, 0xfd, 0xd8, 0x3e, 0x2d, 0xc0, 0x3e, 0x17, 0xce, 0x09, 0x26, 0x0a, 0x25, 0x01,
+  0x3e, 0x09, 0x17, 0xf2, 0x09, 0x3e, 0x26, 0x0a, 0x01, 0x26, 0x09, 0x17, 0xce, 0x09, 0x1a, 0xc0,
+  0x09, 0x17, 0xfd, 0xd9, 0x26, 0x2d, 0x25, 0x09, 0x17, 0xd0, 0x09, 0x26, 0x01, 0x25, 0xc0, 0x26,
+  0x3e, 0x09, 0x17, 0xea, 0x09, 0x3e, 0x26, 0x0a, 0xc0, 0x01, 0x3e, 0x09, 0x17, 0xd0, 0x09, 0x0a,
+  0x1a, 0x3e, 0x17, 0xfd, 0xdb, 0x0a, 0x2d, 0x0a, 0x17, 0xd4, 0x09, 0x26, 0x01, 0x25, 0xc0, 0x01,
+  0x26, 0x3e, 0xc0, 0x17, 0xdf, 0x09, 0xc0, 0x3e, 0x26, 0x01, 0x0a, 0xc0, 0x26, 0xc0, 0x09, 0x17,
+  0xd4, 0x01, 0x1a, 0x01, 0x17, 0xfd, 0xdc, 0x09, 0x25, 0x2d, 0x26, 0x17, 0xd7, 0x09, 0x3e, 0x26,
+  0x01, 0x0a, 0x1a, 0x25, 0x01, 0xc0, 0x26, 0x3e, 0xc1, 0x09, 0xc1, 0x17, 0xcb, 0x09, 0xc1, 0x3e,
+  0xc0, 0x26, 0xc0, 0x01, 0x0a, 0x1a, 0x01, 0xc0, 0x3e, 0xc0, 0x09, 0x17, 0xd7, 0x26, 0x1a, 0x0a,
+  0x17, 0xfd, 0xde, 0x3e, 0x2d, 0xc0, 0x26, 0x17, 0xdc, 0x09, 0x3e, 0xc0, 0x26, 0xc0, 0x01, 0xc0,
+  0x0a, 0xc0, 0x1a, 0xc2, 0x0a, 0xc4, 0x1a, 0xc2, 0x0a, 0xc0, 0x01, 0xc0, 0x26, 0x3e, 0xc1, 0x09,
+  0x17, 0xdc, 0x3e, 0x1a, 0xc0, 0x09, 0x17, 0xfd, 0xdf, 0x3e, 0x2d, 0xc0, 0x3e, 0x17, 0xe5, 0x09,
+  0xc9, 0x17, 0xe6, 0x3e, 0x1a, 0xc0, 0x3e, 0x17, 0xfd, 0xe1, 0x26, 0x2d, 0x25, 0x3e, 0x17, 0xfd,
+  0xd8, 0x09, 0x0a, 0x1a, 0x3e, 0x17, 0xfd, 0xe3, 0x01, 0x2d, 0x25, 0x09, 0x17, 0xfd, 0xd6, 0x09,
+  0x0a, 0x1a, 0x26, 0x17, 0xfd, 0xe5, 0x01, 0x2d, 0x25, 0x3e, 0x17, 0xfd, 0xd4, 0x09, 0x0a, 0x1a,
+  0x26, 0x17, 0xfd, 0xe7, 0x01, 0x2d, 0x25, 0x3e, 0x17, 0xfd, 0xd2, 0x09, 0x0a, 0x1a, 0x26, 0x17,
+  0xfd, 0xe9, 0x01, 0x2d, 0x25, 0x3e, 0x17, 0xfd, 0xd0, 0x3e, 0x1a, 0xc0, 0x26, 0x17, 0xfd, 0xeb,
+  0x26, 0x2d, 0xc0, 0x26, 0x17, 0xfd, 0xce, 0x3e, 0x1a, 0xc0, 0x26, 0x17, 0xfd, 0xed, 0x26, 0x2d,
+  0xc0, 0x01, 0x17, 0xfd, 0xcc, 0x26, 0x1a, 0xc0, 0x3e, 0x17, 0xfd, 0xef, 0x3e, 0x25, 0x2d, 0x0a,
+  0x09, 0x17, 0xfd, 0xc8, 0x09, 0x01, 0x1a, 0x0a, 0x3e, 0x17, 0xfd, 0xf1, 0x09, 0x0a, 0x2d, 0x25,
+  0x3e, 0x17, 0xfd, 0xc6, 0x3e, 0x0a, 0x1a, 0x01, 0x09, 0x17, 0xfd, 0xf4, 0x01, 0x2d, 0xc0, 0x01,
+  0x09, 0x17, 0xfd, 0xc2, 0x09, 0x26, 0x1a, 0xc0, 0x26, 0x17, 0xfd, 0xf7, 0x3e, 0x25, 0x2d, 0x25,
+  0x3e, 0x17, 0xfd, 0xc0, 0x3e, 0x0a, 0x1a, 0x0a, 0x3e, 0x17, 0xfd, 0xf9, 0x09, 0x01, 0x25, 0x2d,
+  0x01, 0x09, 0x17, 0xfa, 0x09, 0x01, 0x1a, 0xc0, 0x26, 0x09, 0x17, 0xfd, 0xfc, 0x3e, 0x25, 0xc0,
+  0x2d, 0x26, 0x09, 0x17, 0xf6, 0x09, 0x26, 0x1a, 0xc0, 0x0a, 0x3e, 0x17, 0xfd, 0xfd, 0xc1, 0x09,
+  0x26, 0x25, 0x2d, 0x25, 0x26, 0x09, 0x17, 0xf3, 0x26, 0x1a, 0xc0, 0x0a, 0x26, 0x17, 0xfd, 0xfd,
+  0xc5, 0x09, 0x26, 0x2d, 0x25, 0xc0, 0x01, 0x09, 0x17, 0xee, 0x09, 0x26, 0x1a, 0xc1, 0x26, 0x09,
+  0x17, 0xfd, 0xfd, 0xc8, 0x09, 0x01, 0x25, 0xc1, 0x01, 0x3e, 0x17, 0xea, 0x3e, 0x01, 0x1a, 0xc1,
+  0x26, 0x09, 0x17, 0xfd, 0xfd, 0xcc, 0x09, 0x26, 0x25, 0xc1, 0x1a, 0x01, 0x09, 0x17, 0xe4, 0x09,
+  0x26, 0x0a, 0x1a, 0xc0, 0x0a, 0x26, 0x09, 0x17, 0xfd, 0xfd, 0xd1, 0x26, 0x0a, 0x25, 0x1a, 0x25,
+  0x0a, 0x26, 0x3e, 0x17, 0xde, 0x3e, 0x26, 0x0a, 0x1a, 0xc1, 0x01, 0x3e, 0x17, 0xfd, 0xfd, 0xd6,
+  0x09, 0x26, 0x0a, 0x25, 0x1a, 0x25, 0x1a, 0x0a, 0x26, 0x3e, 0x09, 0x17, 0xd4, 0x09, 0x3e, 0x26,
+  0x01, 0x1a, 0xc2, 0x0a, 0x3e, 0x09, 0x17, 0xfd, 0xfd, 0xdb, 0x09, 0x26, 0x01, 0x25, 0x1a, 0x25,
+  0x1a, 0xc1, 0x01, 0x26, 0xc0, 0x3e, 0xc0, 0x09, 0xc1, 0x17, 0x09, 0x17, 0x09, 0xc2, 0x3e, 0xc0,
+  0x26, 0xc0, 0x01, 0x1a, 0xc4, 0x01, 0x3e, 0x09, 0x17, 0xfd, 0xfd, 0xe2, 0x3e, 0x26, 0x01, 0x0a,
+  0x1a, 0xd4, 0x0a, 0x26, 0xc0, 0x09, 0x17, 0xfd, 0xfd, 0xea, 0x09, 0x3e, 0xc0, 0x26, 0xc0, 0x01,
+  0xc1, 0x0a, 0xc0, 0x1a, 0xc0, 0x0a, 0xc0, 0x01, 0xc0, 0x26, 0xc0, 0x3e, 0xc1, 0x17, 0xfd, 0xd7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
 };
 
 const lv_img_dsc_t kwartiwi_logo_240 = {
-  .header.cf = LV_IMG_CF_INDEXED_4BIT,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 194,
   .header.h = 127,
-  .data_size = 12383,
+  .data_size = 4744,
   .data = kwartiwi_logo_240_map,
 };
@@ -1,3 +1,5 @@
+/* Generated by tools/assets/gen_assets.py from src/reload_symbol_blue_20_20.png (indexed_2bit), do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,31 +24,14 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_RELOAD_SYMBOL_BLUE_20_20 uint8_t reload_symbol_blue_20_20_map[] = {
-  0xfe, 0xfd, 0xfc, 0xff, 	/*Color of index 0*/
-  0xf0, 0xce, 0xbb, 0xff, 	/*Color of index 1*/
-  0xe4, 0x9d, 0x69, 0xff, 	/*Color of index 2*/
-  0xe0, 0x85, 0x19, 0xff, 	/*Color of index 3*/
-
-  0x00, 0x05, 0xbe, 0x50, 0x1a, 
-  0x00, 0x6f, 0xff, 0xf9, 0x3f, 
-  0x01, 0xff, 0xff, 0xff, 0xbf, 
-  0x07, 0xff, 0xff, 0xff, 0xff, 
-  0x1f, 0xfe, 0x85, 0xff, 0xff, 
-  0x2f, 0xf4, 0x00, 0x2f, 0xff, 
-  0x7f, 0xd0, 0x00, 0xbf, 0xff, 
-  0x7f, 0xc0, 0x02, 0xff, 0xff, 
-  0xbf, 0x40, 0x01, 0x55, 0x55, 
-  0xff, 0x40, 0x00, 0x00, 0x00, 
-  0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xbf, 0x40, 0x00, 0x00, 0x54, 
-  0x7f, 0xc0, 0x00, 0x03, 0xfe, 
-  0x7f, 0xd0, 0x00, 0x07, 0xfd, 
-  0x2f, 0xf4, 0x00, 0x1f, 0xf8, 
-  0x1f, 0xff, 0x51, 0xff, 0xf4, 
-  0x07, 0xff, 0xff, 0xff, 0xd0, 
-  0x01, 0xff, 0xff, 0xff, 0x40, 
-  0x00, 0x6f, 0xff, 0xf9, 0x00, 
-  0x00, 0x05, 0xbe, 0x50, 0x00, 
+  0xfe, 0xfd, 0xfc, 0xff, 0xf0, 0xce, 0xbb, 0xff, 0xe4, 0x9d, 0x69, 0xff, 0xe0, 0x85, 0x19, 0xff,
+  0x00, 0x05, 0xbe, 0x50, 0x1a, 0x00, 0x6f, 0xff, 0xf9, 0x3f, 0x01, 0xff, 0xff, 0xff, 0xbf, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0x85, 0xff, 0xff, 0x2f, 0xf4, 0x00, 0x2f, 0xff, 0x7f, 0xd0,
+  0x00, 0xbf, 0xff, 0x7f, 0xc0, 0x02, 0xff, 0xff, 0xbf, 0x40, 0x01, 0x55, 0x55, 0xff, 0x40, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x00, 0x54, 0x7f, 0xc0, 0x00, 0x03,
+  0xfe, 0x7f, 0xd0, 0x00, 0x07, 0xfd, 0x2f, 0xf4, 0x00, 0x1f, 0xf8, 0x1f, 0xff, 0x51, 0xff, 0xf4,
+  0x07, 0xff, 0xff, 0xff, 0xd0, 0x01, 0xff, 0xff, 0xff, 0x40, 0x00, 0x6f, 0xff, 0xf9, 0x00, 0x00,
+  0x05, 0xbe, 0x50, 0x00,
 };
 
 const lv_img_dsc_t reload_symbol_blue_20_20 = {
@@ -1,15 +1,17 @@
+/* Generated by tools/assets/gen_assets.py from src/server_symbol_orange_50_50.png (indexed_2bit), do not edit */
+
 #ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
             #define LV_LVGL_H_INCLUDE_SIMPLE
         #endif
-#endif
+    #endif
 #endif
 
 #if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
+    #include "lvgl.h"
 #else
-#include "lvgl/lvgl.h"
+    #include "lvgl/lvgl.h"
 #endif
 
 
@@ -22,69 +24,56 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SERVER_SYMBOL_ORANGE_50_50 uint8_t server_symbol_orange_50_50_map[] = {
-        0xfb, 0xfd, 0xfe, 0xff, 	/*Color of index 0*/
-        0xa3, 0xd6, 0xf7, 0xff, 	/*Color of index 1*/
-        0x4f, 0xb0, 0xf0, 0xff, 	/*Color of index 2*/
-        0x0a, 0x92, 0xeb, 0xff, 	/*Color of index 3*/
-
-        0x00, 0x01, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x40, 0x00, 0x00, 0x00,
-        0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00,
-        0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00,
-        0x2f, 0xff, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xff, 0xf8, 0x00, 0x00, 0x00,
-        0x7f, 0xfd, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xf9, 0x00, 0x00, 0x00,
-        0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xf9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xff, 0xea, 0x55, 0x11, 0x11, 0x15, 0x6b, 0xff, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xff, 0xff, 0xfb, 0xaa, 0xae, 0xef, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xe1, 0x5a, 0xef, 0xff, 0xff, 0xfb, 0xa9, 0x47, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xe0, 0x01, 0x55, 0x55, 0x55, 0x55, 0x40, 0x07, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00,
-        0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00,
-        0xbf, 0xf9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfd, 0x00, 0x00, 0x00,
-        0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xef, 0xfd, 0x00, 0x00, 0x00,
-        0xff, 0xff, 0xff, 0xa9, 0x95, 0x55, 0xab, 0xbf, 0xff, 0xfd, 0x00, 0x00, 0x00,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-        0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0x00, 0x00, 0x00,
-        0xff, 0xe1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5b, 0xff, 0x90, 0x00, 0x00,
-        0xff, 0xe0, 0x01, 0xae, 0xff, 0xff, 0xba, 0x85, 0xbf, 0xff, 0xf9, 0x00, 0x00,
-        0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x80, 0x00,
-        0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xe0, 0x00,
-        0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-        0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x07, 0xff, 0xfa, 0x96, 0xbf, 0xfe, 0x00,
-        0xff, 0xff, 0xf5, 0x44, 0x00, 0x00, 0x1f, 0xff, 0xe5, 0xb8, 0x6f, 0xff, 0x40,
-        0xbf, 0xff, 0xff, 0xea, 0xaa, 0x9a, 0xaf, 0xff, 0xa6, 0xf9, 0x6f, 0xff, 0x80,
-        0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xfe, 0xff, 0xd0,
-        0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf9, 0xff, 0xf0,
-        0x7f, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xbf, 0xff, 0xf4, 0x7f, 0xf0,
-        0xbf, 0xf0, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xfe, 0x5b, 0xf9, 0x7f, 0xf0,
-        0xbf, 0xe0, 0x01, 0x55, 0x56, 0x65, 0xff, 0xff, 0xfe, 0x06, 0xff, 0xbf, 0xf0,
-        0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfd, 0x06, 0xff, 0xbf, 0xf0,
-        0xbf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0xfe, 0x47, 0xfa, 0xff, 0xf0,
-        0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xe4, 0xbf, 0xaf, 0xf4, 0xbf, 0xf0,
-        0x7f, 0xfa, 0x40, 0x00, 0x00, 0x00, 0x7f, 0xf5, 0xff, 0xff, 0xf9, 0xbf, 0xf0,
-        0x3f, 0xff, 0xba, 0x94, 0x00, 0x00, 0x7f, 0xfa, 0xff, 0xff, 0xf9, 0xbf, 0xe0,
-        0x2f, 0xff, 0xff, 0xfa, 0xaa, 0xaa, 0xff, 0xff, 0xa6, 0xf9, 0xa6, 0xff, 0xe0,
-        0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xf8, 0x1a, 0xff, 0xc0,
-        0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xa5, 0x6f, 0xff, 0x40,
-        0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-        0x00, 0x00, 0x16, 0xbf, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xe4, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xd4, 0x00, 0x00,
+  0xfb, 0xfd, 0xfe, 0xff, 0xa3, 0xd6, 0xf7, 0xff, 0x4f, 0xb0, 0xf0, 0xff, 0x0a, 0x92, 0xeb, 0xff,
+  0x00, 0x01, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfa, 0x40, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x90, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00,
+  0x00, 0x2f, 0xff, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x7f, 0xfd,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xf9, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6f, 0xfd, 0x00, 0x00, 0x00, 0xbf, 0xf9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x7f, 0xfd, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xea, 0x55, 0x11, 0x11, 0x15, 0x6b, 0xff, 0xfd, 0x00,
+  0x00, 0x00, 0xbf, 0xff, 0xff, 0xfb, 0xaa, 0xae, 0xef, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0xbf,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xab, 0xfd, 0x00, 0x00, 0x00, 0xbf, 0xe1, 0x5a, 0xef, 0xff, 0xff, 0xfb, 0xa9, 0x47, 0xfd,
+  0x00, 0x00, 0x00, 0xbf, 0xe0, 0x01, 0x55, 0x55, 0x55, 0x55, 0x40, 0x07, 0xfd, 0x00, 0x00, 0x00,
+  0xbf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0xbf, 0xf9, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xef,
+  0xfd, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa9, 0x95, 0x55, 0xab, 0xbf, 0xff, 0xfd, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfb, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xe1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfa,
+  0x5b, 0xff, 0x90, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xae, 0xff, 0xff, 0xba, 0x85, 0xbf, 0xff, 0xf9,
+  0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xe4, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x07,
+  0xff, 0xfa, 0x96, 0xbf, 0xfe, 0x00, 0xff, 0xff, 0xf5, 0x44, 0x00, 0x00, 0x1f, 0xff, 0xe5, 0xb8,
+  0x6f, 0xff, 0x40, 0xbf, 0xff, 0xff, 0xea, 0xaa, 0x9a, 0xaf, 0xff, 0xa6, 0xf9, 0x6f, 0xff, 0x80,
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xfe, 0xff, 0xd0, 0xbf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf9, 0xff, 0xf0, 0x7f, 0xea, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xe1, 0xbf, 0xff, 0xf4, 0x7f, 0xf0, 0xbf, 0xf0, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xfe,
+  0x5b, 0xf9, 0x7f, 0xf0, 0xbf, 0xe0, 0x01, 0x55, 0x56, 0x65, 0xff, 0xff, 0xfe, 0x06, 0xff, 0xbf,
+  0xf0, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfd, 0x06, 0xff, 0xbf, 0xf0, 0xbf, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0xfe, 0x47, 0xfa, 0xff, 0xf0, 0xbf, 0xf4, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xe4, 0xbf, 0xaf, 0xf4, 0xbf, 0xf0, 0x7f, 0xfa, 0x40, 0x00, 0x00, 0x00, 0x7f, 0xf5,
+  0xff, 0xff, 0xf9, 0xbf, 0xf0, 0x3f, 0xff, 0xba, 0x94, 0x00, 0x00, 0x7f, 0xfa, 0xff, 0xff, 0xf9,
+  0xbf, 0xe0, 0x2f, 0xff, 0xff, 0xfa, 0xaa, 0xaa, 0xff, 0xff, 0xa6, 0xf9, 0xa6, 0xff, 0xe0, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xf8, 0x1a, 0xff, 0xc0, 0x01, 0xbf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xea, 0xa5, 0x6f, 0xff, 0x40, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x16, 0xbf, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff,
+  0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xe4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xd4, 0x00, 0x00,
 };
 
 const lv_img_dsc_t server_symbol_orange_50_50 = {
-        .header.cf = LV_IMG_CF_INDEXED_2BIT,
-        .header.always_zero = 0,
-        .header.reserved = 0,
-        .header.w = 50,
-        .header.h = 50,
-        .data_size = 666,
-        .data = server_symbol_orange_50_50_map,
+  .header.cf = LV_IMG_CF_INDEXED_2BIT,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 50,
+  .header.h = 50,
+  .data_size = 666,
+  .data = server_symbol_orange_50_50_map,
 };
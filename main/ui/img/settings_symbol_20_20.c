@@ -1,3 +1,5 @@
+/* Generated by tools/assets/gen_assets.py from src/settings_symbol_20_20.png (indexed_2bit), do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -17,36 +19,19 @@
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
-#ifndef LV_ATTRIBUTE_IMG_SETTINGS_SYMBOL
-#define LV_ATTRIBUTE_IMG_SETTINGS_SYMBOL
+#ifndef LV_ATTRIBUTE_IMG_SETTINGS_SYMBOL_20_20
+#define LV_ATTRIBUTE_IMG_SETTINGS_SYMBOL_20_20
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SETTINGS_SYMBOL uint8_t settings_symbol_map[] = {
-  0xff, 0xff, 0xff, 0xff, 	/*Color of index 0*/
-  0x98, 0x98, 0x98, 0xff, 	/*Color of index 1*/
-  0x45, 0x45, 0x45, 0xff, 	/*Color of index 2*/
-  0x02, 0x02, 0x02, 0xff, 	/*Color of index 3*/
-
-  0xff, 0xff, 0x82, 0xff, 0xff, 
-  0xff, 0xff, 0x82, 0xff, 0xff, 
-  0xfe, 0xbf, 0x41, 0xfe, 0xbf, 
-  0xf8, 0x14, 0x00, 0x14, 0x2f, 
-  0xf8, 0x00, 0x00, 0x00, 0x2f, 
-  0xfd, 0x00, 0x00, 0x00, 0x7f, 
-  0xfd, 0x01, 0xae, 0x40, 0x7f, 
-  0xfc, 0x06, 0xff, 0xd0, 0x3f, 
-  0xa4, 0x0b, 0xff, 0xe0, 0x1a, 
-  0x00, 0x0f, 0xff, 0xf0, 0x00, 
-  0x00, 0x0b, 0xff, 0xe0, 0x00, 
-  0xa4, 0x0b, 0xff, 0xe0, 0x1a, 
-  0xfc, 0x07, 0xff, 0xd0, 0x3f, 
-  0xfd, 0x01, 0xba, 0x40, 0x7f, 
-  0xfd, 0x00, 0x00, 0x00, 0x7f, 
-  0xf8, 0x00, 0x00, 0x00, 0x2f, 
-  0xf8, 0x14, 0x00, 0x14, 0x2f, 
-  0xfe, 0xbf, 0x41, 0xfe, 0xbf, 
-  0xff, 0xff, 0x82, 0xff, 0xff, 
-  0xff, 0xff, 0x82, 0xff, 0xff, 
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SETTINGS_SYMBOL_20_20 uint8_t settings_symbol_20_20_map[] = {
+  0xff, 0xff, 0xff, 0xff, 0x98, 0x98, 0x98, 0xff, 0x45, 0x45, 0x45, 0xff, 0x02, 0x02, 0x02, 0xff,
+  0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xfe, 0xbf, 0x41, 0xfe, 0xbf, 0xf8,
+  0x14, 0x00, 0x14, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x2f, 0xfd, 0x00, 0x00, 0x00, 0x7f, 0xfd, 0x01,
+  0xae, 0x40, 0x7f, 0xfc, 0x06, 0xff, 0xd0, 0x3f, 0xa4, 0x0b, 0xff, 0xe0, 0x1a, 0x00, 0x0f, 0xff,
+  0xf0, 0x00, 0x00, 0x0b, 0xff, 0xe0, 0x00, 0xa4, 0x0b, 0xff, 0xe0, 0x1a, 0xfc, 0x07, 0xff, 0xd0,
+  0x3f, 0xfd, 0x01, 0xba, 0x40, 0x7f, 0xfd, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x2f,
+  0xf8, 0x14, 0x00, 0x14, 0x2f, 0xfe, 0xbf, 0x41, 0xfe, 0xbf, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff,
+  0xff, 0x82, 0xff, 0xff,
 };
 
 const lv_img_dsc_t settings_symbol_20_20 = {
@@ -56,5 +41,5 @@ const lv_img_dsc_t settings_symbol_20_20 = {
   .header.w = 20,
   .header.h = 20,
   .data_size = 116,
-  .data = settings_symbol_map,
+  .data = settings_symbol_20_20_map,
 };
@@ -1,5 +1,7 @@
+/* Generated by tools/assets/gen_assets.py from src/tp_cal_cross_img.png (indexed_1bit), do not edit */
+
 #ifdef __has_include
-#if __has_include("lvgl.h")
+    #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
             #define LV_LVGL_H_INCLUDE_SIMPLE
         #endif
@@ -7,9 +9,9 @@
 #endif
 
 #if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
+    #include "lvgl.h"
 #else
-#include "lvgl/lvgl.h"
+    #include "lvgl/lvgl.h"
 #endif
 
 
@@ -22,50 +24,25 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_CAL_CROSS uint8_t cal_cross_map[] = {
-0xff, 0xff, 0xff, 0xff, 	/*Color of index 0*/
-0x00, 0x00, 0x00, 0xff, 	/*Color of index 1*/
-
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0xff, 0xff, 0xff, 0xff, 0x80,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
 };
 
 const lv_img_dsc_t cal_cross = {
-        .header.cf = LV_IMG_CF_INDEXED_1BIT,
-        .header.always_zero = 0,
-        .header.reserved = 0,
-        .header.w = 33,
-        .header.h = 33,
-        .data_size = 173,
-        .data = cal_cross_map,
+  .header.cf = LV_IMG_CF_INDEXED_1BIT,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 33,
+  .header.h = 33,
+  .data_size = 173,
+  .data = cal_cross_map,
 };
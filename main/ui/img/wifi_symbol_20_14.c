@@ -1,3 +1,5 @@
+/* Generated by tools/assets/gen_assets.py from src/wifi_symbol_20_14.png (indexed_4bit), do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,35 +24,16 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_WIFI_SYMBOL_20_14 uint8_t wifi_symbol_20_14_map[] = {
-  0xfd, 0xfd, 0xfd, 0xff, 	/*Color of index 0*/
-  0xf5, 0xf5, 0xf5, 0xff, 	/*Color of index 1*/
-  0xeb, 0xeb, 0xeb, 0xff, 	/*Color of index 2*/
-  0xe4, 0xe4, 0xe4, 0xff, 	/*Color of index 3*/
-  0xdb, 0xdb, 0xdb, 0xff, 	/*Color of index 4*/
-  0xd3, 0xd3, 0xd3, 0xff, 	/*Color of index 5*/
-  0xc4, 0xc4, 0xc4, 0xff, 	/*Color of index 6*/
-  0xb0, 0xb0, 0xb0, 0xff, 	/*Color of index 7*/
-  0x9e, 0x9e, 0x9e, 0xff, 	/*Color of index 8*/
-  0x88, 0x88, 0x88, 0xff, 	/*Color of index 9*/
-  0x71, 0x71, 0x71, 0xff, 	/*Color of index 10*/
-  0x5c, 0x5c, 0x5c, 0xff, 	/*Color of index 11*/
-  0x53, 0x53, 0x53, 0xff, 	/*Color of index 12*/
-  0x47, 0x47, 0x47, 0xff, 	/*Color of index 13*/
-  0x09, 0x09, 0x09, 0xff, 	/*Color of index 14*/
-  0x00, 0x00, 0x00, 0xff, 	/*Color of index 15*/
-
-  0xff, 0xff, 0x40, 0x00, 0x02, 0x04, 0xff, 0xff, 
-  0xff, 0x50, 0x03, 0xdf, 0xfd, 0x40, 0x06, 0xff, 
-  0xf1, 0x04, 0xff, 0xff, 0xff, 0xff, 0x30, 0x2f, 
-  0x20, 0xcf, 0xe0, 0x00, 0x00, 0x2e, 0xfc, 0x02, 
-  0x09, 0xf8, 0x00, 0x9f, 0xf9, 0x00, 0x9f, 0x70, 
-  0xff, 0x60, 0x6f, 0xff, 0xff, 0xf6, 0x07, 0xff, 
-  0xff, 0x03, 0xfb, 0x00, 0x00, 0x8f, 0x30, 0xff, 
-  0xff, 0xff, 0x70, 0x2e, 0xe2, 0x08, 0xff, 0xff, 
-  0xff, 0xff, 0x02, 0xfb, 0xbf, 0x10, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xb0, 0x0d, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xa0, 0x0c, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff, 0xff, 0xff, 
+  0xfd, 0xfd, 0xfd, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe4, 0xe4, 0xe4, 0xff,
+  0xdb, 0xdb, 0xdb, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xb0, 0xb0, 0xb0, 0xff,
+  0x9e, 0x9e, 0x9e, 0xff, 0x88, 0x88, 0x88, 0xff, 0x71, 0x71, 0x71, 0xff, 0x5c, 0x5c, 0x5c, 0xff,
+  0x53, 0x53, 0x53, 0xff, 0x47, 0x47, 0x47, 0xff, 0x09, 0x09, 0x09, 0xff, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0x40, 0x00, 0x02, 0x04, 0xff, 0xff, 0xff, 0x50, 0x03, 0xdf, 0xfd, 0x40, 0x06, 0xff,
+  0xf1, 0x04, 0xff, 0xff, 0xff, 0xff, 0x30, 0x2f, 0x20, 0xcf, 0xe0, 0x00, 0x00, 0x2e, 0xfc, 0x02,
+  0x09, 0xf8, 0x00, 0x9f, 0xf9, 0x00, 0x9f, 0x70, 0xff, 0x60, 0x6f, 0xff, 0xff, 0xf6, 0x07, 0xff,
+  0xff, 0x03, 0xfb, 0x00, 0x00, 0x8f, 0x30, 0xff, 0xff, 0xff, 0x70, 0x2e, 0xe2, 0x08, 0xff, 0xff,
+  0xff, 0xff, 0x02, 0xfb, 0xbf, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0d, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xa0, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff, 0xff, 0xff,
 };
 
 const lv_img_dsc_t wifi_symbol_20_14 = {
@@ -1,15 +1,17 @@
+/* Generated by tools/assets/gen_assets.py from src/wifi_symbol_nc_20_14.png (indexed_4bit), do not edit */
+
 #ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
             #define LV_LVGL_H_INCLUDE_SIMPLE
         #endif
-#endif
+    #endif
 #endif
 
 #if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
+    #include "lvgl.h"
 #else
-#include "lvgl/lvgl.h"
+    #include "lvgl/lvgl.h"
 #endif
 
 
@@ -22,43 +24,24 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_WIFI_SYMBOL_NC_20_14 uint8_t wifi_symbol_nc_20_14_map[] = {
-        0xfd, 0xfd, 0xfd, 0xff, 	/*Color of index 0*/
-        0xe5, 0xe5, 0xe5, 0xff, 	/*Color of index 1*/
-        0xc4, 0xc4, 0xc4, 0xff, 	/*Color of index 2*/
-        0xb0, 0xb0, 0xb0, 0xff, 	/*Color of index 3*/
-        0x8a, 0x8a, 0x8a, 0xff, 	/*Color of index 4*/
-        0x71, 0x71, 0x71, 0xff, 	/*Color of index 5*/
-        0x58, 0x58, 0x58, 0xff, 	/*Color of index 6*/
-        0x00, 0x00, 0x00, 0xff, 	/*Color of index 7*/
-        0x80, 0x8e, 0xef, 0xff, 	/*Color of index 8*/
-        0x9d, 0x9d, 0xa0, 0xff, 	/*Color of index 9*/
-        0x39, 0x5b, 0xeb, 0xff, 	/*Color of index 10*/
-        0x0d, 0x4a, 0xe9, 0xff, 	/*Color of index 11*/
-        0x0a, 0x3f, 0xca, 0xff, 	/*Color of index 12*/
-        0x47, 0x47, 0x48, 0xff, 	/*Color of index 13*/
-        0x03, 0x25, 0x81, 0xff, 	/*Color of index 14*/
-        0x01, 0x07, 0x2a, 0xff, 	/*Color of index 15*/
-
-        0xbc, 0xf7, 0x10, 0x00, 0x01, 0x01, 0x77, 0x77,
-        0xeb, 0xb0, 0x01, 0xd7, 0x7d, 0x10, 0x02, 0x77,
-        0x70, 0xab, 0xef, 0x77, 0x77, 0x77, 0x10, 0x17,
-        0x10, 0xdc, 0xb8, 0x00, 0x00, 0x17, 0x76, 0x01,
-        0x04, 0x79, 0x0b, 0xbf, 0x74, 0x00, 0x47, 0x30,
-        0x77, 0x20, 0x2f, 0xbb, 0xef, 0x72, 0x03, 0x77,
-        0x77, 0x01, 0x76, 0x08, 0xba, 0x97, 0x10, 0x77,
-        0x77, 0x77, 0x30, 0x1f, 0xfb, 0xb9, 0x77, 0x77,
-        0x77, 0x77, 0x01, 0x76, 0x6f, 0xab, 0xe7, 0x77,
-        0x77, 0x77, 0x77, 0x60, 0x0d, 0xfc, 0xbb, 0xf7,
-        0x77, 0x77, 0x77, 0x50, 0x06, 0x77, 0xfb, 0xbf,
-        0x77, 0x77, 0x77, 0x7d, 0x67, 0x77, 0x7f, 0xbb,
+  0xfd, 0xfd, 0xfd, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xb0, 0xb0, 0xb0, 0xff,
+  0x8a, 0x8a, 0x8a, 0xff, 0x71, 0x71, 0x71, 0xff, 0x58, 0x58, 0x58, 0xff, 0x00, 0x00, 0x00, 0xff,
+  0x80, 0x8e, 0xef, 0xff, 0x9d, 0x9d, 0xa0, 0xff, 0x39, 0x5b, 0xeb, 0xff, 0x0d, 0x4a, 0xe9, 0xff,
+  0x0a, 0x3f, 0xca, 0xff, 0x47, 0x47, 0x48, 0xff, 0x03, 0x25, 0x81, 0xff, 0x01, 0x07, 0x2a, 0xff,
+  0xbc, 0xf7, 0x10, 0x00, 0x01, 0x01, 0x77, 0x77, 0xeb, 0xb0, 0x01, 0xd7, 0x7d, 0x10, 0x02, 0x77,
+  0x70, 0xab, 0xef, 0x77, 0x77, 0x77, 0x10, 0x17, 0x10, 0xdc, 0xb8, 0x00, 0x00, 0x17, 0x76, 0x01,
+  0x04, 0x79, 0x0b, 0xbf, 0x74, 0x00, 0x47, 0x30, 0x77, 0x20, 0x2f, 0xbb, 0xef, 0x72, 0x03, 0x77,
+  0x77, 0x01, 0x76, 0x08, 0xba, 0x97, 0x10, 0x77, 0x77, 0x77, 0x30, 0x1f, 0xfb, 0xb9, 0x77, 0x77,
+  0x77, 0x77, 0x01, 0x76, 0x6f, 0xab, 0xe7, 0x77, 0x77, 0x77, 0x77, 0x60, 0x0d, 0xfc, 0xbb, 0xf7,
+  0x77, 0x77, 0x77, 0x50, 0x06, 0x77, 0xfb, 0xbf, 0x77, 0x77, 0x77, 0x7d, 0x67, 0x77, 0x7f, 0xbb,
 };
 
 const lv_img_dsc_t wifi_symbol_nc_20_14 = {
-        .header.cf = LV_IMG_CF_INDEXED_4BIT,
-        .header.always_zero = 0,
-        .header.reserved = 0,
-        .header.w = 16,
-        .header.h = 12,
-        .data_size = 160,
-        .data = wifi_symbol_nc_20_14_map,
+  .header.cf = LV_IMG_CF_INDEXED_4BIT,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 16,
+  .header.h = 12,
+  .data_size = 160,
+  .data = wifi_symbol_nc_20_14_map,
 };
@@ -1,3 +1,5 @@
+/* Generated by tools/assets/gen_assets.py from src/wifi_symbol_orange_50_50.png (indexed_2bit), do not edit */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,61 +24,48 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_WIFI_SYMBOL_ORANGE_50_50 uint8_t wifi_symbol_orange_50_50_map[] = {
-  0xfd, 0xfd, 0xfe, 0xff, 	/*Color of index 0*/
-  0xb3, 0xcc, 0xf4, 0xff, 	/*Color of index 1*/
-  0x54, 0x9f, 0xed, 0xff, 	/*Color of index 2*/
-  0x07, 0x91, 0xec, 0xff, 	/*Color of index 3*/
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x05, 0x6a, 0xfa, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0xbf, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x00, 0x00, 
-  0x00, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 
-  0x00, 0x2f, 0xff, 0xff, 0xbe, 0xfe, 0xab, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 
-  0x00, 0xaf, 0xff, 0xf9, 0x40, 0x00, 0x00, 0x15, 0xbf, 0xff, 0xff, 0xd0, 0x00, 
-  0x06, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xff, 0xf8, 0x00, 
-  0x0b, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xfe, 0x00, 
-  0x1f, 0xff, 0xe8, 0x00, 0x05, 0xff, 0xfd, 0x54, 0x00, 0x01, 0xbf, 0xff, 0x40, 
-  0x3f, 0xff, 0xe0, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x2f, 0xff, 0xc0, 
-  0x3f, 0xff, 0x40, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x06, 0xff, 0xd0, 
-  0x3f, 0xf9, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x01, 0xff, 0xc0, 
-  0x3f, 0xe4, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x6f, 0xc0, 
-  0x0f, 0xd0, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1f, 0x00, 
-  0x01, 0x00, 0x2f, 0xff, 0xff, 0x95, 0x55, 0xaf, 0xff, 0xff, 0xd0, 0x00, 0x00, 
-  0x00, 0x00, 0xbf, 0xff, 0xe0, 0x00, 0x00, 0x05, 0xbf, 0xff, 0xf4, 0x00, 0x00, 
-  0x00, 0x02, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xfc, 0x00, 0x00, 
-  0x00, 0x07, 0xff, 0xe4, 0x00, 0x00, 0x40, 0x00, 0x02, 0xbf, 0xfc, 0x00, 0x00, 
-  0x00, 0x03, 0xfe, 0x80, 0x01, 0xbf, 0xfe, 0x94, 0x00, 0x6f, 0xfc, 0x00, 0x00, 
-  0x00, 0x01, 0xfd, 0x00, 0x1b, 0xff, 0xff, 0xfe, 0x40, 0x1a, 0xf0, 0x00, 0x00, 
-  0x00, 0x00, 0x54, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xa0, 0x01, 0xa0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xe5, 0x56, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0xf9, 0x00, 0x00, 0x6f, 0xff, 0xd0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x07, 0xf4, 0x00, 0x00, 0x05, 0xbe, 0x40, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x10, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xfd, 0xfd, 0xfe, 0xff, 0xb3, 0xcc, 0xf4, 0xff, 0x54, 0x9f, 0xed, 0xff, 0x07, 0x91, 0xec, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x6a, 0xfa, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xbf,
+  0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaf, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,
+  0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00,
+  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff,
+  0xbe, 0xfe, 0xab, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0xaf, 0xff, 0xf9, 0x40, 0x00, 0x00,
+  0x15, 0xbf, 0xff, 0xff, 0xd0, 0x00, 0x06, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbf,
+  0xff, 0xf8, 0x00, 0x0b, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xfe, 0x00,
+  0x1f, 0xff, 0xe8, 0x00, 0x05, 0xff, 0xfd, 0x54, 0x00, 0x01, 0xbf, 0xff, 0x40, 0x3f, 0xff, 0xe0,
+  0x00, 0xaf, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x2f, 0xff, 0xc0, 0x3f, 0xff, 0x40, 0x07, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0x00, 0x06, 0xff, 0xd0, 0x3f, 0xf9, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd0, 0x01, 0xff, 0xc0, 0x3f, 0xe4, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x6f,
+  0xc0, 0x0f, 0xd0, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1f, 0x00, 0x01, 0x00,
+  0x2f, 0xff, 0xff, 0x95, 0x55, 0xaf, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xe0,
+  0x00, 0x00, 0x05, 0xbf, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe4, 0x00, 0x00, 0x40, 0x00, 0x02, 0xbf, 0xfc,
+  0x00, 0x00, 0x00, 0x03, 0xfe, 0x80, 0x01, 0xbf, 0xfe, 0x94, 0x00, 0x6f, 0xfc, 0x00, 0x00, 0x00,
+  0x01, 0xfd, 0x00, 0x1b, 0xff, 0xff, 0xfe, 0x40, 0x1a, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
+  0x6f, 0xff, 0xff, 0xff, 0xa0, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff,
+  0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xff, 0xe5, 0x56, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0xf9, 0x00, 0x00, 0x6f, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf4, 0x00,
+  0x00, 0x05, 0xbe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x10, 0x00, 0x54,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 const lv_img_dsc_t wifi_symbol_orange_50_50 = {
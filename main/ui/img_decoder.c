@@ -0,0 +1,290 @@
+/**
+ * @file img_decoder.c
+ * @brief LVGL image decoder for the compressed images of the asset pipeline
+ *
+ * tools/assets/gen_assets.py can store large, rarely drawn images compressed (rle or qoi format) to save flash.
+ * These images are LV_IMG_CF_RAW_ALPHA descriptors, of which the data starts with the magic of the format.
+ * The decoder decodes the whole image into a LV_IMG_CF_TRUE_COLOR_ALPHA buffer when it is opened,
+ * LVGL keeps it in the image cache (CONFIG_LV_IMG_CACHE_DEF_SIZE, 1 entry) until another decoded image replaces it,
+ * or until the image is invalidated with lv_img_cache_invalidate_src().
+ * The decode time is logged at info level, gen_assets.py --device-log adds it to the asset report.
+ *
+ * Formats:
+ *   - rle: "RLE1", followed by packets. A control byte with bit 7 set is a run of (n & 0x7F) + 1 times the next pixel,
+ *          otherwise (n + 1) literal pixels follow. The pixels are in the LV_IMG_CF_TRUE_COLOR_ALPHA byte order.
+ *   - qoi: The QOI format (https://qoiformat.org), RGBA
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "img_decoder.h"
+
+#define RLE_MAGIC "RLE1"
+#define RLE_RUN_FLAG 0x80
+#define QOI_MAGIC "qoif"
+#define QOI_HEADER_SIZE 14
+#define QOI_END_MARKER_SIZE 8
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF 0x40
+#define QOI_OP_LUMA 0x80
+#define QOI_OP_RUN 0xC0
+#define QOI_OP_RGB 0xFE
+#define QOI_OP_RGBA 0xFF
+#define QOI_MASK_2 0xC0
+#define MAGIC_SIZE 4
+
+typedef enum {
+    IMG_FORMAT_NONE,
+    IMG_FORMAT_RLE,
+    IMG_FORMAT_QOI,
+} img_format_t;
+
+static const char * TAG = "img_decoder";
+
+// Function prototypes
+static img_format_t get_format(const void * src);
+static lv_res_t info_cb(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t open_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static void close_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static bool decode_rle(const uint8_t * src, uint32_t src_size, uint8_t * dst, uint32_t px_count);
+static bool decode_qoi(const uint8_t * src, uint32_t src_size, uint8_t * dst, uint32_t px_count);
+static void write_pixel(uint8_t * dst, const uint8_t rgba[4]);
+
+/**
+ * @brief Register the decoder for the compressed images
+ *
+ * @note Must be called after lv_init(), before a compressed image is shown
+ */
+void img_decoder_init(void) {
+    lv_img_decoder_t * decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, info_cb);
+    lv_img_decoder_set_open_cb(decoder, open_cb);
+    lv_img_decoder_set_close_cb(decoder, close_cb);
+}
+
+/**
+ * @brief Get the compression format of an image
+ *
+ * @param[in] src The image source
+ * @return The format, IMG_FORMAT_NONE if the image is not compressed by the asset pipeline
+ */
+static img_format_t get_format(const void * src) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        return IMG_FORMAT_NONE;
+    }
+
+    const lv_img_dsc_t * img = src;
+    if (img->header.cf != LV_IMG_CF_RAW_ALPHA || img->data_size < MAGIC_SIZE) {
+        return IMG_FORMAT_NONE;
+    }
+    if (memcmp(img->data, RLE_MAGIC, MAGIC_SIZE) == 0) {
+        return IMG_FORMAT_RLE;
+    }
+    if (memcmp(img->data, QOI_MAGIC, MAGIC_SIZE) == 0) {
+        return IMG_FORMAT_QOI;
+    }
+    return IMG_FORMAT_NONE;
+}
+
+/**
+ * @brief LVGL decoder info callback, get the header of a compressed image
+ *
+ * @param[in] decoder unused
+ * @param[in] src The image source
+ * @param[out] header The header of the decoded image
+ * @return LV_RES_OK if the image is handled by this decoder
+ */
+static lv_res_t info_cb(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header) {
+    if (get_format(src) == IMG_FORMAT_NONE) {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t * img = src;
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief LVGL decoder open callback, decode the whole image
+ *
+ * @param[in] decoder unused
+ * @param[in, out] dsc The decoder descriptor, img_data is set to the decoded image
+ * @return LV_RES_OK on success
+ */
+static lv_res_t open_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc) {
+    img_format_t format = get_format(dsc->src);
+    if (format == IMG_FORMAT_NONE) {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t * img = dsc->src;
+    uint32_t px_count = (uint32_t)img->header.w * img->header.h;
+    uint8_t * buf = ui_alloc_large(px_count * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    if (buf == NULL) {
+        UI_LOGE(TAG, "Could not allocate %lu bytes to decode an image", (unsigned long)(px_count * LV_IMG_PX_SIZE_ALPHA_BYTE));
+        return LV_RES_INV;
+    }
+
+    uint32_t start = lv_tick_get();
+    bool ok = format == IMG_FORMAT_RLE ? decode_rle(img->data, img->data_size, buf, px_count)
+                                       : decode_qoi(img->data, img->data_size, buf, px_count);
+    if (!ok) {
+        UI_LOGE(TAG, "Corrupt %s image", format == IMG_FORMAT_RLE ? "rle" : "qoi");
+        ui_free_large(buf);
+        return LV_RES_INV;
+    }
+    UI_LOGI(TAG, "Decoded %s image %dx%d (%lu bytes) in %lu ms", format == IMG_FORMAT_RLE ? "rle" : "qoi",
+            img->header.w, img->header.h, (unsigned long)img->data_size, (unsigned long)lv_tick_elaps(start));
+
+    dsc->img_data = buf;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief LVGL decoder close callback, free the decoded image
+ *
+ * @param[in] decoder unused
+ * @param[in, out] dsc The decoder descriptor
+ */
+static void close_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc) {
+    ui_free_large((void *)dsc->img_data);
+    dsc->img_data = NULL;
+}
+
+/**
+ * @brief Decode a rle image
+ *
+ * @param[in] src The rle data, including the magic
+ * @param[in] src_size The size of the rle data
+ * @param[out] dst The decoded image, LV_IMG_CF_TRUE_COLOR_ALPHA
+ * @param[in] px_count The number of pixels of the image
+ * @return true if the data decoded to exactly px_count pixels
+ */
+static bool decode_rle(const uint8_t * src, uint32_t src_size, uint8_t * dst, uint32_t px_count) {
+    const uint8_t * end = src + src_size;
+    const uint8_t * dst_end = dst + px_count * LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    src += MAGIC_SIZE;
+    while (src < end) {
+        uint8_t control = *src++;
+        uint32_t count = (control & ~RLE_RUN_FLAG) + 1;
+        uint32_t size = count * LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+        if (dst + size > dst_end) {
+            return false;
+        }
+        if (control & RLE_RUN_FLAG) {
+            if (end - src < LV_IMG_PX_SIZE_ALPHA_BYTE) {
+                return false;
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                memcpy(dst, src, LV_IMG_PX_SIZE_ALPHA_BYTE);
+                dst += LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+            src += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+        else {
+            if ((uint32_t)(end - src) < size) {
+                return false;
+            }
+            memcpy(dst, src, size);
+            dst += size;
+            src += size;
+        }
+    }
+
+    return dst == dst_end;
+}
+
+/**
+ * @brief Decode a QOI image
+ *
+ * @param[in] src The QOI data, including the header
+ * @param[in] src_size The size of the QOI data
+ * @param[out] dst The decoded image, LV_IMG_CF_TRUE_COLOR_ALPHA
+ * @param[in] px_count The number of pixels of the image
+ * @return true if the data contains px_count pixels
+ */
+static bool decode_qoi(const uint8_t * src, uint32_t src_size, uint8_t * dst, uint32_t px_count) {
+    uint8_t index[64][4];
+    uint8_t px[4] = {0, 0, 0, 255};
+    uint32_t run = 0;
+
+    if (src_size < QOI_HEADER_SIZE + QOI_END_MARKER_SIZE) {
+        return false;
+    }
+    const uint8_t * end = src + src_size - QOI_END_MARKER_SIZE;
+    src += QOI_HEADER_SIZE;
+    memset(index, 0, sizeof(index));
+
+    for (uint32_t n = 0; n < px_count; n++) {
+        if (run > 0) {
+            run--;
+        }
+        else {
+            if (src >= end) {
+                return false;
+            }
+            uint8_t b1 = *src++;
+            if (b1 == QOI_OP_RGB) {
+                if (end - src < 3) {
+                    return false;
+                }
+                memcpy(px, src, 3);
+                src += 3;
+            }
+            else if (b1 == QOI_OP_RGBA) {
+                if (end - src < 4) {
+                    return false;
+                }
+                memcpy(px, src, 4);
+                src += 4;
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+                memcpy(px, index[b1], 4);
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+                px[0] += ((b1 >> 4) & 0x03) - 2;
+                px[1] += ((b1 >> 2) & 0x03) - 2;
+                px[2] += (b1 & 0x03) - 2;
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+                if (src >= end) {
+                    return false;
+                }
+                uint8_t b2 = *src++;
+                int vg = (b1 & 0x3F) - 32;
+                px[0] += vg - 8 + ((b2 >> 4) & 0x0F);
+                px[1] += vg;
+                px[2] += vg - 8 + (b2 & 0x0F);
+            }
+            else {
+                run = b1 & 0x3F;
+            }
+            memcpy(index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64], px, 4);
+        }
+
+        write_pixel(dst, px);
+        dst += LV_IMG_PX_SIZE_ALPHA_BYTE;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Write a RGBA pixel in the LV_IMG_CF_TRUE_COLOR_ALPHA format
+ *
+ * @param[out] dst The destination pixel
+ * @param[in] rgba The pixel
+ */
+static void write_pixel(uint8_t * dst, const uint8_t rgba[4]) {
+    lv_color_t color = lv_color_make(rgba[0], rgba[1], rgba[2]);
+
+    memcpy(dst, &color, sizeof(lv_color_t));
+    dst[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = rgba[3];
+}
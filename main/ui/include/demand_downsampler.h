@@ -0,0 +1,32 @@
+#ifndef DEMAND_DOWNSAMPLER_H
+#define DEMAND_DOWNSAMPLER_H
+
+#include <time.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define DEMAND_DOWNSAMPLER_MAX_COLUMNS 240
+#define DEMAND_DOWNSAMPLER_NO_VALUE UINT16_MAX  // Value of a column without data
+
+typedef enum {
+    DEMAND_DOWNSAMPLER_UPDATED,     // Columns of the current period changed
+    DEMAND_DOWNSAMPLER_NEW_PERIOD,  // The sample started a new period, all columns were cleared first
+    DEMAND_DOWNSAMPLER_IGNORED,     // The sample is older than the current period, or in a finished period
+} demand_downsampler_result_t;
+
+typedef struct {
+    uint16_t column_count;
+    uint16_t seconds_per_column;
+    time_t period_start;            // Start of the period shown in the columns, 0 if empty
+    time_t finished_period_start;   // Start of the newest finished period, kept by a reset, 0 if none
+    int16_t last_column;            // Column of the newest sample, -1 if empty
+    uint16_t values[DEMAND_DOWNSAMPLER_MAX_COLUMNS];
+} demand_downsampler_t;
+
+// Function prototypes
+void demand_downsampler_init(demand_downsampler_t *ds, uint16_t column_count, uint16_t seconds_per_column);
+void demand_downsampler_reset(demand_downsampler_t *ds);
+void demand_downsampler_finish_period(demand_downsampler_t *ds);
+demand_downsampler_result_t demand_downsampler_add(demand_downsampler_t *ds, time_t time, uint16_t value, uint16_t *first_changed, uint16_t *last_changed);
+
+#endif //DEMAND_DOWNSAMPLER_H
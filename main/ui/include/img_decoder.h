@@ -0,0 +1,7 @@
+#ifndef IMG_DECODER_H
+#define IMG_DECODER_H
+
+// Function prototypes
+void img_decoder_init(void);
+
+#endif //IMG_DECODER_H
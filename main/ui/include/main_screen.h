@@ -6,6 +6,11 @@
 #include <stdint.h>
 
 
+typedef struct {
+    time_t time;
+    uint16_t value;     // Watt
+} ui_demand_point_t;
+
 extern lv_obj_t * main_screen;
 extern bool main_screen_initialized;
 
@@ -17,7 +22,9 @@ void ui_set_max_peak_line(uint16_t value);
 void ui_set_new_max_peak_demand(uint16_t value);
 void ui_reset_peak_demand_chart_data(void);
 void ui_add_peak_demand_data_point(time_t time, uint16_t value);
+void ui_set_peak_demand_chart_history(const ui_demand_point_t points[], uint16_t count);
 void ui_set_predicted_peak(uint16_t value);
+void ui_set_energy_bucket(time_t start, uint16_t value);
 void ui_set_wifi_status(bool connected);
 void ui_set_connected_status(bool connected);
 
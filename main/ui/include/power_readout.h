@@ -0,0 +1,23 @@
+#ifndef POWER_READOUT_H
+#define POWER_READOUT_H
+
+#include <stdbool.h>
+#include "lvgl.h"
+
+#define POWER_READOUT_MAX_CHARS 8   // Max length of the number
+
+typedef enum {
+    POWER_READOUT_UNIT_W,
+    POWER_READOUT_UNIT_KW,
+    POWER_READOUT_UNIT_COUNT,
+} power_readout_unit_t;
+
+// Function prototypes
+lv_obj_t * power_readout_create(lv_obj_t * parent, lv_color_t color, lv_color_t alarm_color, lv_color_t bg_color);
+void power_readout_set_value(const char * number, power_readout_unit_t unit);
+void power_readout_set_alarm(bool alarm);
+#if SIMULATOR
+void power_readout_show_labels(bool show);
+#endif
+
+#endif //POWER_READOUT_H
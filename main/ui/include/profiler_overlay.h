@@ -0,0 +1,34 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#define UI_FRAME_STATS_CPU_COUNT 2          // Number of CPU cores of which the load is shown
+#define UI_FRAME_STATS_CPU_LOAD_UNKNOWN 0xFF    // CPU load when the run time statistics are not enabled
+#define UI_DEMAND_UNKNOWN 0xFFFF                // Demand of ui_demand_comparison_t that is not available
+
+typedef struct {
+    uint16_t fps_x10;           // Frames per second, times 10
+    uint32_t render_us;         // Average time per frame spent rendering
+    uint32_t flush_us;          // Average time per frame spent transferring to the display (runs in parallel with rendering)
+    uint32_t wait_us;           // Average time per frame LVGL waited for a transfer or the TE signal
+    uint16_t areas;             // Average number of invalidated areas per frame
+    uint32_t flush_bytes;       // Average number of bytes sent to the display per frame
+    uint8_t cpu_load[UI_FRAME_STATS_CPU_COUNT];    // Load of each core in percent
+} ui_frame_stats_t;
+
+typedef struct {
+    uint16_t local_avg_w;           // Average demand of the quarter-hour, calculated on the device
+    uint16_t server_avg_w;          // Average demand of the quarter-hour, from the server or the meter
+    uint16_t local_predicted_w;     // Predicted peak, calculated on the device
+    uint16_t server_predicted_w;    // Predicted peak, from the server
+} ui_demand_comparison_t;
+
+// Function prototypes
+void profiler_overlay_create(lv_obj_t * parent);
+void ui_set_frame_stats(const ui_frame_stats_t * stats);
+void ui_set_demand_comparison(const ui_demand_comparison_t * demand);
+void ui_toggle_profiler_overlay(void);
+
+#endif //PROFILER_OVERLAY_H
@@ -0,0 +1,40 @@
+#ifndef THEME_H
+#define THEME_H
+
+#include "lvgl.h"
+
+// Colors of the dark main screen
+#define THEME_COLOR_DARK_BG lv_color_hex(0x000000)
+#define THEME_COLOR_DARK_TEXT COLOR_WHITE
+#define THEME_COLOR_ALARM COLOR_KWARTIWI_RED
+
+// Objects in this state are shown in the alarm color (theme_style_text_alarm), set it with lv_obj_add_state()
+#define THEME_STATE_ALARM LV_STATE_USER_1
+
+// Screens
+extern lv_style_t theme_style_screen_dark;          // Black background (main screen)
+extern lv_style_t theme_style_screen_light;         // White background (loading, setup and calibration screens)
+
+// Text
+extern lv_style_t theme_style_text_small;           // montserrat_12
+extern lv_style_t theme_style_text_medium;          // montserrat_14
+extern lv_style_t theme_style_text_large;           // montserrat_20
+extern lv_style_t theme_style_text_center;
+extern lv_style_t theme_style_text_light;           // White text, on the dark screen
+extern lv_style_t theme_style_text_accent;          // Orange text
+extern lv_style_t theme_style_text_highlight;       // Blue text
+extern lv_style_t theme_style_text_alarm;           // Red text, add it with THEME_STATE_ALARM to show it only in the alarm state
+
+// Widgets
+extern lv_style_t theme_style_transparent;          // No background, border, outline and shadow
+extern lv_style_t theme_style_focus_border;         // Border of focused buttons, add it with LV_STATE_FOCUSED
+extern lv_style_t theme_style_spinner;
+extern lv_style_t theme_style_progress_bar;
+extern lv_style_t theme_style_progress_bar_indicator;
+extern lv_style_t theme_style_roller_selected;
+extern lv_style_t theme_style_overlay;              // Translucent background of the profiler overlay
+
+// Function prototypes
+void theme_init(void);
+
+#endif //THEME_H
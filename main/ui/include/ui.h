@@ -4,6 +4,7 @@
 #include <time.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 typedef enum {
     UI_OK,
@@ -30,6 +31,9 @@ typedef struct {
 #include "main_screen.h"
 #include "loading_screen.h"
 #include "setup_screen.h"
+#include "profiler_overlay.h"
+#include "tp_cal_screen.h"
+#include "theme.h"
 
 #define COLOR_KWARTIWI_RED lv_color_hex(0xEB440E)
 #define COLOR_KWARTIWI_ORANGE lv_color_hex(0xEC9106)
@@ -38,27 +42,41 @@ typedef struct {
 #define COLOR_KWARTIWI_BLUE lv_color_hex(0x623CEA)
 #define COLOR_WHITE lv_color_hex(0xFFFFFF)
 
+// Set to 1 by the host simulator build (simulator/CMakeLists.txt)
+#ifndef SIMULATOR
 #define SIMULATOR 0
+#endif
 
 #if SIMULATOR
 
 #include <stdio.h>
+#include "sim_hal.h"
+
+// Debug and verbose messages are only printed with SIMULATOR_VERBOSE, to keep the benchmark output readable
+#ifdef SIMULATOR_VERBOSE
+#define UI_SIM_VERBOSE 1
+#else
+#define UI_SIM_VERBOSE 0
+#endif
 
-#define UI_LOGV(TAG, format, ...) printf("[V] " TAG ": " format "\n", ##__VA_ARGS__)
-#define UI_LOGI(TAG, format, ...) printf("[I] " TAG ": " format "\n", ##__VA_ARGS__)
-#define UI_LOGD(TAG, format, ...) printf("[D] " TAG ": " format "\n", ##__VA_ARGS__)
-#define UI_LOGW(TAG, format, ...) printf("[W] " TAG ": " format "\n", ##__VA_ARGS__)
-#define UI_LOGE(TAG, format, ...) printf("[E] " TAG ": " format "\n", ##__VA_ARGS__)
+#define UI_LOGV(TAG, format, ...) do { if (UI_SIM_VERBOSE) printf("[V] %s: " format "\n", TAG, ##__VA_ARGS__); } while (0)
+#define UI_LOGI(TAG, format, ...) printf("[I] %s: " format "\n", TAG, ##__VA_ARGS__)
+#define UI_LOGD(TAG, format, ...) do { if (UI_SIM_VERBOSE) printf("[D] %s: " format "\n", TAG, ##__VA_ARGS__); } while (0)
+#define UI_LOGW(TAG, format, ...) printf("[W] %s: " format "\n", TAG, ##__VA_ARGS__)
+#define UI_LOGE(TAG, format, ...) printf("[E] %s: " format "\n", TAG, ##__VA_ARGS__)
 
 #else
 #include "nvs.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
 #include "data_manager.h"
 #include "networking.h"
 #include "web_client.h"
-#include "tp_cal_screen.h"
 #include "buzzer.h"
 #include "tsc2046.h"
+#include "p1_serial.h"
+#include "ingest_log.h"
+#include "local_clock.h"
 
 #define NVS_GENERAL_NAMESPACE "general"
 #define NVS_SETUP_KEY "setup_done"
@@ -86,7 +104,7 @@ void ui_set_servers_found(ui_server_t * servers, uint16_t len);
  */
 static inline bool ui_is_setup(void) {
 #if SIMULATOR
-    return false;
+    return sim_is_setup();
 #else
     uint8_t setup;
 
@@ -131,6 +149,37 @@ static inline uint16_t ui_get_power_consumption(void)
 #endif
 }
 
+/**
+ * @brief Allocate a large buffer for the UI
+ *
+ * Large buffers are allocated in PSRAM, the internal RAM is kept for the render buffers.
+ *
+ * @param[in] size The size in bytes
+ * @return The buffer, NULL if the allocation failed
+ */
+static inline void * ui_alloc_large(size_t size)
+{
+#if SIMULATOR
+    return malloc(size);
+#else
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+#endif
+}
+
+/**
+ * @brief Free a buffer allocated with ui_alloc_large()
+ *
+ * @param[in] ptr The buffer, may be NULL
+ */
+static inline void ui_free_large(void * ptr)
+{
+#if SIMULATOR
+    free(ptr);
+#else
+    heap_caps_free(ptr);
+#endif
+}
+
 /**
  * @brief Get the current time
  *
@@ -139,11 +188,9 @@ static inline uint16_t ui_get_power_consumption(void)
 static inline time_t ui_get_time(void)
 {
 #if SIMULATOR
-    return time(NULL);
+    return sim_get_time();
 #else
-    time_t timestamp;
-    data_manager_get_field(DM_DF_P1_TIMESTAMP, &timestamp);
-    return timestamp;
+    return local_clock_get_time();
 #endif
 }
 
@@ -177,11 +224,27 @@ static inline uint16_t ui_get_predicted_peak(void) {
     return lv_rand(1000, 5000) ;
 #else
     data_manager_demand_data_point_t predicted_demand;
-    data_manager_get_field(DM_DF_PREDICTED_PEAK, &predicted_demand);
+    data_manager_get_field(DM_DF_LOCAL_PREDICTED_PEAK, &predicted_demand);
+    if (predicted_demand.timestamp == 0) {
+        data_manager_get_field(DM_DF_PREDICTED_PEAK, &predicted_demand);
+    }
     return (uint16_t) (predicted_demand.demand * 1000);
 #endif
 }
 
+/**
+ * @brief Check if the network is initialized
+ *
+ * @return true if the network is initialized
+ */
+static inline bool ui_is_network_initialized(void) {
+#if SIMULATOR
+    return false;
+#else
+    return networking_is_initialized();
+#endif
+}
+
 /**
  * @brief Connect to the configured wifi network
  *
@@ -200,6 +263,10 @@ static inline void ui_connect_wifi(void) {
 static inline void ui_start_web_client(void) {
 #if SIMULATOR
 
+#elif INGEST_LOG_MODE == INGEST_LOG_MODE_REPLAY
+    // The meter data comes from the replayed log
+#elif P1_SERIAL_ENABLED
+    // The meter data comes from the P1 port
 #else
     // Run the web client
     esp_log_level_set("web_client", ESP_LOG_DEBUG);
@@ -4,6 +4,7 @@
  */
 
 #include "lvgl.h"
+#include "ui.h"
 #include "loading_screen.h"
 
 lv_obj_t * loading_screen;
@@ -18,7 +19,7 @@ LV_IMG_DECLARE(kwartiwi_logo_240);
 void loading_screen_init(void) {
     loading_screen = lv_obj_create(NULL);
     lv_obj_clear_flag(loading_screen, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_color(loading_screen, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(loading_screen, &theme_style_screen_light, LV_PART_MAIN);
 
     // Logo
     logo_img = lv_img_create(loading_screen);
@@ -38,8 +39,8 @@ void loading_screen_init(void) {
     lv_obj_set_y(spinner, -40);
     lv_obj_set_align(spinner, LV_ALIGN_BOTTOM_MID);
     lv_obj_clear_flag(spinner, LV_OBJ_FLAG_CLICKABLE);
-    lv_obj_set_style_arc_width(spinner, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(spinner, 5, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(spinner, &theme_style_spinner, LV_PART_MAIN);
+    lv_obj_add_style(spinner, &theme_style_spinner, LV_PART_INDICATOR);
 }
 
 /**
@@ -47,4 +48,8 @@ void loading_screen_init(void) {
  */
 void loading_screen_deinit(void) {
     lv_obj_del(loading_screen);
+    lv_img_cache_invalidate_src(&kwartiwi_logo_240);    // Free the decoded logo, it is not shown again
+    loading_screen = NULL;
+    logo_img = NULL;
+    spinner = NULL;
 }
\ No newline at end of file
@@ -10,20 +10,23 @@
  *   - ui_set_new_max_peak_demand(uint16_t value)
  *   - ui_reset_peak_demand_chart_data(void)
  *   - ui_add_peak_demand_data_point(time_t time, uint16_t value)
+ *   - ui_set_peak_demand_chart_history(const ui_demand_point_t points[], uint16_t count)
  *   - ui_set_predicted_peak(uint16_t value)
+ *   - ui_set_energy_bucket(time_t start, uint16_t value)
  *   - ui_set_wifi_status(bool connected)
  *   - ui_set_connected_status(bool connected)
  *
  * @todo Load the settings screen when the icon is pressed instead of the touch cal screen
- * @todo Add helper functions to set the energy chart data
- * @todo Show the correct time of the day under the energy chart
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 #include "lvgl.h"
 #include "ui.h"
 #include "main_screen.h"
+#include "demand_downsampler.h"
+#include "power_readout.h"
 
 // UI constants
 #define MAX_PEAK_DEMAND_MIN_VALUE_W 2500
@@ -31,20 +34,24 @@
 #define PEAK_DEMAND_CHART_DEFAULT_Y_RANGE (MAX_PEAK_DEMAND_MIN_VALUE_W)
 #define PEAK_DEMAND_CHART_POINT_COUNT 225
 #define PEAK_DEMAND_CHART_PADDING_PX 7 // (240 - 225 - 1) / 2
+#define PEAK_DEMAND_CHART_Y_RANGE_STEP_W 250          // The y range is rounded up to a multiple of this step
+#define PEAK_DEMAND_CHART_Y_RANGE_HYSTERESIS_W 1000   // The y range only shrinks when it is this much larger than needed
+#define PEAK_DEMAND_CHART_ROLLOVER_GRACE_S 5   // Time after the end of a quarter-hour before the chart is cleared when no new data is received
 #define MAX_PEAK_LINE_DEFAULT_POS MAX_PEAK_DEMAND_MIN_VALUE_W
 #define MAX_PEAK_LINE_MIN_OFFSET_TOP_PX 20
 #define ENERGY_CHART_HEIGHT_PX 70
+#define ENERGY_CHART_POINT_COUNT 45
+#define ENERGY_CHART_BUCKET_S (32 * 60)  // 45 buckets of 32 minutes = 24 hours
+#define ENERGY_CHART_X_LABEL_COUNT 5
+#define ENERGY_CHART_MIN_Y_RANGE_WH 100
 
-// Colors
-#define TEXT_COLOR lv_color_hex(0xFFFFFF)
-#define BACKGROUND_COLOR lv_color_hex(0x000000)
+#define PREDICTED_PEAK_LINE_WIDTH_PX 2
 
 bool main_screen_initialized = false;
 
 // LVGL objects
 lv_obj_t * main_screen;
-static lv_obj_t * power_consumption_label;
-static lv_obj_t * power_consumption_unit_label;
+static lv_obj_t * power_readout;
 static lv_obj_t * energy_chart;
 static lv_obj_t * peak_demand_chart;
 static lv_chart_series_t * peak_demand_chart_series;
@@ -62,13 +69,24 @@ static lv_timer_t * timer_1s;
 static lv_timer_t * alarm_timer;
 static lv_coord_t peak_demand_chart_y_range = PEAK_DEMAND_CHART_DEFAULT_Y_RANGE;
 static lv_point_t peak_demand_last_point_w = {0, 0};
-static lv_coord_t max_peak_line_pos_w = MAX_PEAK_LINE_DEFAULT_POS;
+static uint16_t peak_demand_chart_max_w = 0;        // Highest point in the peak demand chart
+static demand_downsampler_t peak_demand_downsampler;   // Columns of the quarter-hour shown in the peak demand chart
+static lv_coord_t max_peak_line_pos_w = 0;          // 0 until the max peak line is placed
+static bool predicted_peak_line_shown = false;
 static lv_point_t predicted_peak_line_points[2] = {{0, PEAK_DEMAND_CHART_HEIGHT_PX}, {0, PEAK_DEMAND_CHART_HEIGHT_PX}};
 static uint16_t new_max_peak_demand_w = MAX_PEAK_LINE_DEFAULT_POS;
+static lv_opa_t peak_demand_chart_fade_strip[PEAK_DEMAND_CHART_HEIGHT_PX];   // Opacity of the faded area below the line, per row of the chart
+static time_t energy_chart_last_bucket_start = 0;   // Start of the newest (rightmost) bucket in the energy chart, 0 if empty
+static lv_coord_t energy_chart_y_range = ENERGY_CHART_MIN_Y_RANGE_WH;
+
+// Styles of the main screen, the shared styles are in theme.c
+static lv_style_t style_energy_chart;
+static lv_style_t style_peak_demand_chart;
+static lv_style_t style_chart_no_points;
+static lv_style_t style_max_peak_line;
+static lv_style_t style_predicted_peak_line;
 
 // Fonts and images
-LV_FONT_DECLARE(roboto_bold_70);
-LV_FONT_DECLARE(roboto_bold_20);
 LV_IMG_DECLARE(wifi_symbol_20_14);
 LV_IMG_DECLARE(wifi_symbol_nc_20_14);
 LV_IMG_DECLARE(connected_symbol_14_14);
@@ -76,7 +94,12 @@ LV_IMG_DECLARE(connected_symbol_nc_14_14);
 LV_IMG_DECLARE(settings_symbol_20_20);
 
 // Function prototypes
+static void init_styles(void);
+static void clear_peak_demand_chart(void);
 static void set_peak_demand_chart_data_point(uint16_t value, uint8_t index);
+static bool update_peak_demand_chart_range(uint16_t max_peak_w);
+static void init_peak_demand_chart_fade_strip(void);
+static void update_energy_chart_range(void);
 static void show_alarm_style(bool alarm);
 static void set_alarm_status(bool alarm);
 static void peak_demand_chart_draw_event_cb(lv_event_t * e);
@@ -84,33 +107,24 @@ static void energy_chart_draw_event_cb(lv_event_t * e);
 static void open_settings_event_cb(lv_event_t * e);
 static void timer_1s_cb(lv_timer_t * timer);
 static void alarm_timer_cb(lv_timer_t * timer);
+static int32_t get_coverage_below_line(int32_t y_top_256, int32_t y_bottom_256, lv_coord_t y);
+static int32_t get_coverage_integral(int32_t row_top_256, int32_t y_256);
+static int32_t floor_div(int32_t numerator, int32_t denominator);
 
 /**
  * @brief Initialize the main screen
  */
 void main_screen_init(void)
 {
+    init_styles();
+
     main_screen = lv_obj_create(NULL);
     lv_obj_clear_flag(main_screen, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_color(main_screen, BACKGROUND_COLOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // power consumption label
-    power_consumption_label = lv_label_create(main_screen);
-    lv_obj_set_width(power_consumption_label, LV_SIZE_CONTENT);
-    lv_obj_set_height(power_consumption_label, LV_SIZE_CONTENT);
-    lv_obj_align(power_consumption_label, LV_ALIGN_CENTER, -10, 20);
-    lv_obj_set_style_text_color(power_consumption_label, TEXT_COLOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(power_consumption_label, &roboto_bold_70, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_label_set_text(power_consumption_label, "0");
-
-    // power consumption unit label
-    power_consumption_unit_label = lv_label_create(main_screen);
-    lv_obj_set_width(power_consumption_unit_label, LV_SIZE_CONTENT);
-    lv_obj_set_height(power_consumption_unit_label, LV_SIZE_CONTENT);
-    lv_obj_align_to(power_consumption_unit_label, power_consumption_label, LV_ALIGN_OUT_RIGHT_BOTTOM, 10, 0);
-    lv_obj_set_style_text_color(power_consumption_unit_label, TEXT_COLOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(power_consumption_unit_label, &roboto_bold_20, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_label_set_text(power_consumption_unit_label, "kW");
+    lv_obj_add_style(main_screen, &theme_style_screen_dark, LV_PART_MAIN);
+
+    // power consumption readout (number and unit), drawn from pre-rendered sprites
+    power_readout = power_readout_create(main_screen, THEME_COLOR_DARK_TEXT, THEME_COLOR_ALARM, THEME_COLOR_DARK_BG);
+    lv_obj_align(power_readout, LV_ALIGN_CENTER, 0, 20);
 
     // energy chart
     energy_chart = lv_chart_create(main_screen);
@@ -118,22 +132,18 @@ void main_screen_init(void)
     lv_obj_set_height(energy_chart, ENERGY_CHART_HEIGHT_PX);
     lv_obj_align(energy_chart, LV_ALIGN_BOTTOM_MID, 0, -18);
     lv_chart_set_type(energy_chart, LV_CHART_TYPE_BAR);
-    lv_chart_set_point_count(energy_chart, 45);
+    lv_chart_set_point_count(energy_chart, ENERGY_CHART_POINT_COUNT);
     lv_chart_set_div_line_count(energy_chart,0,0);
-    lv_chart_set_axis_tick(energy_chart, LV_CHART_AXIS_PRIMARY_X, 2, 0, 5, 1, true, 20);
+    lv_chart_set_axis_tick(energy_chart, LV_CHART_AXIS_PRIMARY_X, 2, 0, ENERGY_CHART_X_LABEL_COUNT, 1, true, 20);
     lv_chart_set_axis_tick(energy_chart, LV_CHART_AXIS_PRIMARY_Y, 0, 0, 0, 0, false, 20);
     lv_chart_set_axis_tick(energy_chart, LV_CHART_AXIS_SECONDARY_Y, 0, 0, 0, 0, false, 20);
-    lv_obj_set_style_pad_column(energy_chart, 1, LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(energy_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(energy_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_outline_width(energy_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_outline_pad(energy_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(energy_chart, &lv_font_montserrat_12, LV_PART_TICKS | LV_STATE_DEFAULT);
+    lv_obj_add_style(energy_chart, &theme_style_transparent, LV_PART_MAIN);
+    lv_obj_add_style(energy_chart, &style_energy_chart, LV_PART_MAIN);
+    lv_obj_add_style(energy_chart, &theme_style_text_small, LV_PART_TICKS);
     energy_chart_series = lv_chart_add_series(energy_chart, COLOR_KWARTIWI_ORANGE, LV_CHART_AXIS_PRIMARY_Y);
     lv_obj_add_event_cb(energy_chart, energy_chart_draw_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
-    for (int i = 0; i < 45; i++) {
-        lv_chart_set_next_value(energy_chart, energy_chart_series, lv_rand(0, 100));
-    }
+    lv_chart_set_range(energy_chart, LV_CHART_AXIS_PRIMARY_Y, 0, energy_chart_y_range);
+    lv_chart_set_all_value(energy_chart, energy_chart_series, LV_CHART_POINT_NONE);
 
     // peak demand chart
     peak_demand_chart = lv_chart_create(main_screen);
@@ -142,15 +152,14 @@ void main_screen_init(void)
     lv_chart_set_type(peak_demand_chart, LV_CHART_TYPE_LINE);
     lv_chart_set_div_line_count(peak_demand_chart, 0, 0);
     lv_chart_set_range(peak_demand_chart,LV_CHART_AXIS_PRIMARY_Y, 0, peak_demand_chart_y_range);
-    lv_obj_set_style_bg_opa(peak_demand_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(peak_demand_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_size(peak_demand_chart, 0, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_top(peak_demand_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_bottom(peak_demand_chart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_left(peak_demand_chart, PEAK_DEMAND_CHART_PADDING_PX, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_right(peak_demand_chart, PEAK_DEMAND_CHART_PADDING_PX, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(peak_demand_chart, &theme_style_transparent, LV_PART_MAIN);
+    lv_obj_add_style(peak_demand_chart, &style_peak_demand_chart, LV_PART_MAIN);
+    lv_obj_add_style(peak_demand_chart, &style_chart_no_points, LV_PART_INDICATOR);
     lv_chart_set_point_count(peak_demand_chart, PEAK_DEMAND_CHART_POINT_COUNT);
+    lv_chart_set_update_mode(peak_demand_chart, LV_CHART_UPDATE_MODE_CIRCULAR);   // Only invalidate the columns next to a changed point, instead of the whole chart
     lv_obj_add_event_cb(peak_demand_chart, peak_demand_chart_draw_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    init_peak_demand_chart_fade_strip();
+    demand_downsampler_init(&peak_demand_downsampler, PEAK_DEMAND_CHART_POINT_COUNT, 900 / PEAK_DEMAND_CHART_POINT_COUNT);   // 900 seconds = 15 minutes
     peak_demand_chart_series = lv_chart_add_series(peak_demand_chart, COLOR_WHITE, LV_CHART_AXIS_PRIMARY_Y);
     lv_chart_set_all_value(peak_demand_chart, peak_demand_chart_series, LV_CHART_POINT_NONE);
 
@@ -159,28 +168,26 @@ void main_screen_init(void)
     lv_obj_set_size(max_peak_line, LV_HOR_RES, 1);
     lv_obj_set_align(max_peak_line, LV_ALIGN_BOTTOM_MID);
     lv_obj_set_pos(max_peak_line, 0, 0);
-    lv_obj_set_style_bg_color(max_peak_line, COLOR_KWARTIWI_RED, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(max_peak_line, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(max_peak_line, &style_max_peak_line, LV_PART_MAIN);
     lv_obj_clear_flag(peak_demand_chart, LV_OBJ_FLAG_SCROLLABLE);
 
     // max peak label
     max_peak_label = lv_label_create(peak_demand_chart);
-    lv_obj_set_style_text_color(max_peak_label, COLOR_KWARTIWI_RED, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(max_peak_label, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(max_peak_label, &theme_style_text_alarm, LV_PART_MAIN);
+    lv_obj_add_style(max_peak_label, &theme_style_text_small, LV_PART_MAIN);
     lv_obj_align_to(max_peak_label, max_peak_line, LV_ALIGN_OUT_TOP_LEFT, 10, 0);
     lv_label_set_text(max_peak_label, "0 W");
 
     // Predicted peak line
     predicted_peak_line = lv_line_create(peak_demand_chart);
     lv_line_set_points(predicted_peak_line, predicted_peak_line_points, 1);
-    lv_obj_set_style_line_color(predicted_peak_line, COLOR_KWARTIWI_GREY, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_line_width(predicted_peak_line, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(predicted_peak_line, &style_predicted_peak_line, LV_PART_MAIN);
 
     // Date time label
     time_label = lv_label_create(main_screen);
     lv_obj_align(time_label, LV_ALIGN_TOP_MID, 0, 5);
-    lv_obj_set_style_text_color(time_label, TEXT_COLOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(time_label, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(time_label, &theme_style_text_light, LV_PART_MAIN);
+    lv_obj_add_style(time_label, &theme_style_text_large, LV_PART_MAIN);
     lv_label_set_text(time_label, "00:00");
 
     // Wifi symbol img
@@ -207,6 +214,9 @@ void main_screen_init(void)
     timer_1s = lv_timer_create(timer_1s_cb, 1000, NULL);
     alarm_timer = lv_timer_create(alarm_timer_cb, 500, NULL);
 
+    // Frame profiler overlay, hidden until toggled
+    profiler_overlay_create(main_screen);
+
     // Set the initial values
     new_max_peak_demand_w = ui_get_max_peak_month();
     ui_set_max_peak_line(new_max_peak_demand_w);
@@ -218,19 +228,20 @@ void main_screen_init(void)
 /**
  * @brief Set the power consumption
  *
- * This function will update the power consumption label and unit label, according to the value.
+ * This function will update the power consumption readout, according to the value.
  *
  * @param[in] value The power consumption value in Watt
  */
 void ui_set_power_consumption(uint16_t value) {
+    char number[POWER_READOUT_MAX_CHARS + 1];
+
     if (value < 9999) {
-        lv_label_set_text_fmt(power_consumption_label, "%d", value);
-        lv_label_set_text(power_consumption_unit_label, "W");
+        lv_snprintf(number, sizeof(number), "%d", value);
+        power_readout_set_value(number, POWER_READOUT_UNIT_W);
     }else{
-        lv_label_set_text_fmt(power_consumption_label, "%d.%d", value/1000, value%1000);
-        lv_label_set_text(power_consumption_unit_label, "kW");
+        lv_snprintf(number, sizeof(number), "%d.%d", value/1000, value%1000);
+        power_readout_set_value(number, POWER_READOUT_UNIT_KW);
     }
-    lv_obj_align_to(power_consumption_unit_label, power_consumption_label, LV_ALIGN_OUT_RIGHT_BOTTOM, 10, 0);
 }
 
 /**
@@ -251,6 +262,8 @@ void ui_set_time(time_t time) {
  * This function will update the max peak line label and the max peak line, according to the value.
  * The max peak line will always be at the top of the chart, except when there is a higher value in the chart.
  *
+ * Nothing is redrawn when the value and the scale of the chart do not change.
+ *
  * @note When the data in the chart is changed, this function should also be called so the chart is correctly scaled.
  *
  * @param[in] value The new max peak value in Watt
@@ -259,13 +272,12 @@ void ui_set_max_peak_line(uint16_t value) {
     if (value < MAX_PEAK_DEMAND_MIN_VALUE_W) {
         value = MAX_PEAK_DEMAND_MIN_VALUE_W;
     }
-    // Find the highest point in the chart in Watt, and add an offset in px to it
-    lv_coord_t highest_point = (lv_coord_t)(value > peak_demand_last_point_w.y ? value : peak_demand_last_point_w.y);
-    highest_point = (lv_coord_t)(highest_point * PEAK_DEMAND_CHART_HEIGHT_PX / (PEAK_DEMAND_CHART_HEIGHT_PX - MAX_PEAK_LINE_MIN_OFFSET_TOP_PX));
 
-    // Update the chart range so that the highest point is at the top of the chart
-    peak_demand_chart_y_range = highest_point;
-    lv_chart_set_range(peak_demand_chart, LV_CHART_AXIS_PRIMARY_Y, 0, peak_demand_chart_y_range);
+    // Update the chart range so that the highest point is near the top of the chart
+    bool range_changed = update_peak_demand_chart_range(value);
+    if (!range_changed && value == max_peak_line_pos_w) {
+        return;
+    }
 
     // Update the max peak line (convert the value in Watt to a position in px)
     assert(peak_demand_chart_y_range != 0);
@@ -295,38 +307,79 @@ void ui_set_new_max_peak_demand(uint16_t value) {
 /**
  * @brief Set a data point in the peak demand chart
  *
+ * The data point is added to the downsampler, only the chart columns it changed are updated.
+ * The chart is reset when the data point is in a newer quarter-hour than the chart, data points of an older quarter-hour are ignored.
+ *
  * @todo Alarm the user if the value is higher than the current max peak?
  *
  * @param[in] time The time of the data point
  * @param[in] value The value of the data point in Watt
  */
 void ui_add_peak_demand_data_point(time_t time, uint16_t value) {
-    const uint8_t seconds_per_point = 900 / PEAK_DEMAND_CHART_POINT_COUNT;  // 900 seconds = 15 minutes
-    struct tm * _tm = localtime(&time);
+    uint16_t first_changed, last_changed;
 
-    // Calculate the number of seconds since the start of this quarter-hour
-    uint16_t seconds =  (_tm->tm_min % 15) * 60 + _tm->tm_sec;
+    demand_downsampler_result_t result = demand_downsampler_add(&peak_demand_downsampler, time, value, &first_changed, &last_changed);
+    if (result == DEMAND_DOWNSAMPLER_IGNORED) {
+        return;
+    }
 
-    // Check if we are at the start of a new quarter-hour
-    if (seconds == 0 || value < peak_demand_last_point_w.y) {
-        // Reset the chart data, so no old data is shown
-        ui_reset_peak_demand_chart_data();
+    if (result == DEMAND_DOWNSAMPLER_NEW_PERIOD) {
+        // Clear the chart, so no old data is shown
+        clear_peak_demand_chart();
     }
 
-    // Set the point in the chart at the calculated position
-    set_peak_demand_chart_data_point(value, seconds / seconds_per_point);
+    // Copy the changed columns to the chart, the missed columns are interpolated
+    for (uint16_t i = first_changed; i <= last_changed; i++) {
+        set_peak_demand_chart_data_point(peak_demand_downsampler.values[i], (uint8_t)i);
+    }
+
+    peak_demand_last_point_w.x = peak_demand_downsampler.last_column;
+    peak_demand_last_point_w.y = (lv_coord_t)peak_demand_downsampler.values[peak_demand_downsampler.last_column];
+}
+
+/**
+ * @brief Replace the peak demand chart data with a series of data points
+ *
+ * Only the points of the quarter-hour of the newest point are shown. All points go through the downsampler,
+ * then the columns are copied to the chart and the chart is redrawn once.
+ *
+ * @param[in] points The data points, oldest first
+ * @param[in] count The number of data points
+ */
+void ui_set_peak_demand_chart_history(const ui_demand_point_t points[], uint16_t count) {
+    lv_coord_t * values = lv_chart_get_y_array(peak_demand_chart, peak_demand_chart_series);
+    uint16_t first_changed, last_changed;
+
+    demand_downsampler_reset(&peak_demand_downsampler);
+    for (uint16_t i = 0; i < count; i++) {
+        demand_downsampler_add(&peak_demand_downsampler, points[i].time, points[i].value, &first_changed, &last_changed);
+    }
 
-    // Check if we missed any previous points, and if so, set them to the current value // TODO: interpolate them instead?
-    for (int i = seconds / seconds_per_point - 1; i >= 0; i--) {
-        lv_point_t point;
-        lv_chart_get_point_pos_by_id(peak_demand_chart, peak_demand_chart_series, i, &point);
-        if (point.y < 0) {  // points not set (LV_CHART_POINT_NONE) have a negative y value (under the x axis)
-            set_peak_demand_chart_data_point(value, i);
+    // Copy all columns to the chart, without redrawing it yet
+    peak_demand_chart_max_w = 0;
+    for (uint16_t i = 0; i < PEAK_DEMAND_CHART_POINT_COUNT; i++) {
+        uint16_t value = peak_demand_downsampler.values[i];
+        if (value == DEMAND_DOWNSAMPLER_NO_VALUE) {
+            values[i] = LV_CHART_POINT_NONE;
+            continue;
         }
-        else {
-            break;
+        values[i] = (lv_coord_t)value;
+        if (value > peak_demand_chart_max_w) {
+            peak_demand_chart_max_w = value;
         }
     }
+
+    peak_demand_last_point_w.x = 0;
+    peak_demand_last_point_w.y = 0;
+    if (peak_demand_downsampler.last_column >= 0) {
+        peak_demand_last_point_w.x = peak_demand_downsampler.last_column;
+        peak_demand_last_point_w.y = values[peak_demand_downsampler.last_column];
+    }
+
+    // Scale the chart without hysteresis and redraw it once
+    peak_demand_chart_y_range = 0;
+    ui_set_max_peak_line(new_max_peak_demand_w);
+    lv_chart_refresh(peak_demand_chart);
 }
 
 /**
@@ -335,15 +388,8 @@ void ui_add_peak_demand_data_point(time_t time, uint16_t value) {
  * Resets all the data points, the last point and sets the max peak line to the new max peak demand.
  */
 void ui_reset_peak_demand_chart_data(void) {
-    // Set all the values, so that they are not visible
-    lv_chart_set_all_value(peak_demand_chart, peak_demand_chart_series, LV_CHART_POINT_NONE);
-
-    // Reset the last point
-    peak_demand_last_point_w.y = 0;
-    peak_demand_last_point_w.x = 0;
-
-    // Update the max peak line
-    ui_set_max_peak_line(new_max_peak_demand_w);
+    demand_downsampler_reset(&peak_demand_downsampler);
+    clear_peak_demand_chart();
 }
 
 /**
@@ -352,16 +398,22 @@ void ui_reset_peak_demand_chart_data(void) {
  * @param[in] value The predicted peak in Watt at the end of the quarter-hour
  */
 void ui_set_predicted_peak(uint16_t value) {
+    lv_point_t points[2];
+
     // Convert the last point (peak_demand_last_point_w) to pixels
-    lv_chart_get_point_pos_by_id(peak_demand_chart, peak_demand_chart_series, peak_demand_last_point_w.x, &predicted_peak_line_points[0]);
-    predicted_peak_line_points[0].x -= PEAK_DEMAND_CHART_PADDING_PX;
+    lv_chart_get_point_pos_by_id(peak_demand_chart, peak_demand_chart_series, peak_demand_last_point_w.x, &points[0]);
+    points[0].x -= PEAK_DEMAND_CHART_PADDING_PX;
 
     // Convert the predicted point to pixels
-    predicted_peak_line_points[1].y = (lv_coord_t)(PEAK_DEMAND_CHART_HEIGHT_PX - ((value * PEAK_DEMAND_CHART_HEIGHT_PX / peak_demand_chart_y_range)));
-    predicted_peak_line_points[1].x = PEAK_DEMAND_CHART_POINT_COUNT - 1;
-
-    // Redraw the line
-    lv_line_set_points(predicted_peak_line, predicted_peak_line_points, 2);
+    points[1].y = (lv_coord_t)(PEAK_DEMAND_CHART_HEIGHT_PX - ((value * PEAK_DEMAND_CHART_HEIGHT_PX / peak_demand_chart_y_range)));
+    points[1].x = PEAK_DEMAND_CHART_POINT_COUNT - 1;
+
+    // Redraw the line, only when it moved (the line invalidates its whole bounding box)
+    if (!predicted_peak_line_shown || memcmp(points, predicted_peak_line_points, sizeof(points)) != 0) {
+        memcpy(predicted_peak_line_points, points, sizeof(points));
+        lv_line_set_points(predicted_peak_line, predicted_peak_line_points, 2);
+        predicted_peak_line_shown = true;
+    }
 
     // Check if the predicted peak is higher than the current max peak and if we are not at the very start of the chart
     if (value > max_peak_line_pos_w && peak_demand_last_point_w.x >= 50) {
@@ -374,6 +426,53 @@ void ui_set_predicted_peak(uint16_t value) {
     }
 }
 
+/**
+ * @brief Set the energy of a bucket in the energy chart
+ *
+ * A bucket newer than the newest bucket in the chart is added at the right, and shifts the older buckets to the left.
+ * An older bucket that is still in the chart is updated in place, the chart is never rebuilt.
+ *
+ * @param[in] start The start time of the bucket, a multiple of ENERGY_CHART_BUCKET_S
+ * @param[in] value The energy in the bucket in Wh
+ */
+void ui_set_energy_bucket(time_t start, uint16_t value) {
+    if (start > energy_chart_last_bucket_start) {
+        // Add empty buckets for the buckets in between
+        time_t missing_buckets = ENERGY_CHART_POINT_COUNT - 1;
+        if (energy_chart_last_bucket_start != 0) {
+            missing_buckets = (start - energy_chart_last_bucket_start) / ENERGY_CHART_BUCKET_S - 1;
+            if (missing_buckets > ENERGY_CHART_POINT_COUNT - 1) {
+                missing_buckets = ENERGY_CHART_POINT_COUNT - 1;
+            }
+        }
+        for (time_t i = 0; i < missing_buckets; i++) {
+            lv_chart_set_next_value(energy_chart, energy_chart_series, LV_CHART_POINT_NONE);
+        }
+
+        lv_chart_set_next_value(energy_chart, energy_chart_series, (lv_coord_t)value);
+        energy_chart_last_bucket_start = start;
+        update_energy_chart_range();
+        return;
+    }
+
+    time_t offset = (energy_chart_last_bucket_start - start) / ENERGY_CHART_BUCKET_S;
+    if (offset >= ENERGY_CHART_POINT_COUNT) {
+        // Not in the chart anymore
+        return;
+    }
+
+    // The newest point is just before the start point in the (circular) value array
+    lv_coord_t * values = lv_chart_get_y_array(energy_chart, energy_chart_series);
+    uint16_t start_point = lv_chart_get_x_start_point(energy_chart, energy_chart_series);
+    uint16_t index = (start_point + ENERGY_CHART_POINT_COUNT - 1 - offset) % ENERGY_CHART_POINT_COUNT;
+    if (values[index] == (lv_coord_t)value) {
+        return;
+    }
+
+    lv_chart_set_value_by_id(energy_chart, energy_chart_series, index, (lv_coord_t)value);
+    update_energy_chart_range();
+}
+
 /**
  * @brief Set the status of the WiFi connection
  *
@@ -409,8 +508,17 @@ void ui_set_connected_status(bool connected) {
  */
 static void timer_1s_cb(lv_timer_t * timer)
 {
+    time_t now = ui_get_time();
+
     // Update the time
-    ui_set_time(ui_get_time());
+    ui_set_time(now);
+
+    // Clear the peak demand chart at the end of the quarter-hour, also when no new data is received.
+    // The quarter-hour is finished, so late samples of it (from a meter clock that lags) can not fill the chart again.
+    if (peak_demand_downsampler.period_start != 0 && now >= peak_demand_downsampler.period_start + 900 + PEAK_DEMAND_CHART_ROLLOVER_GRACE_S) {
+        demand_downsampler_finish_period(&peak_demand_downsampler);
+        clear_peak_demand_chart();
+    }
 }
 
 /**
@@ -438,6 +546,53 @@ static void alarm_timer_cb(lv_timer_t * timer)
     blink = !blink;
 }
 
+/**
+ * @brief Initialize the styles of the main screen
+ *
+ * @note The main screen is never deleted, the styles are initialized once
+ */
+static void init_styles(void) {
+    lv_style_init(&style_energy_chart);
+    lv_style_set_pad_column(&style_energy_chart, 1);
+
+    lv_style_init(&style_peak_demand_chart);
+    lv_style_set_pad_top(&style_peak_demand_chart, 0);
+    lv_style_set_pad_bottom(&style_peak_demand_chart, 0);
+    lv_style_set_pad_left(&style_peak_demand_chart, PEAK_DEMAND_CHART_PADDING_PX);
+    lv_style_set_pad_right(&style_peak_demand_chart, PEAK_DEMAND_CHART_PADDING_PX);
+
+    lv_style_init(&style_chart_no_points);
+    lv_style_set_size(&style_chart_no_points, 0);
+
+    lv_style_init(&style_max_peak_line);
+    lv_style_set_bg_color(&style_max_peak_line, THEME_COLOR_ALARM);
+    lv_style_set_border_width(&style_max_peak_line, 0);
+
+    lv_style_init(&style_predicted_peak_line);
+    lv_style_set_line_color(&style_predicted_peak_line, COLOR_KWARTIWI_GREY);
+    lv_style_set_line_width(&style_predicted_peak_line, PREDICTED_PEAK_LINE_WIDTH_PX);
+}
+
+/**
+ * @brief Clear the peak demand chart
+ *
+ * Clears all the data points and the last point, and sets the max peak line to the new max peak demand.
+ * The downsampler is not changed.
+ */
+static void clear_peak_demand_chart(void) {
+    // Set all the values, so that they are not visible
+    lv_chart_set_all_value(peak_demand_chart, peak_demand_chart_series, LV_CHART_POINT_NONE);
+
+    // Reset the last point
+    peak_demand_last_point_w.y = 0;
+    peak_demand_last_point_w.x = 0;
+    peak_demand_chart_max_w = 0;
+
+    // Update the max peak line, the chart is redrawn anyway so the range is recalculated without hysteresis
+    peak_demand_chart_y_range = 0;
+    ui_set_max_peak_line(new_max_peak_demand_w);
+}
+
 /**
  * @brief Set a data point in the peak demand chart
  *
@@ -448,34 +603,106 @@ static void alarm_timer_cb(lv_timer_t * timer)
  */
 static void set_peak_demand_chart_data_point(uint16_t value, uint8_t index) {
     assert(index < PEAK_DEMAND_CHART_POINT_COUNT);
-    printf("Setting peak demand chart data point %d to %d\n", index, value);
+
+    // Skip updates that do not change the point, so nothing is redrawn
+    if (lv_chart_get_y_array(peak_demand_chart, peak_demand_chart_series)[index] == (lv_coord_t)value) {
+        return;
+    }
+
+    // In circular update mode only the columns next to the point are invalidated
     lv_chart_set_value_by_id(peak_demand_chart, peak_demand_chart_series, index, (lv_coord_t)value);
-    peak_demand_last_point_w.y = (lv_coord_t)value;
-    peak_demand_last_point_w.x = index;
 
-    if (value > max_peak_line_pos_w) {
+    // Rescale the chart if the new point does not fit
+    if (value > peak_demand_chart_max_w) {
+        peak_demand_chart_max_w = value;
         ui_set_max_peak_line(max_peak_line_pos_w);
     }
 }
 
+/**
+ * @brief Update the y range of the peak demand chart
+ *
+ * The range fits the highest point in the chart and the max peak line, with an offset at the top.
+ * To avoid redrawing the whole chart for every new high point, the range is rounded up to PEAK_DEMAND_CHART_Y_RANGE_STEP_W,
+ * and it only shrinks when it is more than PEAK_DEMAND_CHART_Y_RANGE_HYSTERESIS_W larger than needed.
+ *
+ * @param[in] max_peak_w The value of the max peak line in Watt
+ * @return true if the range changed, and the chart will be redrawn
+ */
+static bool update_peak_demand_chart_range(uint16_t max_peak_w) {
+    // Find the highest point in the chart in Watt, and add an offset in px to it
+    int32_t needed = max_peak_w > peak_demand_chart_max_w ? max_peak_w : peak_demand_chart_max_w;
+    needed = needed * PEAK_DEMAND_CHART_HEIGHT_PX / (PEAK_DEMAND_CHART_HEIGHT_PX - MAX_PEAK_LINE_MIN_OFFSET_TOP_PX);
+
+    if (needed <= peak_demand_chart_y_range && peak_demand_chart_y_range - needed < PEAK_DEMAND_CHART_Y_RANGE_HYSTERESIS_W) {
+        return false;
+    }
+
+    int32_t range = (needed + PEAK_DEMAND_CHART_Y_RANGE_STEP_W - 1) / PEAK_DEMAND_CHART_Y_RANGE_STEP_W * PEAK_DEMAND_CHART_Y_RANGE_STEP_W;
+    if (range > LV_COORD_MAX) {
+        range = LV_COORD_MAX;
+    }
+    if (range == peak_demand_chart_y_range) {
+        return false;
+    }
+
+    peak_demand_chart_y_range = (lv_coord_t)range;
+    lv_chart_set_range(peak_demand_chart, LV_CHART_AXIS_PRIMARY_Y, 0, peak_demand_chart_y_range);
+    return true;
+}
+
+/**
+ * @brief Calculate the opacity of the faded area below the peak demand chart line
+ *
+ * Fully covered at the top quarter of the chart, fading to transparent at the bottom (like lv_draw_mask_fade),
+ * combined with the LV_OPA_20 of the area.
+ */
+static void init_peak_demand_chart_fade_strip(void) {
+    const int32_t y_top = PEAK_DEMAND_CHART_HEIGHT_PX / 4;
+    const int32_t y_bottom = PEAK_DEMAND_CHART_HEIGHT_PX - 1;
+
+    for (int32_t y = 0; y < PEAK_DEMAND_CHART_HEIGHT_PX; y++) {
+        int32_t fade = LV_OPA_COVER;
+        if (y > y_top) {
+            fade = (y_bottom - y) * LV_OPA_COVER / (y_bottom - y_top);
+        }
+        // Mixed like the software renderer mixes a mask with the opacity of a rectangle
+        peak_demand_chart_fade_strip[y] = (lv_opa_t)(fade >= LV_OPA_MAX ? LV_OPA_20 : (fade * LV_OPA_20) >> 8);
+    }
+}
+
+/**
+ * @brief Scale the energy chart to the highest bucket
+ *
+ * The range is rounded up to a multiple of ENERGY_CHART_MIN_Y_RANGE_WH, so it does not change with every update.
+ */
+static void update_energy_chart_range(void) {
+    lv_coord_t * values = lv_chart_get_y_array(energy_chart, energy_chart_series);
+    lv_coord_t max = 0;
+
+    for (uint16_t i = 0; i < ENERGY_CHART_POINT_COUNT; i++) {
+        if (values[i] != LV_CHART_POINT_NONE && values[i] > max) {
+            max = values[i];
+        }
+    }
+
+    lv_coord_t range = (lv_coord_t)((max / ENERGY_CHART_MIN_Y_RANGE_WH + 1) * ENERGY_CHART_MIN_Y_RANGE_WH);
+    if (range != energy_chart_y_range) {
+        energy_chart_y_range = range;
+        lv_chart_set_range(energy_chart, LV_CHART_AXIS_PRIMARY_Y, 0, energy_chart_y_range);
+    }
+}
+
 /**
  * @brief Show or hide the alarm style
  *
- * This function changes the color of the power consumption label to red to indicate an alarm.
+ * This function changes the color of the power consumption readout to red to indicate an alarm.
+ * The readout is put in the alarm state (THEME_STATE_ALARM), no style is changed.
  *
  * @param alarm True to show the alarm style, false to hide it
  */
 static void show_alarm_style(bool alarm) {
-    if (alarm) {
-        // Make the power consumption label red
-        lv_obj_set_style_text_color(power_consumption_label, COLOR_KWARTIWI_RED, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_text_color(power_consumption_unit_label, COLOR_KWARTIWI_RED, LV_PART_MAIN | LV_STATE_DEFAULT);
-    }
-    else {
-        // Reset the power consumption label color to the default
-        lv_obj_set_style_text_color(power_consumption_label, TEXT_COLOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_text_color(power_consumption_unit_label, TEXT_COLOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-    }
+    power_readout_set_alarm(alarm);
 }
 
 /**
@@ -510,15 +737,23 @@ static void open_settings_event_cb(lv_event_t * e) {
 /**
  * @brief Callback for the energy chart draw event
  *
- * @todo Implement so that that the x axis shows the time of the day
+ * Sets the labels of the x axis to the start time of the bucket under the label.
  *
  * @param[in] e The event
  */
 static void energy_chart_draw_event_cb(lv_event_t * e) {
     lv_obj_draw_part_dsc_t * dsc = lv_event_get_param(e);
     if(dsc->part == LV_PART_TICKS && dsc->id == LV_CHART_AXIS_PRIMARY_X) {
-        const char * month[] = {"9u", "12u", "15u", "18u", "21u"};
-        lv_snprintf(dsc->text, sizeof(dsc->text), "%s", month[dsc->value]);
+        if (energy_chart_last_bucket_start == 0) {
+            dsc->text[0] = '\0';
+            return;
+        }
+
+        // The labels are spread evenly over the points, the last label is at the newest bucket
+        int32_t point = dsc->value * (ENERGY_CHART_POINT_COUNT - 1) / (ENERGY_CHART_X_LABEL_COUNT - 1);
+        time_t bucket_start = energy_chart_last_bucket_start - (ENERGY_CHART_POINT_COUNT - 1 - point) * ENERGY_CHART_BUCKET_S;
+        struct tm * _tm = localtime(&bucket_start);
+        lv_snprintf(dsc->text, sizeof(dsc->text), "%d:%02d", _tm->tm_hour, _tm->tm_min);
     }
 }
 
@@ -526,7 +761,12 @@ static void energy_chart_draw_event_cb(lv_event_t * e) {
  * @brief Callback for the peak demand chart draw event
  *
  * Draws the faded area below the line.
- * @author Code from an example in the LVGL documentation
+ * The area looks like the LVGL example (a line mask and a fade mask per segment), but it is blended column by column
+ * with the precomputed opacities of peak_demand_chart_fade_strip, without setting up masks for every segment.
+ * The pixels of a column crossed by the line are covered in proportion to their part below the line, so the edge is
+ * anti-aliased like the line mask.
+ *
+ * @note Uses the software renderer directly (lv_draw_sw_blend)
  *
  * @param e
  */
@@ -538,34 +778,113 @@ static void peak_demand_chart_draw_event_cb(lv_event_t * e) {
     if(dsc->part == LV_PART_ITEMS) {
         if(!dsc->p1 || !dsc->p2) return;
 
-        /*Add a line mask that keeps the area below the line*/
-        lv_draw_mask_line_param_t line_mask_param;
-        lv_draw_mask_line_points_init(&line_mask_param, dsc->p1->x, dsc->p1->y, dsc->p2->x, dsc->p2->y, LV_DRAW_MASK_LINE_SIDE_BOTTOM);
-        int16_t line_mask_id = lv_draw_mask_add(&line_mask_param, NULL);
-
-        /*Add a fade effect: transparent bottom covering top*/
-        lv_coord_t h = lv_obj_get_height(obj);
-        lv_draw_mask_fade_param_t fade_mask_param;
-        lv_draw_mask_fade_init(&fade_mask_param, &obj->coords, LV_OPA_COVER, (lv_coord_t)(obj->coords.y1 + h / 4), LV_OPA_TRANSP, obj->coords.y2);
-        int16_t fade_mask_id = lv_draw_mask_add(&fade_mask_param, NULL);
-
-        /*Draw a rectangle that will be affected by the mask*/
-        lv_draw_rect_dsc_t draw_rect_dsc;
-        lv_draw_rect_dsc_init(&draw_rect_dsc);
-        draw_rect_dsc.bg_opa = LV_OPA_20;
-        draw_rect_dsc.bg_color = dsc->line_dsc->color;
-
-        lv_area_t a;
-        a.x1 = dsc->p1->x;
-        a.x2 = (lv_coord_t)(dsc->p2->x - 1);
-        a.y1 = LV_MIN(dsc->p1->y, dsc->p2->y);
-        a.y2 = obj->coords.y2;
-        lv_draw_rect(dsc->draw_ctx, &draw_rect_dsc, &a);
-
-        /*Remove the masks*/
-        lv_draw_mask_free_param(&line_mask_param);
-        lv_draw_mask_free_param(&fade_mask_param);
-        lv_draw_mask_remove_id(line_mask_id);
-        lv_draw_mask_remove_id(fade_mask_id);
-    }
-}
\ No newline at end of file
+        /*Skip the segments outside the invalidated area, only the columns of changed points are redrawn*/
+        const lv_area_t * clip_area = dsc->draw_ctx->clip_area;
+        if(dsc->p2->x < clip_area->x1 || dsc->p1->x > clip_area->x2) return;
+
+        lv_coord_t x_start = LV_MAX(dsc->p1->x, clip_area->x1);
+        lv_coord_t x_end = LV_MIN((lv_coord_t)(dsc->p2->x - 1), clip_area->x2);
+        lv_coord_t y_start = LV_MAX(obj->coords.y1, clip_area->y1);
+        lv_coord_t y_end = LV_MIN(obj->coords.y2, clip_area->y2);
+        lv_coord_t dx = (lv_coord_t)(dsc->p2->x - dsc->p1->x);
+        lv_coord_t dy = (lv_coord_t)(dsc->p2->y - dsc->p1->y);
+        if(dx <= 0) return;
+
+        lv_opa_t edge_mask[PEAK_DEMAND_CHART_HEIGHT_PX];
+        lv_draw_sw_blend_dsc_t blend_dsc;
+        lv_area_t column;
+        lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+        blend_dsc.color = dsc->line_dsc->color;
+        blend_dsc.opa = LV_OPA_COVER;
+        blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        blend_dsc.blend_area = &column;
+        blend_dsc.mask_area = &column;
+
+        for(lv_coord_t x = x_start; x <= x_end; x++) {
+            /*The line crosses the column between these heights, in 1/256 px*/
+            int32_t y_left_256 = dsc->p1->y * 256 + floor_div(dy * (x - dsc->p1->x) * 256, dx);
+            int32_t y_right_256 = dsc->p1->y * 256 + floor_div(dy * (x + 1 - dsc->p1->x) * 256, dx);
+            int32_t y_top_256 = LV_MIN(y_left_256, y_right_256);
+            int32_t y_bottom_256 = LV_MAX(y_left_256, y_right_256);
+
+            /*The rows crossed by the line are partly covered, the rows below it are fully covered*/
+            lv_coord_t y_full = (lv_coord_t)floor_div(y_bottom_256 + 255, 256);
+            column.x1 = x;
+            column.x2 = x;
+
+            /*Anti-alias the crossed rows, like the line mask of the LVGL example*/
+            column.y1 = LV_MAX((lv_coord_t)floor_div(y_top_256, 256), y_start);
+            column.y2 = LV_MIN((lv_coord_t)(y_full - 1), y_end);
+            if(column.y1 <= column.y2) {
+                for(lv_coord_t y = column.y1; y <= column.y2; y++) {
+                    int32_t coverage = get_coverage_below_line(y_top_256, y_bottom_256, y);
+                    edge_mask[y - column.y1] = (lv_opa_t)((peak_demand_chart_fade_strip[y - obj->coords.y1] * coverage) >> 8);
+                }
+                blend_dsc.mask_buf = edge_mask;
+                lv_draw_sw_blend(dsc->draw_ctx, &blend_dsc);
+            }
+
+            column.y1 = LV_MAX(y_full, y_start);
+            column.y2 = y_end;
+            if(column.y1 > column.y2) continue;
+
+            /*The strip starts at the top of the chart, the mask area is the column itself*/
+            blend_dsc.mask_buf = &peak_demand_chart_fade_strip[column.y1 - obj->coords.y1];
+            lv_draw_sw_blend(dsc->draw_ctx, &blend_dsc);
+        }
+    }
+}
+
+/**
+ * @brief Calculate the part of a pixel of a column below a line that crosses the column
+ *
+ * The line goes straight from one side of the column to the other, between y_top_256 and y_bottom_256.
+ * The result is the mean over the column of the part of the row below the line.
+ *
+ * @param[in] y_top_256 The highest point of the line in the column, in 1/256 px
+ * @param[in] y_bottom_256 The lowest point of the line in the column, in 1/256 px
+ * @param[in] y The row of the pixel
+ * @return The coverage, 0 (above the line) to 256 (below the line)
+ */
+static int32_t get_coverage_below_line(int32_t y_top_256, int32_t y_bottom_256, lv_coord_t y) {
+    int32_t row_top_256 = y * 256;
+
+    if(y_top_256 == y_bottom_256) {
+        return LV_CLAMP(0, row_top_256 + 256 - y_top_256, 256);
+    }
+
+    /*The integral of the coverage over the heights of the line, from y_top_256 to y_bottom_256*/
+    int32_t area_top = get_coverage_integral(row_top_256, y_top_256);
+    int32_t area_bottom = get_coverage_integral(row_top_256, y_bottom_256);
+    return (area_bottom - area_top) * 256 / (y_bottom_256 - y_top_256);
+}
+
+/**
+ * @brief Integral of the coverage of a row below a horizontal line, over the height of the line
+ *
+ * The coverage is 256 for a line above the row, 0 for a line below it, and falls linearly within the row.
+ *
+ * @param[in] row_top_256 The top of the row, in 1/256 px
+ * @param[in] y_256 The height of the line up to which is integrated, in 1/256 px
+ * @return The integral, in 1/256 px (256 for a line height of one pixel above the row)
+ */
+static int32_t get_coverage_integral(int32_t row_top_256, int32_t y_256) {
+    int32_t depth = LV_CLAMP(0, y_256 - row_top_256, 256);
+
+    return LV_MIN(y_256, row_top_256) + depth - depth * depth / 512;
+}
+
+/**
+ * @brief Integer division rounded down, also for a negative numerator (C division truncates toward zero)
+ *
+ * @param[in] numerator The numerator
+ * @param[in] denominator The denominator, must be positive
+ * @return The quotient, rounded down
+ */
+static int32_t floor_div(int32_t numerator, int32_t denominator) {
+    if (numerator >= 0) {
+        return numerator / denominator;
+    }
+    return -((-numerator + denominator - 1) / denominator);
+}
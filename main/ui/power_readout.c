@@ -0,0 +1,327 @@
+/**
+ * @file power_readout.c
+ * @brief Power readout drawn from pre-rendered sprites
+ *
+ * The power readout shows the current power in the large roboto_bold_70 font, and changes with every sample.
+ * As a label, every redraw decompresses the glyphs from the font data and blends them.
+ * Instead, the digits, the decimal point and the units are rendered once at boot into RGB565 sprites,
+ * on the background color and in both the normal and the alarm color. Drawing the readout only copies the sprites.
+ * The alarm color is selected by the alarm state of the readout object (THEME_STATE_ALARM).
+ *
+ * The sprites are rendered by LVGL itself (on a canvas), with the same fonts and colors as labels.
+ * A digit sprite is a full character cell (advance width rounded to a pixel, like LVGL does, x line height).
+ * In the font data, every glyph of roboto_bold_70 lies within its cell and neither font has kerning, so the cells are
+ * placed next to each other like a label places the glyphs.
+ * Whether the readout matches the labels pixel for pixel has not been checked against LVGL yet.
+ * simulator/scripts/power_readout.sim is that check, it compares the readout with labels placed like the labels it
+ * replaces (power_readout_show_labels(), simulator only).
+ * The layout matches a number label aligned to the center of the readout, with the unit label aligned to its bottom right.
+ *
+ * @note The sprites include the background, the readout must be placed on a solid background of bg_color.
+ * @note There is only one readout, the sprites are shared.
+ */
+
+#include <string.h>
+#include <assert.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "power_readout.h"
+
+#define NUMBER_X_OFS_PX -10     // Horizontal offset of the number from the center of the readout
+#define UNIT_GAP_PX 10          // Space between the number and the unit
+#define NUMBER_GLYPHS ".0123456789"
+#define NUMBER_GLYPH_COUNT (sizeof(NUMBER_GLYPHS) - 1)
+
+typedef enum {
+    SPRITE_COLOR_NORMAL,
+    SPRITE_COLOR_ALARM,
+    SPRITE_COLOR_COUNT,
+} sprite_color_t;
+
+typedef struct {
+    lv_coord_t w;
+    lv_coord_t h;
+    lv_color_t * pixels[SPRITE_COLOR_COUNT];
+} sprite_t;
+
+static const char * TAG = "power_readout";
+static const char * const unit_texts[POWER_READOUT_UNIT_COUNT] = {"W", "kW"};
+
+// Static variables
+static lv_obj_t * readout;
+static sprite_t number_sprites[NUMBER_GLYPH_COUNT];
+static sprite_t unit_sprites[POWER_READOUT_UNIT_COUNT];
+static char readout_number[POWER_READOUT_MAX_CHARS + 1] = "0";
+static power_readout_unit_t readout_unit = POWER_READOUT_UNIT_KW;
+#if SIMULATOR
+static lv_color_t label_colors[SPRITE_COLOR_COUNT];
+static lv_obj_t * number_label;                 // Labels shown instead of the sprites, NULL when the sprites are shown
+static lv_obj_t * unit_label;
+#endif
+
+// Fonts
+LV_FONT_DECLARE(roboto_bold_70);
+LV_FONT_DECLARE(roboto_bold_20);
+
+// Function prototypes
+static void render_sprite(sprite_t * sprite, lv_obj_t * canvas, const lv_font_t * font, const char * text, const lv_color_t colors[], lv_color_t bg_color);
+static const sprite_t * get_number_sprite(char c);
+static void get_readout_area(lv_area_t * area);
+static void blit_sprite(lv_draw_ctx_t * draw_ctx, const sprite_t * sprite, sprite_color_t color, lv_coord_t x, lv_coord_t y);
+static void draw_event_cb(lv_event_t * e);
+
+/**
+ * @brief Create the power readout, and render its sprites
+ *
+ * The readout is as wide as the parent and as high as a line of the number font, align it vertically with lv_obj_align().
+ *
+ * @param[in] parent The parent object
+ * @param[in] color The text color
+ * @param[in] alarm_color The text color when the alarm is shown
+ * @param[in] bg_color The background color of the parent
+ * @return The readout object
+ */
+lv_obj_t * power_readout_create(lv_obj_t * parent, lv_color_t color, lv_color_t alarm_color, lv_color_t bg_color) {
+    const lv_color_t colors[SPRITE_COLOR_COUNT] = {color, alarm_color};
+    char glyph[2] = {0};
+
+    assert(readout == NULL);
+
+    // Render the sprites on a temporary canvas
+    lv_obj_t * canvas = lv_canvas_create(parent);
+    for (uint8_t i = 0; i < NUMBER_GLYPH_COUNT; i++) {
+        glyph[0] = NUMBER_GLYPHS[i];
+        render_sprite(&number_sprites[i], canvas, &roboto_bold_70, glyph, colors, bg_color);
+    }
+    for (uint8_t i = 0; i < POWER_READOUT_UNIT_COUNT; i++) {
+        render_sprite(&unit_sprites[i], canvas, &roboto_bold_20, unit_texts[i], colors, bg_color);
+    }
+    lv_obj_del(canvas);
+#if SIMULATOR
+    memcpy(label_colors, colors, sizeof(label_colors));
+#endif
+
+    readout = lv_obj_create(parent);
+    lv_obj_remove_style_all(readout);
+    lv_obj_set_size(readout, LV_PCT(100), lv_font_get_line_height(&roboto_bold_70));
+    lv_obj_clear_flag(readout, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(readout, draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    return readout;
+}
+
+/**
+ * @brief Set the shown value
+ *
+ * Only the area of the old and the new value is redrawn, and nothing if the value did not change.
+ *
+ * @param[in] number The number, only digits and '.' are shown
+ * @param[in] unit The unit
+ */
+void power_readout_set_value(const char * number, power_readout_unit_t unit) {
+    lv_area_t area;
+
+    assert(unit < POWER_READOUT_UNIT_COUNT);
+
+    if (unit == readout_unit && strncmp(number, readout_number, POWER_READOUT_MAX_CHARS) == 0) {
+        return;
+    }
+
+    get_readout_area(&area);
+    lv_obj_invalidate_area(readout, &area);
+
+    if (strlen(number) > POWER_READOUT_MAX_CHARS) {
+        UI_LOGW(TAG, "Number %s is too long", number);
+    }
+    strncpy(readout_number, number, POWER_READOUT_MAX_CHARS);
+    readout_unit = unit;
+
+    get_readout_area(&area);
+    lv_obj_invalidate_area(readout, &area);
+}
+
+/**
+ * @brief Show the readout in the alarm color or the normal color
+ *
+ * Sets or clears the alarm state (THEME_STATE_ALARM) of the readout. The readout has no styles, so LVGL does not
+ * invalidate it when the state changes, only the area of the value is invalidated here.
+ *
+ * @param[in] alarm true to show the alarm color
+ */
+void power_readout_set_alarm(bool alarm) {
+    lv_area_t area;
+
+    if (alarm == lv_obj_has_state(readout, THEME_STATE_ALARM)) {
+        return;
+    }
+
+    if (alarm) {
+        lv_obj_add_state(readout, THEME_STATE_ALARM);
+    }
+    else {
+        lv_obj_clear_state(readout, THEME_STATE_ALARM);
+    }
+    get_readout_area(&area);
+    lv_obj_invalidate_area(readout, &area);
+}
+
+/**
+ * @brief Render a text into a sprite, in all colors
+ *
+ * @param[out] sprite The sprite
+ * @param[in] canvas The canvas used to render
+ * @param[in] font The font
+ * @param[in] text The text
+ * @param[in] colors The text colors, SPRITE_COLOR_COUNT items
+ * @param[in] bg_color The background color
+ */
+static void render_sprite(sprite_t * sprite, lv_obj_t * canvas, const lv_font_t * font, const char * text, const lv_color_t colors[], lv_color_t bg_color) {
+    lv_draw_label_dsc_t label_dsc;
+
+    sprite->w = (lv_coord_t)lv_txt_get_width(text, strlen(text), font, 0, LV_TEXT_FLAG_NONE);
+    sprite->h = lv_font_get_line_height(font);
+
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.font = font;
+
+    for (uint8_t i = 0; i < SPRITE_COLOR_COUNT; i++) {
+        sprite->pixels[i] = ui_alloc_large(sprite->w * sprite->h * sizeof(lv_color_t));
+        LV_ASSERT_MALLOC(sprite->pixels[i]);
+
+        label_dsc.color = colors[i];
+        lv_canvas_set_buffer(canvas, sprite->pixels[i], sprite->w, sprite->h, LV_IMG_CF_TRUE_COLOR);
+        lv_canvas_fill_bg(canvas, bg_color, LV_OPA_COVER);
+        lv_canvas_draw_text(canvas, 0, 0, sprite->w, &label_dsc, text);
+    }
+}
+
+/**
+ * @brief Get the sprite of a character of the number
+ *
+ * @param[in] c The character
+ * @return The sprite, NULL if the character has no sprite
+ */
+static const sprite_t * get_number_sprite(char c) {
+    const char * pos = c != '\0' ? strchr(NUMBER_GLYPHS, c) : NULL;
+
+    return pos != NULL ? &number_sprites[pos - NUMBER_GLYPHS] : NULL;
+}
+
+/**
+ * @brief Get the area covered by the number and the unit
+ *
+ * @param[out] area The area, in screen coordinates
+ */
+static void get_readout_area(lv_area_t * area) {
+    const sprite_t * unit_sprite = &unit_sprites[readout_unit];
+    lv_coord_t number_w = 0;
+
+    for (const char * c = readout_number; *c != '\0'; c++) {
+        const sprite_t * sprite = get_number_sprite(*c);
+        if (sprite != NULL) {
+            number_w += sprite->w;
+        }
+    }
+
+    // Same position as a label of number_w wide, aligned to the center with NUMBER_X_OFS_PX
+    area->x1 = (lv_coord_t)(readout->coords.x1 + lv_obj_get_width(readout) / 2 - number_w / 2 + NUMBER_X_OFS_PX);
+    area->y1 = readout->coords.y1;
+    area->x2 = (lv_coord_t)(area->x1 + number_w + UNIT_GAP_PX + unit_sprite->w - 1);
+    area->y2 = readout->coords.y2;
+}
+
+/**
+ * @brief Copy a sprite to the draw buffer
+ *
+ * @param[in] draw_ctx The draw context
+ * @param[in] sprite The sprite
+ * @param[in] color The color of the sprite to copy
+ * @param[in] x The x coordinate of the top left corner
+ * @param[in] y The y coordinate of the top left corner
+ */
+static void blit_sprite(lv_draw_ctx_t * draw_ctx, const sprite_t * sprite, sprite_color_t color, lv_coord_t x, lv_coord_t y) {
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_area_t area = {x, y, (lv_coord_t)(x + sprite->w - 1), (lv_coord_t)(y + sprite->h - 1)};
+
+    // Without mask and opacity, blending a source buffer only copies the rows inside the clip area
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &area;
+    blend_dsc.src_buf = sprite->pixels[color];
+    blend_dsc.opa = LV_OPA_COVER;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+}
+
+/**
+ * @brief Draw the readout
+ *
+ * @note Uses the software renderer directly (lv_draw_sw_blend)
+ *
+ * @param e
+ */
+static void draw_event_cb(lv_event_t * e) {
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    const sprite_t * unit_sprite = &unit_sprites[readout_unit];
+    sprite_color_t color = lv_obj_has_state(readout, THEME_STATE_ALARM) ? SPRITE_COLOR_ALARM : SPRITE_COLOR_NORMAL;
+    lv_area_t area;
+
+#if SIMULATOR
+    if (number_label != NULL) {
+        return;
+    }
+#endif
+    get_readout_area(&area);
+    if (!_lv_area_is_on(&area, draw_ctx->clip_area)) {
+        return;
+    }
+
+    lv_coord_t x = area.x1;
+    for (const char * c = readout_number; *c != '\0'; c++) {
+        const sprite_t * sprite = get_number_sprite(*c);
+        if (sprite != NULL) {
+            blit_sprite(draw_ctx, sprite, color, x, area.y1);
+            x += sprite->w;
+        }
+    }
+
+    // Aligned to the bottom of the number
+    blit_sprite(draw_ctx, unit_sprite, color, (lv_coord_t)(x + UNIT_GAP_PX), (lv_coord_t)(area.y2 + 1 - unit_sprite->h));
+}
+
+#if SIMULATOR
+/**
+ * @brief Show the value with labels instead of the sprites, to compare both in the simulator
+ *
+ * The labels are placed like the labels the readout replaces: the number aligned to the center of the readout with
+ * NUMBER_X_OFS_PX, the unit aligned to its bottom right with UNIT_GAP_PX. They show the value and color at the time of
+ * the call, and are not updated.
+ *
+ * @param[in] show true to show the labels, false to show the sprites again
+ */
+void power_readout_show_labels(bool show) {
+    lv_color_t color = label_colors[lv_obj_has_state(readout, THEME_STATE_ALARM) ? SPRITE_COLOR_ALARM : SPRITE_COLOR_NORMAL];
+
+    if (number_label != NULL) {
+        lv_obj_del(number_label);
+        lv_obj_del(unit_label);
+        number_label = NULL;
+        unit_label = NULL;
+    }
+    lv_obj_invalidate(readout);
+    if (!show) {
+        return;
+    }
+
+    number_label = lv_label_create(readout);
+    lv_obj_set_style_text_color(number_label, color, LV_PART_MAIN);
+    lv_obj_set_style_text_font(number_label, &roboto_bold_70, LV_PART_MAIN);
+    lv_label_set_text(number_label, readout_number);
+    lv_obj_align(number_label, LV_ALIGN_CENTER, NUMBER_X_OFS_PX, 0);
+
+    unit_label = lv_label_create(readout);
+    lv_obj_set_style_text_color(unit_label, color, LV_PART_MAIN);
+    lv_obj_set_style_text_font(unit_label, &roboto_bold_20, LV_PART_MAIN);
+    lv_label_set_text(unit_label, unit_texts[readout_unit]);
+    lv_obj_align_to(unit_label, number_label, LV_ALIGN_OUT_RIGHT_BOTTOM, UNIT_GAP_PX, 0);
+}
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file profiler_overlay.c
+ * @brief Frame profiler overlay
+ *
+ * A debug overlay on the main screen, showing the frame statistics of the display (see ui_frame_stats_t).
+ * The overlay is hidden by default, ui_toggle_profiler_overlay() shows or hides it (button chord, see ui_task.c).
+ * The statistics are pushed every second with ui_set_frame_stats(), the overlay is only redrawn while it is shown.
+ * It also shows the average demand and the predicted peak calculated on the device next to the values of the server
+ * (ui_set_demand_comparison()), the main screen only shows one predicted peak.
+ *
+ * @note The overlay is drawn with a translucent background, which makes the frames it covers slower to render.
+ */
+
+#include <stdio.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "profiler_overlay.h"
+
+// LVGL objects
+static lv_obj_t * overlay_label;
+
+// Static variables
+static ui_frame_stats_t shown_stats = {0};
+static ui_demand_comparison_t shown_demand = {0, 0, UI_DEMAND_UNKNOWN, UI_DEMAND_UNKNOWN};
+
+// Function prototypes
+static void update_overlay(void);
+static void format_cpu_load(char * buf, size_t size, uint8_t load);
+static void format_demand(char * buf, size_t size, uint16_t demand);
+
+/**
+ * @brief Create the profiler overlay, hidden
+ *
+ * @param[in] parent The screen the overlay is shown on
+ */
+void profiler_overlay_create(lv_obj_t * parent) {
+    overlay_label = lv_label_create(parent);
+    lv_obj_align(overlay_label, LV_ALIGN_TOP_LEFT, 5, 25);
+    lv_obj_add_style(overlay_label, &theme_style_overlay, LV_PART_MAIN);
+    lv_obj_add_style(overlay_label, &theme_style_text_light, LV_PART_MAIN);
+    lv_obj_add_style(overlay_label, &theme_style_text_small, LV_PART_MAIN);
+    lv_obj_clear_flag(overlay_label, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+    update_overlay();
+}
+
+/**
+ * @brief Set the frame statistics shown in the overlay
+ *
+ * @param[in] stats The statistics of the last period
+ */
+void ui_set_frame_stats(const ui_frame_stats_t * stats) {
+    shown_stats = *stats;
+    if (overlay_label != NULL && !lv_obj_has_flag(overlay_label, LV_OBJ_FLAG_HIDDEN)) {
+        update_overlay();
+    }
+}
+
+/**
+ * @brief Set the local and server demand values shown in the overlay
+ *
+ * @param[in] demand The values, UI_DEMAND_UNKNOWN for the values that are not available
+ */
+void ui_set_demand_comparison(const ui_demand_comparison_t * demand) {
+    shown_demand = *demand;
+    if (overlay_label != NULL && !lv_obj_has_flag(overlay_label, LV_OBJ_FLAG_HIDDEN)) {
+        update_overlay();
+    }
+}
+
+/**
+ * @brief Show the profiler overlay if it is hidden, hide it otherwise
+ *
+ * @note Does nothing before the main screen is initialized
+ */
+void ui_toggle_profiler_overlay(void) {
+    if (overlay_label == NULL) {
+        return;
+    }
+
+    if (lv_obj_has_flag(overlay_label, LV_OBJ_FLAG_HIDDEN)) {
+        update_overlay();
+        lv_obj_clear_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+    }
+    else {
+        lv_obj_add_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * @brief Show shown_stats and shown_demand in the overlay
+ *
+ * @uses shown_stats, shown_demand, overlay_label
+ */
+static void update_overlay(void) {
+    char cpu0[8];
+    char cpu1[8];
+    char demand[4][8];
+
+    format_cpu_load(cpu0, sizeof(cpu0), shown_stats.cpu_load[0]);
+    format_cpu_load(cpu1, sizeof(cpu1), shown_stats.cpu_load[1]);
+    format_demand(demand[0], sizeof(demand[0]), shown_demand.local_avg_w);
+    format_demand(demand[1], sizeof(demand[1]), shown_demand.server_avg_w);
+    format_demand(demand[2], sizeof(demand[2]), shown_demand.local_predicted_w);
+    format_demand(demand[3], sizeof(demand[3]), shown_demand.server_predicted_w);
+
+    // LVGL's printf has no float support, print the fractions as integers
+    lv_label_set_text_fmt(overlay_label,
+                          "FPS %u.%u\n"
+                          "render %lu.%lu ms\n"
+                          "flush %lu.%lu ms\n"
+                          "wait %lu.%lu ms\n"
+                          "areas %u, %lu B\n"
+                          "CPU %s %s\n"
+                          "avg dev %s srv %s W\n"
+                          "peak dev %s srv %s W",
+                          shown_stats.fps_x10 / 10, shown_stats.fps_x10 % 10,
+                          (unsigned long)(shown_stats.render_us / 1000), (unsigned long)(shown_stats.render_us % 1000 / 100),
+                          (unsigned long)(shown_stats.flush_us / 1000), (unsigned long)(shown_stats.flush_us % 1000 / 100),
+                          (unsigned long)(shown_stats.wait_us / 1000), (unsigned long)(shown_stats.wait_us % 1000 / 100),
+                          shown_stats.areas, (unsigned long)shown_stats.flush_bytes,
+                          cpu0, cpu1,
+                          demand[0], demand[1], demand[2], demand[3]);
+}
+
+/**
+ * @brief Format the load of a CPU core
+ *
+ * @param[out] buf The text
+ * @param[in] size The size of buf
+ * @param[in] load The load in percent, or UI_FRAME_STATS_CPU_LOAD_UNKNOWN
+ */
+static void format_cpu_load(char * buf, size_t size, uint8_t load) {
+    if (load == UI_FRAME_STATS_CPU_LOAD_UNKNOWN) {
+        snprintf(buf, size, "-");
+    }
+    else {
+        snprintf(buf, size, "%u%%", load);
+    }
+}
+
+/**
+ * @brief Format a demand value
+ *
+ * @param[out] buf The text
+ * @param[in] size The size of buf
+ * @param[in] demand The demand in W, or UI_DEMAND_UNKNOWN
+ */
+static void format_demand(char * buf, size_t size, uint16_t demand) {
+    if (demand == UI_DEMAND_UNKNOWN) {
+        snprintf(buf, size, "-");
+    }
+    else {
+        snprintf(buf, size, "%u", demand);
+    }
+}
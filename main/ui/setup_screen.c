@@ -5,6 +5,9 @@
  * to a Wi-Fi network and to a KWARTIWI P1 server.
  * When the setup is done, the device will reboot.
  *
+ * The screen is only needed before the device is provisioned. It is built when it is loaded (setup_screen_load()),
+ * and deleted when another screen is loaded, so it does not use LVGL memory during normal operation.
+ *
  * @todo Implement the reload button for the Wi-Fi network and the server list
  * @todo Improve the "Wrapping up" screen (showing the user that the configuration is being saved and the device is rebooting)
  * @todo Use better icons for the welcome and wrapping up screen
@@ -75,6 +78,7 @@ static lv_obj_t * welcome_label;
 static setup_state_t current_state = STATE_WELCOME;
 
 // Function prototypes
+static void setup_screen_init(void);
 static void show_state(setup_state_t state);
 static void navigation_event_cb(lv_event_t * event);
 static void passphrase_event_cb(lv_event_t * event);
@@ -82,16 +86,32 @@ static void select_network_finished(void);
 static void network_pass_finished(void);
 static void server_select_finished(void);
 static void save_config(void);
+static void screen_unloaded_event_cb(lv_event_t * event);
+static void screen_delete_event_cb(lv_event_t * event);
+
+/**
+ * @brief Build the setup screen if needed, and load it
+ */
+void setup_screen_load(void)
+{
+    if (!setup_screen_initialized) {
+        setup_screen_init();
+    }
+    lv_disp_load_scr(setup_screen);
+}
 
 /**
  * @brief Initialize the setup screen
+ *
+ * @note The screen deletes itself when it is unloaded
  */
-void setup_screen_init(void)
+static void setup_screen_init(void)
 {
     setup_screen = lv_obj_create(NULL);
     lv_obj_clear_flag(setup_screen, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_color(setup_screen, COLOR_WHITE, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(setup_screen, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_event_cb(setup_screen, screen_unloaded_event_cb, LV_EVENT_SCREEN_UNLOADED, NULL);
+    lv_obj_add_event_cb(setup_screen, screen_delete_event_cb, LV_EVENT_DELETE, NULL);
+    lv_obj_add_style(setup_screen, &theme_style_screen_light, LV_PART_MAIN);
 
     // Title
     title_label = lv_label_create(setup_screen);
@@ -109,11 +129,8 @@ void setup_screen_init(void)
     lv_obj_set_align(progress_bar, LV_ALIGN_TOP_MID);
     lv_obj_set_x(progress_bar, 0);
     lv_obj_set_y(progress_bar, 25);
-    lv_obj_set_style_bg_color(progress_bar, COLOR_KWARTIWI_GREY, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(progress_bar, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(progress_bar, COLOR_KWARTIWI_ORANGE, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_color(progress_bar, COLOR_KWARTIWI_RED , LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_dir(progress_bar, LV_GRAD_DIR_HOR, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(progress_bar, &theme_style_progress_bar, LV_PART_MAIN);
+    lv_obj_add_style(progress_bar, &theme_style_progress_bar_indicator, LV_PART_INDICATOR);
     lv_bar_set_value(progress_bar, 100, LV_ANIM_OFF);
 
     // Icon
@@ -133,7 +150,7 @@ void setup_screen_init(void)
     lv_obj_set_align(instruction_label, LV_ALIGN_CENTER);
     lv_obj_set_x(instruction_label, 0);
     lv_obj_set_y(instruction_label, -50);
-    lv_obj_set_style_text_align(instruction_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(instruction_label, &theme_style_text_center, LV_PART_MAIN);
     lv_label_set_text(instruction_label, INSTRUCTION_SSID_SELECT_TEXT);
 
     // Reload icon
@@ -154,10 +171,8 @@ void setup_screen_init(void)
     lv_obj_set_x(next_btn, -10);
     lv_obj_set_y(next_btn, -10);
     lv_obj_clear_flag(next_btn, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_opa(next_btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(next_btn, 1, LV_PART_MAIN | LV_STATE_FOCUSED);
-    lv_obj_set_style_border_width(next_btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_shadow_width(next_btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(next_btn, &theme_style_transparent, LV_PART_MAIN);
+    lv_obj_add_style(next_btn, &theme_style_focus_border, LV_PART_MAIN | LV_STATE_FOCUSED);
     lv_obj_add_event_cb(next_btn, navigation_event_cb, LV_EVENT_CLICKED, NULL);
 
     // Next label
@@ -166,8 +181,8 @@ void setup_screen_init(void)
     lv_obj_set_height(next_label, LV_SIZE_CONTENT);
     lv_obj_set_align(next_label, LV_ALIGN_CENTER);
     lv_label_set_text(next_label, ">");
-    lv_obj_set_style_text_color(next_label, COLOR_KWARTIWI_ORANGE, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(next_label, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(next_label, &theme_style_text_accent, LV_PART_MAIN);
+    lv_obj_add_style(next_label, &theme_style_text_large, LV_PART_MAIN);
 
     // Prev button
     prev_btn = lv_btn_create(setup_screen);
@@ -177,10 +192,8 @@ void setup_screen_init(void)
     lv_obj_set_x(prev_btn, 10);
     lv_obj_set_y(prev_btn, -10);
     lv_obj_clear_flag(prev_btn, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_opa(prev_btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(prev_btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(prev_btn, 1, LV_PART_MAIN | LV_STATE_FOCUSED);
-    lv_obj_set_style_shadow_width(prev_btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(prev_btn, &theme_style_transparent, LV_PART_MAIN);
+    lv_obj_add_style(prev_btn, &theme_style_focus_border, LV_PART_MAIN | LV_STATE_FOCUSED);
     lv_obj_add_event_cb(prev_btn, navigation_event_cb, LV_EVENT_CLICKED, NULL);
 
     // Prev label
@@ -189,8 +202,8 @@ void setup_screen_init(void)
     lv_obj_set_height(prev_label, LV_SIZE_CONTENT);
     lv_obj_set_align(prev_label, LV_ALIGN_CENTER);
     lv_label_set_text(prev_label, "<");
-    lv_obj_set_style_text_color(prev_label, COLOR_KWARTIWI_ORANGE, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(prev_label, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(prev_label, &theme_style_text_accent, LV_PART_MAIN);
+    lv_obj_add_style(prev_label, &theme_style_text_large, LV_PART_MAIN);
 
     // Wi-Fi network selector
     selection_roller = lv_roller_create(setup_screen);
@@ -200,7 +213,7 @@ void setup_screen_init(void)
     lv_obj_set_align(selection_roller, LV_ALIGN_CENTER);
     lv_obj_set_x(selection_roller, 0);
     lv_obj_set_y(selection_roller, 40);
-    lv_obj_set_style_bg_color(selection_roller, COLOR_KWARTIWI_BLUE, LV_PART_SELECTED | LV_STATE_DEFAULT);
+    lv_obj_add_style(selection_roller, &theme_style_roller_selected, LV_PART_SELECTED);
 
     // Wi-Fi network password text area
     wifi_network_pass_text_area = lv_textarea_create(setup_screen);
@@ -221,8 +234,8 @@ void setup_screen_init(void)
     lv_obj_set_height(network_name_label, LV_SIZE_CONTENT);
     lv_obj_set_align(network_name_label, LV_ALIGN_CENTER);
     lv_obj_align_to(network_name_label, wifi_network_pass_text_area, LV_ALIGN_OUT_TOP_MID, 0, -10);
-    lv_obj_set_style_text_color(network_name_label, COLOR_KWARTIWI_BLUE, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(network_name_label, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(network_name_label, &theme_style_text_highlight, LV_PART_MAIN);
+    lv_obj_add_style(network_name_label, &theme_style_text_medium, LV_PART_MAIN);
     lv_label_set_text(network_name_label, "Network name");
 
     // Keyboard
@@ -248,6 +261,7 @@ void setup_screen_init(void)
     lv_obj_set_width(status_label, LV_SIZE_CONTENT);
     lv_obj_set_height(status_label, LV_SIZE_CONTENT);
     lv_obj_set_align(status_label, LV_ALIGN_CENTER);
+    lv_obj_add_style(status_label, &theme_style_text_alarm, LV_PART_MAIN | THEME_STATE_ALARM);
     lv_label_set_text(status_label, "");
 
     // Welcome label
@@ -256,7 +270,7 @@ void setup_screen_init(void)
 //    lv_obj_set_height(welcome_label, LV_SIZE_CONTENT);
     lv_obj_align(welcome_label, LV_ALIGN_CENTER , 0, 30);
     lv_label_set_long_mode(welcome_label, LV_LABEL_LONG_WRAP);
-    lv_obj_set_style_text_align(welcome_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(welcome_label, &theme_style_text_center, LV_PART_MAIN);
     lv_label_set_text(welcome_label, WELCOME_TEXT);
 
     // Show the welcome screen
@@ -265,6 +279,46 @@ void setup_screen_init(void)
     setup_screen_initialized = true;
 }
 
+/**
+ * @brief Callback for when another screen is loaded, delete the setup screen
+ *
+ * @param[in] event unused
+ */
+static void screen_unloaded_event_cb(lv_event_t * event) {
+    // The screen can not be deleted from its own event
+    lv_obj_del_async(setup_screen);
+}
+
+/**
+ * @brief Callback for when the setup screen is deleted, reset the state of the screen
+ *
+ * The widgets are deleted with the screen, the entered configuration is cleared.
+ *
+ * @param[in] event unused
+ */
+static void screen_delete_event_cb(lv_event_t * event) {
+    setup_screen_initialized = false;
+    setup_screen = NULL;
+    title_label = NULL;
+    progress_bar = NULL;
+    instruction_icon_img = NULL;
+    instruction_label = NULL;
+    reload_symbol_img = NULL;
+    next_btn = NULL;
+    next_label = NULL;
+    prev_btn = NULL;
+    prev_label = NULL;
+    selection_roller = NULL;
+    wifi_network_pass_text_area = NULL;
+    keyboard = NULL;
+    network_name_label = NULL;
+    loading_spinner = NULL;
+    status_label = NULL;
+    welcome_label = NULL;
+    current_state = STATE_WELCOME;
+    memset(&config, 0, sizeof(config));
+}
+
 /**
  * @brief Hide all UI elements that change between different states
  */
@@ -514,7 +568,7 @@ void setup_screen_wifi_connected_status_cb(const bool connected) {
         current_state = STATE_NETWORK_PASS;
         show_state(current_state);
         lv_label_set_text(status_label, "Failed to connect to network!");
-        lv_obj_set_style_text_color(status_label, COLOR_KWARTIWI_RED, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_add_state(status_label, THEME_STATE_ALARM);
     }
 
     // Show the buttons again
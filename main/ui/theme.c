@@ -0,0 +1,125 @@
+/**
+ * @file theme.c
+ * @brief Shared styles of the UI
+ *
+ * The screens style their objects with these static styles (lv_obj_add_style()), instead of setting local styles
+ * with lv_obj_set_style_*(). Every local style property is stored per object on the LVGL heap, and makes the style
+ * lookups of the object slower. A shared style is stored once, however many objects use it.
+ *
+ * Changes that are shown and hidden, like the alarm color, are prebuilt styles selected by an object state
+ * (THEME_STATE_ALARM), so toggling them does not allocate and only invalidates the objects whose style changes.
+ *
+ * @note theme_init() must be called before any screen is created
+ */
+
+#include <assert.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "theme.h"
+
+#define FOCUS_BORDER_WIDTH_PX 1
+#define SPINNER_ARC_WIDTH_PX 5
+#define OVERLAY_BG_OPA LV_OPA_70
+#define OVERLAY_PAD_PX 3
+
+// Screens
+lv_style_t theme_style_screen_dark;
+lv_style_t theme_style_screen_light;
+
+// Text
+lv_style_t theme_style_text_small;
+lv_style_t theme_style_text_medium;
+lv_style_t theme_style_text_large;
+lv_style_t theme_style_text_center;
+lv_style_t theme_style_text_light;
+lv_style_t theme_style_text_accent;
+lv_style_t theme_style_text_highlight;
+lv_style_t theme_style_text_alarm;
+
+// Widgets
+lv_style_t theme_style_transparent;
+lv_style_t theme_style_focus_border;
+lv_style_t theme_style_spinner;
+lv_style_t theme_style_progress_bar;
+lv_style_t theme_style_progress_bar_indicator;
+lv_style_t theme_style_roller_selected;
+lv_style_t theme_style_overlay;
+
+// Static variables
+static bool theme_initialized = false;
+
+/**
+ * @brief Initialize the shared styles
+ *
+ * @note The styles are never freed, call this function only once
+ */
+void theme_init(void) {
+    assert(!theme_initialized);
+
+    // Screens
+    lv_style_init(&theme_style_screen_dark);
+    lv_style_set_bg_color(&theme_style_screen_dark, THEME_COLOR_DARK_BG);
+    lv_style_set_bg_opa(&theme_style_screen_dark, LV_OPA_COVER);
+
+    lv_style_init(&theme_style_screen_light);
+    lv_style_set_bg_color(&theme_style_screen_light, COLOR_WHITE);
+    lv_style_set_bg_opa(&theme_style_screen_light, LV_OPA_COVER);
+
+    // Text
+    lv_style_init(&theme_style_text_small);
+    lv_style_set_text_font(&theme_style_text_small, &lv_font_montserrat_12);
+
+    lv_style_init(&theme_style_text_medium);
+    lv_style_set_text_font(&theme_style_text_medium, &lv_font_montserrat_14);
+
+    lv_style_init(&theme_style_text_large);
+    lv_style_set_text_font(&theme_style_text_large, &lv_font_montserrat_20);
+
+    lv_style_init(&theme_style_text_center);
+    lv_style_set_text_align(&theme_style_text_center, LV_TEXT_ALIGN_CENTER);
+
+    lv_style_init(&theme_style_text_light);
+    lv_style_set_text_color(&theme_style_text_light, THEME_COLOR_DARK_TEXT);
+
+    lv_style_init(&theme_style_text_accent);
+    lv_style_set_text_color(&theme_style_text_accent, COLOR_KWARTIWI_ORANGE);
+
+    lv_style_init(&theme_style_text_highlight);
+    lv_style_set_text_color(&theme_style_text_highlight, COLOR_KWARTIWI_BLUE);
+
+    lv_style_init(&theme_style_text_alarm);
+    lv_style_set_text_color(&theme_style_text_alarm, THEME_COLOR_ALARM);
+
+    // Widgets
+    lv_style_init(&theme_style_transparent);
+    lv_style_set_bg_opa(&theme_style_transparent, LV_OPA_TRANSP);
+    lv_style_set_border_width(&theme_style_transparent, 0);
+    lv_style_set_outline_width(&theme_style_transparent, 0);
+    lv_style_set_outline_pad(&theme_style_transparent, 0);
+    lv_style_set_shadow_width(&theme_style_transparent, 0);
+
+    lv_style_init(&theme_style_focus_border);
+    lv_style_set_border_width(&theme_style_focus_border, FOCUS_BORDER_WIDTH_PX);
+
+    lv_style_init(&theme_style_spinner);
+    lv_style_set_arc_width(&theme_style_spinner, SPINNER_ARC_WIDTH_PX);
+
+    lv_style_init(&theme_style_progress_bar);
+    lv_style_set_bg_color(&theme_style_progress_bar, COLOR_KWARTIWI_GREY);
+    lv_style_set_bg_opa(&theme_style_progress_bar, LV_OPA_COVER);
+
+    lv_style_init(&theme_style_progress_bar_indicator);
+    lv_style_set_bg_color(&theme_style_progress_bar_indicator, COLOR_KWARTIWI_ORANGE);
+    lv_style_set_bg_grad_color(&theme_style_progress_bar_indicator, COLOR_KWARTIWI_RED);
+    lv_style_set_bg_grad_dir(&theme_style_progress_bar_indicator, LV_GRAD_DIR_HOR);
+
+    lv_style_init(&theme_style_roller_selected);
+    lv_style_set_bg_color(&theme_style_roller_selected, COLOR_KWARTIWI_BLUE);
+
+    lv_style_init(&theme_style_overlay);
+    lv_style_set_bg_color(&theme_style_overlay, THEME_COLOR_DARK_BG);
+    lv_style_set_bg_opa(&theme_style_overlay, OVERLAY_BG_OPA);
+    lv_style_set_pad_all(&theme_style_overlay, OVERLAY_PAD_PX);
+
+    theme_initialized = true;
+}
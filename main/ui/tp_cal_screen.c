@@ -7,9 +7,12 @@
  * It displays a a cross and ask the user to touch it, this is done for 6 points.
  * The points and the raw touch data are then given to the touch panel driver to calculate the calibration matrix and store it in the flash.
  * When the calibration is complete, the main screen is loaded.
+ *
+ * The screen is built when it is loaded, and deleted when another screen is loaded.
  */
 
 #include <stdio.h>
+#include <assert.h>
 #include "lvgl.h"
 #include "ui_task.h"
 #include "ui.h"
@@ -34,6 +37,11 @@ static lv_obj_t * status_label;
 static lv_obj_t * info_label;
 static lv_obj_t * confirm_msg_box;
 
+// Calibration state
+static bool cal_started = false;
+static lv_point_t cal_points[CALIBRATION_POINTS_COUNT];
+static uint8_t cal_point_index = 0;
+
 // Points to be calibrated
 static lv_point_t points[CALIBRATION_POINTS_COUNT] = {
     {40, 50},
@@ -49,32 +57,40 @@ static void tp_cal_screen_init(void);
 static void set_cross_pos(int16_t x, int16_t y);
 static void touched_cb(lv_event_t * event);
 static void confirm_msg_box_cb(lv_event_t * event);
+static void screen_unloaded_event_cb(lv_event_t * event);
+static void screen_delete_event_cb(lv_event_t * event);
 
 
 /**
  * @brief Initialize and load the calibration screen
  */
 void tp_call_load_screen(void) {
-    tp_cal_screen_init();
+    if (tp_cal_screen == NULL) {
+        tp_cal_screen_init();
+    }
     lv_disp_load_scr(tp_cal_screen);
 }
 
 /**
  * @brief Initialize the calibration screen
+ *
+ * @note The screen deletes itself when it is unloaded
  */
 static void tp_cal_screen_init(void) {
     // Screen
     tp_cal_screen = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(tp_cal_screen, lv_color_hex(0xFFFFFF), LV_STATE_DEFAULT);
+    lv_obj_add_style(tp_cal_screen, &theme_style_screen_light, LV_PART_MAIN);
     lv_obj_set_ext_click_area(tp_cal_screen, MAX_TP_DATA_VALUE);
     lv_obj_add_event_cb(tp_cal_screen, touched_cb, LV_EVENT_PRESSED, NULL);
+    lv_obj_add_event_cb(tp_cal_screen, screen_unloaded_event_cb, LV_EVENT_SCREEN_UNLOADED, NULL);
+    lv_obj_add_event_cb(tp_cal_screen, screen_delete_event_cb, LV_EVENT_DELETE, NULL);
 
     // Info label
     info_label = lv_label_create(tp_cal_screen);
     lv_obj_align(info_label, LV_ALIGN_CENTER, 0, 0);
     lv_label_set_long_mode(info_label, LV_LABEL_LONG_WRAP);
     lv_obj_set_width(info_label, LV_HOR_RES - 20);
-    lv_obj_set_style_text_align(info_label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_add_style(info_label, &theme_style_text_center, LV_PART_MAIN);
     lv_label_set_text(info_label, START_CAL_MSG);
 
     // Status label
@@ -136,11 +152,6 @@ static void show_point(uint8_t point) {
  * @param[in] event unused
  */
 static void touched_cb(lv_event_t * event) {
-    static bool cal_started = false;
-    static lv_point_t cal_points[CALIBRATION_POINTS_COUNT];
-    static uint8_t cal_point_index = 0;
-
-
     if (!cal_started) {
         lv_obj_clear_flag(cross_img, LV_OBJ_FLAG_HIDDEN);
         lv_obj_clear_flag(status_label, LV_OBJ_FLAG_HIDDEN);
@@ -215,4 +226,34 @@ static void confirm_msg_box_cb(lv_event_t * event) {
         default:
             break;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Callback for when another screen is loaded, delete the calibration screen
+ *
+ * @param[in] event unused
+ */
+static void screen_unloaded_event_cb(lv_event_t * event) {
+    // The screen can not be deleted from its own event
+    lv_obj_del_async(tp_cal_screen);
+}
+
+/**
+ * @brief Callback for when the calibration screen is deleted, reset the state of the screen
+ *
+ * An unfinished calibration is discarded, the touchscreen input is calibrated again.
+ *
+ * @param[in] event unused
+ */
+static void screen_delete_event_cb(lv_event_t * event) {
+    if (cal_started) {
+        ui_task_use_raw_tp_data(false);
+    }
+    cal_started = false;
+    cal_point_index = 0;
+    tp_cal_screen = NULL;
+    cross_img = NULL;
+    status_label = NULL;
+    info_label = NULL;
+    confirm_msg_box = NULL;
+}
@@ -1,7 +1,6 @@
-#include "esp_log.h"
 #include "lvgl.h"
-#include "data_manager.h"
 #include "ui.h"
+#include "img_decoder.h"
 
 #define CHECK_INIT_PERIOD_MS 100
 #define CHECK_INIT_TIMEOUT_MS 10000
@@ -22,12 +21,15 @@ static void check_loaded(lv_timer_t * timer);
 /**
  * @brief Initialize the UI
  *
- * Show the loading screen until the initialization is complete (ui_set_initialized()) or the timeout is reached, then show the main screen
+ * Show the loading screen until the initialization is complete (ui_set_initialized()) or the timeout is reached, then show the main screen.
+ * If the device is not setup yet, the setup screen is shown instead
  *
  * @note The data manager must be initialized before calling this function
  */
 void ui_init(void) {
     UI_LOGI(TAG, "Initializing UI");
+    img_decoder_init();
+    theme_init();
 
 //    tp_call_load_screen();
 //    return;
@@ -38,20 +40,17 @@ void ui_init(void) {
     lv_disp_load_scr(loading_screen);
 
     setup_completed = ui_is_setup();
-    network_initialized = networking_is_initialized();
+    network_initialized = ui_is_network_initialized();
 
 
     if (ui_is_touchscreen_calibrated() == false) {
         UI_LOGD(TAG, "Touchscreen not calibrated, initializing calibration screen");
         tp_call_load_screen();
+        loading_screen_deinit();
         return;
     }
 
-    if (!setup_completed) {
-        UI_LOGD(TAG, "Setup not completed, initializing setup screen");
-        setup_screen_init();
-    }
-
+    // The main screen is the only permanent screen, the other screens are built when they are shown
     main_screen_init();
     // Periodically check if the initialization is complete, and show the next screen if it is
     loading_screen_timer = lv_timer_create(check_loaded, CHECK_INIT_PERIOD_MS, NULL);
@@ -159,7 +158,7 @@ static void check_loaded(lv_timer_t * timer) {
         if (network_initialized) {
             UI_LOGD(TAG, "Showing setup screen");
             lv_timer_del(loading_screen_timer);
-            lv_disp_load_scr(setup_screen);
+            setup_screen_load();
             loading_screen_deinit();
             counter = 0;
             return;
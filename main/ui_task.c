@@ -4,12 +4,15 @@
  */
 
 #include <sys/cdefs.h>
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_heap_caps.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_commands.h"
 #include "driver/gpio.h"
 #include "esp_err.h"
 #include "esp_log.h"
@@ -18,16 +21,63 @@
 #include "lvgl.h"
 #include "ui.h"
 #include "buzzer.h"
+#include "buttons.h"
 #include "tsc2046.h"
 #include "data_manager.h"
 #include "networking.h"
 #include "web_client.h"
 #include "ui_task.h"
 
+// The LVGL tick is read from esp_timer_get_time() (see sdkconfig.defaults), there is no periodic tick interrupt
+#if !CONFIG_LV_TICK_CUSTOM
+#error "CONFIG_LV_TICK_CUSTOM must be enabled"
+#endif
+
 #define PIXEL_CLOCK_HZ  (10 * 1000 * 1000)  // 10 MHz
-#define LVGL_BUFFER_SIZE (UI_TASK_DISPLAY_WIDTH * UI_TASK_DISPLAY_HEIGHT * sizeof(lv_color_t) / 5) // 1/5 of the display area (at least 1/10 is recommended)
+#define FRAME_BUFFER_SIZE (UI_TASK_DISPLAY_WIDTH * UI_TASK_DISPLAY_HEIGHT * sizeof(lv_color_t))
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_PARTIAL_DOUBLE
+#define LVGL_BUFFER_SIZE (FRAME_BUFFER_SIZE / 5)    // 1/5 of the display area (at least 1/10 is recommended)
+#elif UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+#define LVGL_BUFFER_SIZE FRAME_BUFFER_SIZE
+#elif UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_SINGLE_SMALL
+#define LVGL_BUFFER_SIZE (FRAME_BUFFER_SIZE / 10)   // 1/10 of the display area, the minimum recommended by LVGL
+#else
+#error "Unknown UI_TASK_RENDER_BUFFER_MODE"
+#endif
 #define MAX_TRANSFER_SIZE LVGL_BUFFER_SIZE
 
+// UI_TASK_TE_TIMEOUT_US in ticks, rounded up, plus one tick because the current tick is already partly over.
+// With the default 100 Hz tick this is 20-30 ms, with a 1000 Hz tick 17-18 ms.
+#define TE_TIMEOUT_TICKS ((UI_TASK_TE_TIMEOUT_US + portTICK_PERIOD_MS * 1000 - 1) / (portTICK_PERIOD_MS * 1000) + 1)
+
+#define UI_TASK_DATA_UPDATE_INTERVAL_MS 250                                 // Max rate at which data changes are shown
+#define UI_TASK_SUBSCRIBED_FIELDS (DM_DF_MASK(DM_DF_P1_TIMESTAMP) | \
+                                   DM_DF_MASK(DM_DF_CURRENT_POWER_USAGE) | \
+                                   DM_DF_MASK(DM_DF_CURRENT_AVG_DEMAND) | \
+                                   DM_DF_MASK(DM_DF_LOCAL_AVG_DEMAND) | \
+                                   DM_DF_MASK(DM_DF_PREDICTED_PEAK) | \
+                                   DM_DF_MASK(DM_DF_LOCAL_PREDICTED_PEAK) | \
+                                   DM_DF_MASK(DM_DF_MAX_DEMAND_MONTH) | \
+                                   DM_DF_MASK(DM_DF_MAX_DEMAND_YEAR) | \
+                                   DM_DF_MASK(DM_DF_MAX_DEMAND_SHORT_TERM) | \
+                                   DM_DF_MASK(DM_DF_ENERGY_BUCKETS))
+
+// Totals since boot, from which the frame statistics are computed. The times wrap around, only their differences are used.
+typedef struct {
+    uint32_t render_us;             // Time spent in the display refresh timer, without the waits
+    uint32_t wait_us;               // Time waited for a transfer to finish or for the TE signal
+    volatile uint32_t flush_us;     // Time spent transferring to the display, updated from the transfer done ISR
+    uint32_t areas;                 // Invalidated areas refreshed
+} frame_counters_t;
+
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+// Rows of the frame buffer to send to the display, in direct mode
+typedef struct {
+    lv_coord_t y1;
+    lv_coord_t y2;
+} row_range_t;
+#endif
+
 extern esp_event_loop_handle_t app_loop_handle;
 
 static const char *TAG = "ui_task";
@@ -38,10 +88,30 @@ static lv_disp_drv_t disp_drv;
 static lv_disp_draw_buf_t disp_buf;
 static lv_indev_drv_t buttons_indev_drv;
 static lv_indev_drv_t touch_indev_drv;
-static esp_timer_handle_t lvgl_periodic_timer;
+static lv_indev_t *buttons_indev;
+static lv_indev_t *touch_indev;
+static TaskHandle_t ui_task_handle = NULL;
+static volatile bool touch_wake_pending = false;    // Set by the touch down ISR, the touch read timer must be resumed
+static volatile bool buttons_wake_pending = false;  // Set when button events are queued, the buttons read timer must be resumed
 static bool use_raw_touch_input = false;
 static bool ui_initialized = false;     // Protected by lvgl_mutex
+static ui_task_render_stats_t render_stats = {0};   // Protected by lvgl_mutex
+static ui_frame_stats_t frame_stats = {0};          // Protected by lvgl_mutex
+static frame_counters_t frame_counters = {0};
+static int64_t frame_stats_start_us = 0;            // Start of the current statistics period
+static int64_t flush_start_us = 0;                  // Start of the transfers of the flush in progress
+static volatile uint16_t pending_transfers = 0;     // Transfers of the flush in progress not done yet
 SemaphoreHandle_t lvgl_mutex;           // Mutex for all lvgl and ui related operations
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+static SemaphoreHandle_t te_semaphore;  // Given on every TE signal
+static volatile uint32_t te_count = 0;  // Number of TE signals
+static uint32_t frame_te_count = 0;     // te_count when the current frame started
+static volatile bool frame_last_band = false;   // The band being transferred is the last band of the frame
+static ui_task_te_stats_t te_stats = {0};
+#if UI_TASK_TE_SYNC_MODE == UI_TASK_TE_SYNC_SIMULATED
+static esp_timer_handle_t te_sim_timer;
+#endif
+#endif
 
 // Function prototypes
 static void init_display(void);
@@ -50,14 +120,32 @@ static void free_display(void);
 static void free_lvgl(void);
 static void init_buttons(void);
 static void display_set_backlight(bool on);
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+static void init_te_sync(void);
+static void free_te_sync(void);
+static void wait_for_te(void);
+static void te_signal_handler(void *arg);
+#endif
+static void lvgl_refr_timer_cb(lv_timer_t *timer);
+static void lvgl_wait_cb(lv_disp_drv_t *drv);
+static void frame_stats_timer_cb(lv_timer_t *timer);
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static uint32_t get_idle_run_time(BaseType_t core);
+#endif
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+static uint16_t get_dirty_rows(const lv_disp_t *disp, row_range_t *rows);
+#endif
 static bool color_trans_done_cb(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx);
 static void lvgl_buttons_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
 static void lvgl_buttons_feedback_cb(lv_indev_drv_t *drv, uint8_t event);
 static void lvgl_touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
 static void lvgl_touch_feedback_cb(lv_indev_drv_t *drv, uint8_t event);
-static void lvgl_tick_task(void *arg);
+static void touch_down_handler(void *arg);
+static void buttons_event_handler(void *arg);
+static void resume_indev_read(lv_indev_t *indev);
 static void update_ui_on_event(void* handler_arg, esp_event_base_t base, int32_t id, void* event_data);
+static void update_ui_on_data_change(data_manager_field_mask_t changed_fields, const data_manager_meter_data_t *meter_data, void *arg);
 
 
 /**
@@ -71,6 +159,7 @@ static void update_ui_on_event(void* handler_arg, esp_event_base_t base, int32_t
  */
 _Noreturn void ui_task(void *pvParameters) {
     ESP_LOGI(TAG, "Starting UI task");
+    ui_task_handle = xTaskGetCurrentTaskHandle();
     lvgl_mutex = xSemaphoreCreateMutex();
 
     if (lvgl_mutex == NULL) {
@@ -85,8 +174,18 @@ _Noreturn void ui_task(void *pvParameters) {
     // Initialize the buttons
     init_buttons();
 
+    // Subscribe to the data shown in the UI
+    data_manager_subscription_handle_t subscription_handle;
+    const data_manager_subscription_config_t subscription_config = {
+            .fields = UI_TASK_SUBSCRIBED_FIELDS,
+            .min_interval_ms = UI_TASK_DATA_UPDATE_INTERVAL_MS,
+            .coalesce = true,
+            .callback = update_ui_on_data_change,
+            .arg = NULL,
+    };
+    ESP_ERROR_CHECK(data_manager_subscribe(&subscription_config, &subscription_handle));
+
     // Register event handlers, which will update the UI
-    esp_event_handler_register_with(app_loop_handle, DATA_MANAGER_EVENTS, ESP_EVENT_ANY_ID, update_ui_on_event, NULL);
     esp_event_handler_register_with(app_loop_handle, WEB_CLIENT_EVENTS, ESP_EVENT_ANY_ID, update_ui_on_event, NULL);
     esp_event_handler_register_with(app_loop_handle, NETWORKING_EVENTS, ESP_EVENT_ANY_ID, update_ui_on_event, NULL);
 
@@ -107,10 +206,22 @@ _Noreturn void ui_task(void *pvParameters) {
 
     for(;;) {
         xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-        lv_task_handler();
+        if (touch_wake_pending) {
+            touch_wake_pending = false;
+            resume_indev_read(touch_indev);
+        }
+        if (buttons_wake_pending) {
+            buttons_wake_pending = false;
+            resume_indev_read(buttons_indev);
+        }
+        uint32_t sleep_ms = lv_timer_handler();
         xSemaphoreGive(lvgl_mutex);
 
-        vTaskDelay(pdMS_TO_TICKS(10));
+        // Sleep until the next LVGL timer is due (this includes the input device read timers), or until woken by ui_task_wake() or an input
+        if (sleep_ms > UI_TASK_MAX_SLEEP_MS) {
+            sleep_ms = UI_TASK_MAX_SLEEP_MS;
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_ms));
     }
 
     // Free resources
@@ -193,6 +304,10 @@ static void init_display(void) {
     ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_mirror(panel_handle, true, false));
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
+
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+    init_te_sync();
+#endif
 }
 
 /**
@@ -202,6 +317,9 @@ static void init_display(void) {
  */
 static void free_display(void) {
     ESP_LOGI(TAG, "Freeing display resources");
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+    free_te_sync();
+#endif
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, false));
     ESP_ERROR_CHECK(esp_lcd_panel_del(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_io_del(io_handle));
@@ -216,33 +334,68 @@ static void free_display(void) {
  *
  * @note This function should only be called from the UI task.
  * @note The allocated resources can be freed with free_lvgl(), if LVGL is no longer needed.
- * @uses disp_buf, indev_drv, buttons_indev, lvgl_periodic_timer
+ * @uses disp_buf, indev_drv, buttons_indev, touch_indev
  */
 static void init_lvgl(void) {
     lv_color_t *buf1;
-    lv_color_t *buf2;
-    lv_indev_t *buttons_indev;
+    lv_color_t *buf2 = NULL;
 
     ESP_LOGI(TAG, "Initializing LVGL");
     lv_init();
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_PARTIAL_DOUBLE
     buf1 = heap_caps_malloc(LVGL_BUFFER_SIZE, MALLOC_CAP_DMA);
     buf2 = heap_caps_malloc(LVGL_BUFFER_SIZE, MALLOC_CAP_DMA);
     if (buf1 == NULL || buf2 == NULL) {
         ESP_LOGE(TAG, "Failed to allocate LVGL buffers");
         abort();
     }
-    ESP_LOGD(TAG, "Allocated LVGL buffers at %p and %p", buf1, buf2);
+    render_stats.internal_ram_bytes = 2 * LVGL_BUFFER_SIZE;
+#elif UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+    // The i80 bus reads PSRAM buffers with DMA, they must be aligned to psram_trans_align
+    buf1 = heap_caps_aligned_alloc(64, LVGL_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    if (buf1 == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate LVGL buffer");
+        abort();
+    }
+    memset(buf1, 0, LVGL_BUFFER_SIZE);
+    render_stats.psram_bytes = LVGL_BUFFER_SIZE;
+#else
+    buf1 = heap_caps_malloc(LVGL_BUFFER_SIZE, MALLOC_CAP_DMA);
+    if (buf1 == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate LVGL buffer");
+        abort();
+    }
+    render_stats.internal_ram_bytes = LVGL_BUFFER_SIZE;
+#endif
+    ESP_LOGI(TAG, "Allocated LVGL buffers at %p and %p (%u bytes internal RAM, %u bytes PSRAM)",
+             buf1, buf2, render_stats.internal_ram_bytes, render_stats.psram_bytes);
     lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LVGL_BUFFER_SIZE / sizeof(lv_color_t));
     lv_disp_drv_init(&disp_drv);
     disp_drv.draw_buf = &disp_buf;
     disp_drv.flush_cb = lvgl_flush_cb;
+    disp_drv.wait_cb = lvgl_wait_cb;
     disp_drv.user_data = panel_handle;
     disp_drv.hor_res = UI_TASK_DISPLAY_WIDTH;
     disp_drv.ver_res = UI_TASK_DISPLAY_HEIGHT;
     disp_drv.rotated = 0;
-    lv_disp_drv_register(&disp_drv);
-
-    // Register 3 buttons (left, right and enter) as an encoder input device
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+    // Render in place in the frame buffer, the flush callback only sends the dirty areas
+    disp_drv.direct_mode = 1;
+#endif
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    lv_timer_t *refr_timer = _lv_disp_get_refr_timer(disp);
+
+    // Measure every refresh, and compute the frame statistics periodically
+    lv_timer_set_cb(refr_timer, lvgl_refr_timer_cb);
+    frame_stats_start_us = esp_timer_get_time();
+    lv_timer_create(frame_stats_timer_cb, UI_TASK_FRAME_STATS_PERIOD_MS, NULL);
+
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+    // Render at the frame rate of the display, the refresh waits for the TE signal
+    lv_timer_set_period(refr_timer, UI_TASK_TE_FRAME_PERIOD_US / 1000);
+#endif
+
+    // Register 3 buttons (left, right and enter) as an encoder input device, it is only read while there are button events (see lvgl_buttons_read_cb)
     lv_indev_drv_init(&buttons_indev_drv);
     buttons_indev_drv.type = LV_INDEV_TYPE_ENCODER;
     buttons_indev_drv.read_cb = lvgl_buttons_read_cb;
@@ -254,50 +407,43 @@ static void init_lvgl(void) {
     lv_group_set_default(group);
     lv_indev_set_group(buttons_indev, group);
 
-    // Register the touchscreens as input devices
+    // Register the touchscreens as input devices, the touchscreen is only read while it is touched (see lvgl_touch_read_cb)
     lv_indev_drv_init(&touch_indev_drv);
     touch_indev_drv.type = LV_INDEV_TYPE_POINTER;
     touch_indev_drv.read_cb = lvgl_touch_read_cb;
     touch_indev_drv.feedback_cb = lvgl_touch_feedback_cb;
-    lv_indev_drv_register(&touch_indev_drv);
-
-    // Create a periodic timer to call lvg_tick_task
-    const esp_timer_create_args_t periodic_timer_args = {
-            .callback = &lvgl_tick_task,
-            .name = "lvgl_tick"
-    };
-    ESP_ERROR_CHECK(esp_timer_create(&periodic_timer_args, &lvgl_periodic_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_periodic_timer, UI_TASK_LVGL_TICK_PERIOD_MS * 1000));
+    touch_indev = lv_indev_drv_register(&touch_indev_drv);
+    tsc2046_set_touch_cb(touch_down_handler, NULL);
 }
 
 /**
  * @brief Frees the LVGL resources, and de-initializes LVGL
  *
- * @uses disp_buf, lvgl_periodic_timer
+ * @uses disp_buf
  */
 static void free_lvgl(void) {
     ESP_LOGI(TAG, "Freeing LVGL resources");
-    esp_timer_stop(lvgl_periodic_timer);
-    esp_timer_delete(lvgl_periodic_timer);
     heap_caps_free(disp_buf.buf1);
-    heap_caps_free(disp_buf.buf2);
+    heap_caps_free(disp_buf.buf2);  // NULL for the single buffer modes
     lv_deinit();
 }
 
 /**
  * @brief Initializes the buttons
  *
- * @todo Move this to a separate button driver?
- *
- * Configures the 3 buttons as input, with internal pull-ups.
+ * The button driver (buttons.c) debounces the 3 buttons on interrupts, and queues their events for lvgl_buttons_read_cb().
  */
 static void init_buttons(void) {
-    gpio_set_direction(UI_TASK_PIN_NUM_BUTTON_LEFT, GPIO_MODE_INPUT);
-    gpio_set_pull_mode(UI_TASK_PIN_NUM_BUTTON_LEFT, GPIO_PULLUP_ONLY);
-    gpio_set_direction(UI_TASK_PIN_NUM_BUTTON_RIGHT, GPIO_MODE_INPUT);
-    gpio_set_pull_mode(UI_TASK_PIN_NUM_BUTTON_RIGHT, GPIO_PULLUP_ONLY);
-    gpio_set_direction(UI_TASK_PIN_NUM_BUTTON_ENTER, GPIO_MODE_INPUT);
-    gpio_set_pull_mode(UI_TASK_PIN_NUM_BUTTON_ENTER, GPIO_PULLUP_ONLY);
+    const buttons_config_t config = {
+            .pins = {
+                    [BUTTONS_ID_LEFT] = UI_TASK_PIN_NUM_BUTTON_LEFT,
+                    [BUTTONS_ID_RIGHT] = UI_TASK_PIN_NUM_BUTTON_RIGHT,
+                    [BUTTONS_ID_ENTER] = UI_TASK_PIN_NUM_BUTTON_ENTER,
+            },
+            .event_cb = buttons_event_handler,
+            .event_cb_arg = NULL,
+    };
+    ESP_ERROR_CHECK(buttons_init(&config));
 }
 
 /**
@@ -310,20 +456,375 @@ static void display_set_backlight(bool on) {
     gpio_set_level(UI_TASK_PIN_NUM_LCD_BACKLIGHT, on ? 1 : 0);
 }
 
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+/**
+ * @brief Set up the TE signal
+ *
+ * In GPIO mode the display is configured to output the TE signal (V-blank only) on UI_TASK_PIN_NUM_LCD_TE,
+ * in simulated mode a periodic timer generates it.
+ *
+ * @note This function should only be called from init_display()
+ * @uses te_semaphore, te_sim_timer
+ */
+static void init_te_sync(void) {
+    te_semaphore = xSemaphoreCreateBinary();
+    if (te_semaphore == NULL) {
+        ESP_LOGE(TAG, "Failed to create TE semaphore");
+        abort();
+    }
+
+#if UI_TASK_TE_SYNC_MODE == UI_TASK_TE_SYNC_GPIO
+    ESP_LOGI(TAG, "Syncing the display to the TE signal on GPIO %d", UI_TASK_PIN_NUM_LCD_TE);
+    ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io_handle, LCD_CMD_TEON, (uint8_t[]) {0x00}, 1));
+
+    const gpio_config_t te_gpio_config = {
+            .pin_bit_mask = 1ULL << UI_TASK_PIN_NUM_LCD_TE,
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = GPIO_PULLUP_DISABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_POSEDGE,
+    };
+    ESP_ERROR_CHECK(gpio_config(&te_gpio_config));
+
+    // The ISR service may already be installed by another driver
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_ERR_INVALID_STATE) {
+        ESP_ERROR_CHECK(err);
+    }
+    ESP_ERROR_CHECK(gpio_isr_handler_add(UI_TASK_PIN_NUM_LCD_TE, te_signal_handler, NULL));
+#else
+    ESP_LOGI(TAG, "Syncing the display to a simulated TE signal");
+    const esp_timer_create_args_t te_sim_timer_args = {
+            .callback = &te_signal_handler,
+            .name = "te_sim"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&te_sim_timer_args, &te_sim_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(te_sim_timer, UI_TASK_TE_FRAME_PERIOD_US));
+#endif
+}
+
+/**
+ * @brief Stop the TE signal and free its resources
+ *
+ * @uses te_semaphore, te_sim_timer
+ */
+static void free_te_sync(void) {
+#if UI_TASK_TE_SYNC_MODE == UI_TASK_TE_SYNC_GPIO
+    gpio_isr_handler_remove(UI_TASK_PIN_NUM_LCD_TE);
+    esp_lcd_panel_io_tx_param(io_handle, LCD_CMD_TEOFF, NULL, 0);
+#else
+    esp_timer_stop(te_sim_timer);
+    esp_timer_delete(te_sim_timer);
+#endif
+    vSemaphoreDelete(te_semaphore);
+}
+
+/**
+ * @brief Wait for the start of the next frame of the display
+ *
+ * The display starts scanning from the top after the TE signal. A frame rendered and transferred after the TE signal
+ * stays behind the scan line, as long as it is done within one frame period.
+ *
+ * Called before a frame is rendered, from the refresh timer inside lv_timer_handler(). The LVGL mutex is released
+ * while waiting, so the other tasks can update the UI, their changes are rendered in this frame. The wait is limited
+ * to about one frame period (TE_TIMEOUT_TICKS): a TE signal that does not come within a frame is not coming.
+ *
+ * @note Must be called with lvgl_mutex held, it is held again on return
+ * @uses te_semaphore, te_count, frame_te_count, te_stats, frame_counters, lvgl_mutex
+ */
+static void wait_for_te(void) {
+    int64_t start = esp_timer_get_time();
+
+    xSemaphoreGive(lvgl_mutex);
+    // Discard a TE signal given before the wait, the frame must start at the beginning of a display frame
+    xSemaphoreTake(te_semaphore, 0);
+    if (xSemaphoreTake(te_semaphore, TE_TIMEOUT_TICKS) != pdTRUE) {
+        te_stats.te_timeouts++;
+    }
+    frame_te_count = te_count;
+    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    te_stats.frames++;
+    frame_counters.wait_us += (uint32_t)(esp_timer_get_time() - start);
+}
+
+/**
+ * @brief Handle a TE signal
+ *
+ * Called from the GPIO ISR, or from the esp_timer task in simulated mode.
+ *
+ * @param arg unused
+ */
+#if UI_TASK_TE_SYNC_MODE == UI_TASK_TE_SYNC_GPIO
+static void IRAM_ATTR te_signal_handler(void *arg) {
+    BaseType_t high_task_awoken = pdFALSE;
+
+    te_count++;
+    xSemaphoreGiveFromISR(te_semaphore, &high_task_awoken);
+    if (high_task_awoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+#else
+static void te_signal_handler(void *arg) {
+    te_count++;
+    xSemaphoreGive(te_semaphore);
+}
+#endif
+#endif
+
+/**
+ * @brief Get the TE sync statistics
+ *
+ * @note All counters stay 0 when UI_TASK_TE_SYNC_MODE is UI_TASK_TE_SYNC_OFF
+ *
+ * @param[out] stats The statistics
+ */
+void ui_task_get_te_stats(ui_task_te_stats_t *stats) {
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+    *stats = te_stats;
+#else
+    *stats = (ui_task_te_stats_t) {0};
+#endif
+}
+
+/**
+ * @brief Get the render buffer statistics
+ *
+ * @note Call with lvgl_mutex held, to get a consistent snapshot
+ *
+ * @param[out] stats The statistics
+ */
+void ui_task_get_render_stats(ui_task_render_stats_t *stats) {
+    *stats = render_stats;
+}
+
+/**
+ * @brief Get the frame statistics of the last period (UI_TASK_FRAME_STATS_PERIOD_MS)
+ *
+ * These are the statistics shown in the profiler overlay.
+ *
+ * @note Call with lvgl_mutex held, to get a consistent snapshot
+ *
+ * @param[out] stats The statistics
+ */
+void ui_task_get_frame_stats(ui_frame_stats_t *stats) {
+    *stats = frame_stats;
+}
+
+/**
+ * @brief LVGL display refresh timer callback, refresh the display and measure the time it takes
+ *
+ * Replaces the callback of the refresh timer of the display, and calls the LVGL refresh.
+ * With TE sync a frame with invalidated areas waits for the TE signal before it is rendered (wait_for_te()).
+ * The render time is the time spent in the refresh, without the time waited in lvgl_wait_cb().
+ *
+ * @uses frame_counters
+ *
+ * @param[in] timer The refresh timer, its user data is the display
+ */
+static void lvgl_refr_timer_cb(lv_timer_t *timer) {
+    lv_disp_t *disp = timer->user_data;
+
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+    if (disp->inv_p > 0) {
+        wait_for_te();
+    }
+#endif
+
+    uint16_t areas = disp->inv_p;
+    uint32_t wait_us = frame_counters.wait_us;
+    int64_t start = esp_timer_get_time();
+
+    _lv_disp_refr_timer(timer);
+
+    if (areas > 0) {
+        frame_counters.render_us += (uint32_t)(esp_timer_get_time() - start) - (frame_counters.wait_us - wait_us);
+        frame_counters.areas += areas;
+    }
+}
+
+/**
+ * @brief LVGL wait callback, called while LVGL waits for a transfer to finish
+ *
+ * Waits until the transfer is done and measures the wait time. LVGL itself also waits in a busy loop.
+ *
+ * @uses frame_counters
+ *
+ * @param[in] drv The display driver
+ */
+static void lvgl_wait_cb(lv_disp_drv_t *drv) {
+    int64_t start = esp_timer_get_time();
+
+    while (drv->draw_buf->flushing) {
+    }
+    frame_counters.wait_us += (uint32_t)(esp_timer_get_time() - start);
+}
+
+/**
+ * @brief LVGL timer callback, compute the frame statistics of the last period
+ *
+ * Called every UI_TASK_FRAME_STATS_PERIOD_MS. The statistics are shown in the profiler overlay (ui_set_frame_stats()).
+ * The CPU load is only measured when the FreeRTOS run time statistics are enabled (see sdkconfig.defaults).
+ *
+ * @uses frame_stats, frame_counters, render_stats, frame_stats_start_us
+ *
+ * @param[in] timer unused
+ */
+static void frame_stats_timer_cb(lv_timer_t *timer) {
+    static frame_counters_t last_counters = {0};
+    static uint32_t last_frames = 0;
+    static uint64_t last_flush_bytes = 0;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    static uint32_t last_idle_run_time[UI_FRAME_STATS_CPU_COUNT] = {0};
+#endif
+    int64_t now = esp_timer_get_time();
+    uint32_t elapsed_us = (uint32_t)(now - frame_stats_start_us);
+    uint32_t frames = render_stats.frames - last_frames;
+
+    frame_stats = (ui_frame_stats_t) {0};
+    frame_stats.fps_x10 = (uint16_t)((uint64_t)frames * 10 * 1000000 / elapsed_us);
+    if (frames > 0) {
+        frame_stats.render_us = (frame_counters.render_us - last_counters.render_us) / frames;
+        frame_stats.flush_us = (frame_counters.flush_us - last_counters.flush_us) / frames;
+        frame_stats.wait_us = (frame_counters.wait_us - last_counters.wait_us) / frames;
+        frame_stats.areas = (uint16_t)((frame_counters.areas - last_counters.areas) / frames);
+        frame_stats.flush_bytes = (uint32_t)((render_stats.flush_bytes - last_flush_bytes) / frames);
+    }
+
+    for (BaseType_t core = 0; core < UI_FRAME_STATS_CPU_COUNT; core++) {
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        if (core < portNUM_PROCESSORS) {
+            // The run time counter is in microseconds (esp_timer)
+            uint32_t idle_run_time = get_idle_run_time(core);
+            uint32_t idle_us = idle_run_time - last_idle_run_time[core];
+            frame_stats.cpu_load[core] = idle_us < elapsed_us ? (uint8_t)(100 - (uint64_t)idle_us * 100 / elapsed_us) : 0;
+            last_idle_run_time[core] = idle_run_time;
+            continue;
+        }
+#endif
+        frame_stats.cpu_load[core] = UI_FRAME_STATS_CPU_LOAD_UNKNOWN;
+    }
+
+    last_counters = frame_counters;
+    last_frames = render_stats.frames;
+    last_flush_bytes = render_stats.flush_bytes;
+    frame_stats_start_us = now;
+
+    ui_set_frame_stats(&frame_stats);
+}
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+/**
+ * @brief Get the run time of the idle task of a core
+ *
+ * @param[in] core The core
+ * @return The run time counter of the idle task
+ */
+static uint32_t get_idle_run_time(BaseType_t core) {
+    TaskStatus_t status;
+
+    vTaskGetInfo(xTaskGetIdleTaskHandleForCPU(core), &status, pdFALSE, eRunning);
+    return status.ulRunTimeCounter;
+}
+#endif
+
 /**
  * @brief LVGL flush callback
  *
  * Write the color data to the display.
  * lv_disp_flush_ready() must be called when the color data has been transferred.
+ * In direct mode LVGL flushes the full frame buffer once per dirty area, with the full display as area.
+ * Only the last flush of the frame is sent, it sends the rows of all dirty areas of the frame, one transfer per
+ * range of adjacent rows (the rows of a frame buffer are only contiguous over the full width).
  *
  * @param[in] drv
  * @param[in] area
  * @param[in] color_map
  */
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+    // The dirty area is in the frame buffer, it is sent with the last flush of the frame
+    if (!lv_disp_flush_is_last(drv)) {
+        lv_disp_flush_ready(drv);
+        return;
+    }
+#endif
+
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+    frame_last_band = lv_disp_flush_is_last(drv);
+#endif
+
+    if (lv_disp_flush_is_last(drv)) {
+        render_stats.frames++;
+    }
+    flush_start_us = esp_timer_get_time();
+
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+    row_range_t rows[LV_INV_BUF_SIZE];
+    uint16_t count = get_dirty_rows(_lv_refr_get_disp_refreshing(), rows);
+
+    if (count == 0) {
+        lv_disp_flush_ready(drv);
+        return;
+    }
+    // Set before the first transfer, it can be done before the next one is queued
+    pending_transfers = count;
+    for (uint16_t i = 0; i < count; i++) {
+        render_stats.bands++;
+        render_stats.flush_bytes += (uint64_t)UI_TASK_DISPLAY_WIDTH * (rows[i].y2 - rows[i].y1 + 1) * sizeof(lv_color_t);
+        esp_lcd_panel_draw_bitmap(panel_handle, 0, rows[i].y1, UI_TASK_DISPLAY_WIDTH, rows[i].y2 + 1,
+                                  color_map + rows[i].y1 * UI_TASK_DISPLAY_WIDTH);
+    }
+#else
+    render_stats.bands++;
+    render_stats.flush_bytes += (uint64_t)lv_area_get_size(area) * sizeof(lv_color_t);
+    pending_transfers = 1;
     esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1, area->x2 + 1, area->y2 + 1, color_map);
+#endif
 }
 
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+/**
+ * @brief Get the rows of the dirty areas of the frame being refreshed, in direct mode
+ *
+ * Overlapping and adjacent row ranges are merged, the ranges are sorted from top to bottom.
+ * Areas joined into other areas (inv_area_joined) are skipped.
+ *
+ * @param[in] disp The display being refreshed
+ * @param[out] rows The row ranges, at least LV_INV_BUF_SIZE entries
+ * @return The number of row ranges
+ */
+static uint16_t get_dirty_rows(const lv_disp_t *disp, row_range_t *rows) {
+    uint16_t count = 0;
+
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) {
+            continue;
+        }
+        row_range_t range = {disp->inv_areas[i].y1, disp->inv_areas[i].y2};
+        uint16_t j = 0;
+        uint16_t kept = 0;
+
+        // Merge the ranges that overlap or touch the new range into it, keep the others in order
+        for (j = 0; j < count; j++) {
+            if (rows[j].y2 + 1 < range.y1 || range.y2 + 1 < rows[j].y1) {
+                rows[kept++] = rows[j];
+                continue;
+            }
+            range.y1 = LV_MIN(range.y1, rows[j].y1);
+            range.y2 = LV_MAX(range.y2, rows[j].y2);
+        }
+        // Insert the merged range in order
+        for (j = kept; j > 0 && rows[j - 1].y1 > range.y1; j--) {
+            rows[j] = rows[j - 1];
+        }
+        rows[j] = range;
+        count = kept + 1;
+    }
+    return count;
+}
+#endif
+
 /**
  * @brief esp-lcd panel IO callback, invoked when the color data has been transferred
  *
@@ -335,6 +836,20 @@ static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
  * @return Whether a high priority task has been waken up by this function
  */
 static bool color_trans_done_cb(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx) {
+    // In direct mode a flush can be sent in several transfers
+    if (--pending_transfers > 0) {
+        return false;
+    }
+
+#if UI_TASK_TE_SYNC_MODE != UI_TASK_TE_SYNC_OFF
+    // The frame can tear when the display started a new frame before the frame was rendered and transferred
+    if (frame_last_band && te_count != frame_te_count) {
+        te_stats.missed_frames++;
+    }
+#endif
+
+    frame_counters.flush_us += (uint32_t)(esp_timer_get_time() - flush_start_us);
+
     // Notify LVGL that the color data has been transferred
     lv_disp_flush_ready(&disp_drv);
     return false;
@@ -343,41 +858,87 @@ static bool color_trans_done_cb(esp_lcd_panel_io_handle_t panel_io, esp_lcd_pane
 /**
  * @brief LVGL button indev callback.
  *
- * This function is called periodically by LVGL to read the status of the buttons.
+ * This function is called by LVGL to read the button events (see buttons.c), one event per call.
+ * Enter is sent as the enter key while it is held, so LVGL handles its long press.
+ * Left and right are sent as encoder steps. The step of a press is only sent on its release or its long press,
+ * so the other button can still join it as a chord. While the button is held, every repeat event sends a step.
+ * Left and right pressed together (a chord) toggle the profiler overlay, on the press that completes the chord.
+ * The chord stays active until both buttons are released, it sends no steps and toggles the overlay only once.
+ * The state of the buttons is followed from the events, so presses that settle together are still handled in order.
+ * When there are no events and no button is held, the read timer is paused until the next event (buttons_event_handler()).
  *
  * @param[in] drv
  * @param[out] data
  */
 static void lvgl_buttons_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
-    static bool enter_last_state = 0;
-    static bool left_last_state = 0;
-    static bool right_last_state = 0;
-
-    // Read the buttons
-    bool enter_state = gpio_get_level(UI_TASK_PIN_NUM_BUTTON_ENTER) == 0;
-    bool left_state = gpio_get_level(UI_TASK_PIN_NUM_BUTTON_LEFT) == 0;
-    bool right_state = gpio_get_level(UI_TASK_PIN_NUM_BUTTON_RIGHT) == 0;
-
-    // Set the data
-    data->state = LV_INDEV_STATE_REL;
-    if (enter_state && !enter_last_state) {
-        ESP_LOGD(TAG, "Enter key pressed");
-        data->state = LV_INDEV_STATE_PR;
-        data->key = LV_KEY_ENTER;
-    } else if (left_state && !left_last_state) {
-        ESP_LOGD(TAG, "Left key pressed");
-        data->state = LV_INDEV_STATE_PR;
-        data->key = LV_KEY_LEFT;
-    } else if (right_state && !right_last_state) {
-        ESP_LOGD(TAG, "Right key pressed");
-        data->state = LV_INDEV_STATE_PR;
-        data->key = LV_KEY_RIGHT;
-    }
-
-    // Save the last state
-    enter_last_state = enter_state;
-    left_last_state = left_state;
-    right_last_state = right_state;
+    static bool enter_pressed = false;
+    static bool arrow_pressed[2] = {false, false};  // Left and right, from the events
+    static bool step_pending[2] = {false, false};   // The step of the press is sent on the release or the long press
+    static bool chord_active = false;               // Left and right were pressed together, until both are released
+    buttons_event_t event;
+
+    data->key = LV_KEY_ENTER;
+    data->state = enter_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    data->enc_diff = 0;
+
+    if (!buttons_get_event(&event)) {
+        if (!buttons_any_pressed()) {
+            lv_timer_pause(drv->read_timer);
+        }
+        return;
+    }
+    data->continue_reading = true;  // Read the next event in the same period, returns immediately if there is none
+
+    if (event.button == BUTTONS_ID_ENTER) {
+        if (event.type == BUTTONS_EVENT_PRESS || event.type == BUTTONS_EVENT_RELEASE) {
+            ESP_LOGD(TAG, "Enter key %s (%lld us ago)", event.type == BUTTONS_EVENT_PRESS ? "pressed" : "released",
+                     esp_timer_get_time() - event.time_us);
+            enter_pressed = event.type == BUTTONS_EVENT_PRESS;
+            data->state = enter_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+        }
+        return;
+    }
+
+    uint8_t arrow = event.button == BUTTONS_ID_LEFT ? 0 : 1;
+    bool step = false;
+    switch (event.type) {
+        case BUTTONS_EVENT_PRESS:
+            arrow_pressed[arrow] = true;
+            if (arrow_pressed[1 - arrow]) {
+                // Left and right pressed together toggle the profiler overlay, the pending step is dropped
+                if (!chord_active) {
+                    ESP_LOGD(TAG, "Profiler chord pressed");
+                    ui_toggle_profiler_overlay();
+                    chord_active = true;
+                }
+                step_pending[0] = false;
+                step_pending[1] = false;
+            }
+            else if (!chord_active) {
+                step_pending[arrow] = true;
+            }
+            break;
+        case BUTTONS_EVENT_RELEASE:
+            arrow_pressed[arrow] = false;
+            step = step_pending[arrow];
+            step_pending[arrow] = false;
+            if (!arrow_pressed[1 - arrow]) {
+                chord_active = false;
+            }
+            break;
+        case BUTTONS_EVENT_LONG_PRESS:
+            step = step_pending[arrow];
+            step_pending[arrow] = false;
+            break;
+        case BUTTONS_EVENT_REPEAT:
+            step = !chord_active;
+            break;
+    }
+
+    if (step) {
+        ESP_LOGD(TAG, "%s key step", arrow == 0 ? "Left" : "Right");
+        data->enc_diff = arrow == 0 ? -1 : 1;
+    }
 }
 
 /**
@@ -400,6 +961,8 @@ static void lvgl_buttons_feedback_cb(lv_indev_drv_t *drv, uint8_t event) {
  *
  * This function is called periodically by LVGL to read the status of the touchscreen.
  * If use_raw_touch_input is true, the raw touch coordinates are used, otherwise the coordinates are calibrated.
+ * When the touch is released, the read timer is paused until the next touch down (touch_down_handler()),
+ * so the touchscreen is not polled while it is not touched.
  *
  * @uses use_raw_touch_input
  *
@@ -425,6 +988,11 @@ static void lvgl_touch_read_cb(lv_indev_drv_t * drv, lv_indev_data_t*data) {
     }
     data->point = last_point;
     data->state = last_state ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+
+    // The release is sent to LVGL with this read, the next read is on touch down
+    if (!last_state && !tsc2046_is_touched()) {
+        lv_timer_pause(drv->read_timer);
+    }
 }
 
 /**
@@ -445,14 +1013,60 @@ static void lvgl_touch_feedback_cb(lv_indev_drv_t * drv, uint8_t event) {
 }
 
 /**
- * @brief LVGL tick task
+ * @brief Handle a touch down, called from the PENIRQ ISR
+ *
+ * Wake the UI task, which resumes the touch read timer and reads the touch immediately.
+ *
+ * @param arg unused
+ */
+static void IRAM_ATTR touch_down_handler(void *arg) {
+    BaseType_t high_task_awoken = pdFALSE;
+
+    touch_wake_pending = true;
+    if (ui_task_handle != NULL) {
+        vTaskNotifyGiveFromISR(ui_task_handle, &high_task_awoken);
+    }
+    if (high_task_awoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * @brief Handle queued button events, called from the esp_timer task
  *
- * Increment the LVGL tick
+ * Wake the UI task, which resumes the buttons read timer and reads the events immediately.
  *
  * @param arg unused
  */
-static void lvgl_tick_task(void *arg) {
-    lv_tick_inc(UI_TASK_LVGL_TICK_PERIOD_MS);
+static void buttons_event_handler(void *arg) {
+    buttons_wake_pending = true;
+    ui_task_wake();
+}
+
+/**
+ * @brief Resume the read timer of an input device, and make it run in this timer handler call
+ *
+ * @note Call with the LVGL mutex taken
+ *
+ * @param[in] indev The input device
+ */
+static void resume_indev_read(lv_indev_t *indev) {
+    lv_timer_t *read_timer = lv_indev_get_read_timer(indev);
+
+    lv_timer_resume(read_timer);
+    lv_timer_ready(read_timer);
+}
+
+/**
+ * @brief Wake the UI task, to handle the LVGL timers and redraw now
+ *
+ * Call this after changing the UI from another task, otherwise the change is only drawn when the next LVGL timer is due.
+ * Safe to call before the UI task is started.
+ */
+void ui_task_wake(void) {
+    if (ui_task_handle != NULL) {
+        xTaskNotifyGive(ui_task_handle);
+    }
 }
 
 /**
@@ -525,7 +1139,6 @@ static void update_ui_on_event(void* handler_arg, esp_event_base_t base, int32_t
     uint16_t ap_count;
     static wifi_ap_record_t * ap_records;
     static ui_wifi_network_t * wifi_networks;
-    static bool first_run = true;
 
     ESP_LOGD(TAG, "Event dispatched from event loop: %s, %ld", base, id);
 
@@ -540,43 +1153,7 @@ static void update_ui_on_event(void* handler_arg, esp_event_base_t base, int32_t
         return;
     }
 
-    if (base == DATA_MANAGER_EVENTS) {
-        SemaphoreHandle_t data_manager_mutex_handle = data_manager_get_data_mutex_handle();
-
-        if (xSemaphoreTake(data_manager_mutex_handle, pdMS_TO_TICKS(500)) != pdTRUE) {
-            ESP_LOGE(TAG, "Could not take data manager mutex within 500ms");
-            xSemaphoreGive(lvgl_mutex);
-            return;
-        }
-
-        data_manager_meter_data_t *meter_data = data_manager_get_meter_data();
-        data_manager_history_data_t *history_data = data_manager_get_history_data();
-        switch ((data_manager_event_id_t)id) {
-            case DATA_MANAGER_NEW_METER_DATA_AVAILABLE:
-                ESP_LOGD(TAG, "New meter data available, updating UI");
-                ui_set_power_consumption((uint16_t) (meter_data->current_power_usage * 1000));
-                ui_set_predicted_peak((uint16_t) (meter_data->predicted_peak.demand * 1000));
-                ui_add_peak_demand_data_point(meter_data->p1_timestamp, (uint16_t) (meter_data->current_avg_demand * 1000));
-                ui_set_new_max_peak_demand((uint16_t) (meter_data->max_demand_active_month.demand * 1000));
-                if (first_run) {
-                    first_run = false;
-                    ui_set_initialized(true);
-                    ui_set_max_peak_line((uint16_t) (meter_data->max_demand_active_month.demand * 1000));
-                }
-                break;
-            case DATA_MANAGER_NEW_METER_HISTORY_DATA_AVAILABLE:
-                ESP_LOGD(TAG, "New meter history data available, updating UI");
-                ui_reset_peak_demand_chart_data();
-                ESP_LOGD(TAG, "Max demand short term items: %d", history_data->max_demand_short_term_items);
-                for (uint16_t i = 0; i < history_data->max_demand_short_term_items; i++) {
-                    ui_add_peak_demand_data_point(history_data->max_demand_short_term[i].timestamp, (uint16_t) (history_data->max_demand_short_term[i].demand * 1000));
-                }
-                break;
-        }
-        xSemaphoreGive(data_manager_mutex_handle);
-
-    }
-    else if (base == WEB_CLIENT_EVENTS) {
+    if (base == WEB_CLIENT_EVENTS) {
         SemaphoreHandle_t web_client_found_servers_mutex_handle;
         switch ((web_client_event_id_t)id) {
             case WEB_CLIENT_INITIALIZED:
@@ -652,4 +1229,114 @@ static void update_ui_on_event(void* handler_arg, esp_event_base_t base, int32_t
     }
 
     xSemaphoreGive(lvgl_mutex);
-}
\ No newline at end of file
+    ui_task_wake();
+}
+
+/**
+ * @brief Update the widgets showing the changed data
+ *
+ * Called by the data manager from the app event loop task.
+ *
+ * @param[in] changed_fields The data fields that changed
+ * @param[in] meter_data A copy of the meter data
+ * @param[in] arg unused
+ */
+static void update_ui_on_data_change(data_manager_field_mask_t changed_fields, const data_manager_meter_data_t *meter_data, void *arg) {
+    static bool first_run = true;
+
+    ESP_LOGD(TAG, "Data changed, fields: 0x%08lx", changed_fields);
+
+    if (xSemaphoreTake(lvgl_mutex, pdMS_TO_TICKS(500)) != pdTRUE) {
+        ESP_LOGE(TAG, "Could not take lvgl mutex within 500ms");
+        return;
+    }
+
+    if (!ui_initialized) {
+        ESP_LOGE(TAG, "UI not initialized");
+        xSemaphoreGive(lvgl_mutex);
+        return;
+    }
+
+    if (changed_fields & (DM_DF_MASK(DM_DF_MAX_DEMAND_YEAR) | DM_DF_MASK(DM_DF_MAX_DEMAND_SHORT_TERM))) {
+        SemaphoreHandle_t data_manager_mutex_handle = data_manager_get_data_mutex_handle();
+        ui_demand_point_t *points = heap_caps_malloc(DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS * sizeof(ui_demand_point_t), MALLOC_CAP_SPIRAM);
+        uint16_t count = 0;
+
+        if (points == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate memory for the peak demand history");
+        }
+        else if (xSemaphoreTake(data_manager_mutex_handle, pdMS_TO_TICKS(500)) != pdTRUE) {
+            ESP_LOGE(TAG, "Could not take data manager mutex within 500ms");
+        }
+        else {
+            // Convert the ring buffer to a series of points, oldest first, and release the data as soon as possible
+            data_manager_history_data_t *history_data = data_manager_get_history_data();
+            for (uint16_t i = 0; i < DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS; i++) {
+                const data_manager_demand_data_point_t *item = &history_data->max_demand_short_term[(history_data->max_demand_short_term_items + i) % DATA_MANAGER_MAX_DEMAND_SHORT_TERM_ITEMS];
+                if (item->timestamp != 0) {
+                    points[count].time = item->timestamp;
+                    points[count].value = (uint16_t) (item->demand * 1000);
+                    count++;
+                }
+            }
+            xSemaphoreGive(data_manager_mutex_handle);
+
+            ESP_LOGD(TAG, "New meter history data available, updating UI with %d points", count);
+            ui_set_peak_demand_chart_history(points, count);
+        }
+        heap_caps_free(points);
+    }
+
+    if (changed_fields & DM_DF_MASK(DM_DF_CURRENT_POWER_USAGE)) {
+        ui_set_power_consumption((uint16_t) (meter_data->current_power_usage * 1000));
+    }
+
+    if (changed_fields & (DM_DF_MASK(DM_DF_LOCAL_PREDICTED_PEAK) | DM_DF_MASK(DM_DF_PREDICTED_PEAK))) {
+        // Prefer the locally calculated prediction, it is updated at every sample
+        if (meter_data->local_predicted_peak.timestamp != 0) {
+            ui_set_predicted_peak((uint16_t) (meter_data->local_predicted_peak.demand * 1000));
+        }
+        else {
+            ui_set_predicted_peak((uint16_t) (meter_data->predicted_peak.demand * 1000));
+        }
+    }
+
+    if (changed_fields & (DM_DF_MASK(DM_DF_LOCAL_AVG_DEMAND) | DM_DF_MASK(DM_DF_CURRENT_AVG_DEMAND) |
+                          DM_DF_MASK(DM_DF_LOCAL_PREDICTED_PEAK) | DM_DF_MASK(DM_DF_PREDICTED_PEAK))) {
+        // Both the local and the server values are shown in the profiler overlay, to compare them
+        ui_demand_comparison_t demand = {
+                .local_avg_w = (uint16_t) (meter_data->local_avg_demand * 1000),
+                .server_avg_w = (uint16_t) (meter_data->current_avg_demand * 1000),
+                .local_predicted_w = meter_data->local_predicted_peak.timestamp != 0 ? (uint16_t) (meter_data->local_predicted_peak.demand * 1000) : UI_DEMAND_UNKNOWN,
+                .server_predicted_w = meter_data->predicted_peak.timestamp != 0 ? (uint16_t) (meter_data->predicted_peak.demand * 1000) : UI_DEMAND_UNKNOWN,
+        };
+        ui_set_demand_comparison(&demand);
+    }
+
+    // Every new sample adds a point to the chart, even if the demand did not change
+    if (changed_fields & DM_DF_MASK(DM_DF_P1_TIMESTAMP)) {
+        ui_add_peak_demand_data_point(meter_data->p1_timestamp, (uint16_t) (meter_data->current_avg_demand * 1000));
+    }
+
+    // The buckets restored from NVS are not reported as changed, load them with the first update
+    if ((changed_fields & DM_DF_MASK(DM_DF_ENERGY_BUCKETS)) || first_run) {
+        energy_buckets_bucket_t buckets[ENERGY_BUCKETS_COUNT];
+        uint8_t bucket_count = data_manager_get_energy_buckets(buckets);
+        for (uint8_t i = 0; i < bucket_count; i++) {
+            ui_set_energy_bucket(buckets[i].start, (uint16_t) (buckets[i].energy * 1000));
+        }
+    }
+
+    if (changed_fields & DM_DF_MASK(DM_DF_MAX_DEMAND_MONTH)) {
+        ui_set_new_max_peak_demand((uint16_t) (meter_data->max_demand_active_month.demand * 1000));
+    }
+
+    if (first_run && (changed_fields & DM_DF_MASK(DM_DF_P1_TIMESTAMP))) {
+        first_run = false;
+        ui_set_initialized(true);
+        ui_set_max_peak_line((uint16_t) (meter_data->max_demand_active_month.demand * 1000));
+    }
+
+    xSemaphoreGive(lvgl_mutex);
+    ui_task_wake();
+}
@@ -12,6 +12,7 @@
 #include <stdbool.h>
 #include <time.h>
 #include <string.h>
+#include <strings.h>
 #include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -26,6 +27,7 @@
 #include "data_manager.h"
 #include "networking.h"
 #include "web_client.h"
+#include "local_clock.h"
 
 #define DISCONNECTED_STATUS_FAILED_REQ_COUNT 5  // Number of consecutive failed requests before setting the status to disconnected
 #define REQUEST_INTERVAL_MS 2000
@@ -417,6 +419,13 @@ static esp_err_t http_event_handler(esp_http_client_event_t *e) {
             break;
         case HTTP_EVENT_ON_HEADER:
             ESP_LOGV(TAG, "HTTP_EVENT_ON_HEADER");
+            // Use the time of the server to correct the local clock
+            if (strcasecmp(e->header_key, "Date") == 0) {
+                time_t date;
+                if (local_clock_parse_http_date(e->header_value, &date)) {
+                    local_clock_discipline(LOCAL_CLOCK_SOURCE_HTTP, date, LOCAL_CLOCK_HTTP_MAX_LAG_S);
+                }
+            }
             break;
         case HTTP_EVENT_ON_DATA:
             ESP_LOGV(TAG, "HTTP_EVENT_ON_DATA");
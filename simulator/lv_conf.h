@@ -0,0 +1,38 @@
+/**
+ * @file lv_conf.h
+ * @brief LVGL configuration of the simulator
+ *
+ * Only the options that differ from the LVGL defaults are set, the same as in the firmware (Kconfig, sdkconfig.defaults).
+ * Keep these in sync, the render times and screenshots depend on them.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+// Colors, the ST7789 is driven in RGB565
+#define LV_COLOR_DEPTH 16
+#define LV_COLOR_16_SWAP 0
+
+// Memory, the LVGL heap of the firmware (the large UI buffers are allocated with ui_alloc_large())
+#define LV_MEM_CUSTOM 0
+#define LV_MEM_SIZE (64U * 1024U)
+
+// The tick is the virtual clock of the simulator, so the runs are reproducible
+#define LV_TICK_CUSTOM 1
+#define LV_TICK_CUSTOM_INCLUDE "sim_hal.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (sim_tick_get())
+
+// Keep one decoded image (img_decoder.c)
+#define LV_IMG_CACHE_DEF_SIZE 1
+
+// Logging
+#define LV_USE_LOG 1
+#define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF 1
+
+// Fonts used by the UI
+#define LV_FONT_MONTSERRAT_12 1
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_20 1
+
+#endif //LV_CONF_H
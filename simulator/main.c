@@ -0,0 +1,111 @@
+/**
+ * @file main.c
+ * @brief Host simulator of the UI
+ *
+ * Runs the UI of the firmware (main/ui) on the host, driven by a script (see sim_script.c), and prints the frame
+ * statistics at the end. The time is virtual, so a run renders the same frames every time and the screenshots
+ * can be compared pixel by pixel.
+ *
+ * Usage: kwartiwi_sim [--csv FILE] [--update-references] SCRIPT
+ *   --csv FILE             Write the render time and area of every frame to FILE
+ *   --update-references    Save the display as the reference of every compare command, instead of comparing it
+ *
+ * Exit status: 0 on success, 1 if a compare command found differences or its reference is missing, 2 on an error.
+ * With SDL (SIMULATOR_SDL) the window stays open after the script, until it is closed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "sim_display.h"
+#include "sim_script.h"
+
+#define EXIT_MISMATCH 1
+#define EXIT_ERROR 2
+#define INTERACTIVE_STEP_MS 100
+
+// Function prototypes
+static void print_usage(const char * program);
+
+
+int main(int argc, char ** argv) {
+    const char * script_path = NULL;
+    const char * csv_path = NULL;
+    FILE * csv_file = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--update-references") == 0) {
+            sim_script_set_update_references(true);
+        }
+        else if (argv[i][0] != '-' && script_path == NULL) {
+            script_path = argv[i];
+        }
+        else {
+            print_usage(argv[0]);
+            return EXIT_ERROR;
+        }
+    }
+    if (script_path == NULL) {
+        print_usage(argv[0]);
+        return EXIT_ERROR;
+    }
+
+    FILE * script = fopen(script_path, "r");
+    if (script == NULL) {
+        fprintf(stderr, "Could not open %s\n", script_path);
+        return EXIT_ERROR;
+    }
+    if (csv_path != NULL) {
+        csv_file = fopen(csv_path, "w");
+        if (csv_file == NULL) {
+            fprintf(stderr, "Could not open %s\n", csv_path);
+            return EXIT_ERROR;
+        }
+    }
+
+    // The UI shows the local time, use UTC so the screenshots do not depend on the host
+    setenv("TZ", "UTC0", 1);
+    tzset();
+
+    lv_init();
+    sim_display_init(csv_file);
+
+    sim_script_result_t result = sim_script_run(script, script_path);
+    fclose(script);
+    sim_display_print_stats("Frames after the last stats command");
+
+#if SIMULATOR_SDL
+    if (result != SIM_SCRIPT_ERROR) {
+        while (sim_display_run(INTERACTIVE_STEP_MS)) {
+        }
+    }
+#endif
+
+    if (csv_file != NULL) {
+        fclose(csv_file);
+    }
+
+    switch (result) {
+        case SIM_SCRIPT_OK:
+        case SIM_SCRIPT_QUIT:
+            return EXIT_SUCCESS;
+        case SIM_SCRIPT_MISMATCH:
+            return EXIT_MISMATCH;
+        default:
+            return EXIT_ERROR;
+    }
+}
+
+/**
+ * @brief Print the command line usage
+ *
+ * @param[in] program The name of the program
+ */
+static void print_usage(const char * program) {
+    fprintf(stderr, "Usage: %s [--csv FILE] [--update-references] SCRIPT\n", program);
+}
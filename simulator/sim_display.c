@@ -0,0 +1,566 @@
+/**
+ * @file sim_display.c
+ * @brief Display driver of the simulator, with the frame time benchmark
+ *
+ * The display is a frame buffer in RAM, with the same resolution and render buffer mode as the firmware
+ * (UI_TASK_RENDER_BUFFER_MODE). With SIMULATOR_SDL the frame buffer is also shown in a window, and the mouse is the touchscreen.
+ *
+ * Every refresh is measured like in the firmware (see lvgl_refr_timer_cb() in ui_task.c):
+ *   - render time: the time spent in the LVGL refresh, including the copy to the frame buffer
+ *   - invalidated area: the pixels of the areas invalidated since the previous refresh (before LVGL joins them)
+ *   - rendered area: the pixels that were rendered and flushed (the dirty areas in direct mode)
+ * The frames are summarized by sim_display_print_stats(), and optionally written to a CSV file.
+ *
+ * The TE signal of the display can be simulated (sim_display_set_te()), like UI_TASK_TE_SYNC_SIMULATED in the firmware:
+ * a refresh waits for the next TE signal in virtual time, and the display is refreshed once per TE period.
+ * The transfer of a frame is modelled from its rendered area and the bus of the firmware, a frame is missed when its
+ * transfer is not done before the next TE signal. The render time of the host is not included, it is not the render
+ * time of the device.
+ *
+ * Screenshots are saved as binary PPM files of the frame buffer, so they can be compared pixel by pixel.
+ * A snapshot is a copy of the frame buffer in memory, to compare two renderings of the same run.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "ui_task.h"
+#include "sim_hal.h"
+#include "sim_display.h"
+
+#if SIMULATOR_SDL
+#include "SDL.h"
+#define SDL_ZOOM 2
+#endif
+
+#define DISPLAY_PX (UI_TASK_DISPLAY_WIDTH * UI_TASK_DISPLAY_HEIGHT)
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_PARTIAL_DOUBLE
+#define DRAW_BUFFER_PX (DISPLAY_PX / 5)
+#define DRAW_BUFFER_COUNT 2
+#elif UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+#define DRAW_BUFFER_PX DISPLAY_PX
+#define DRAW_BUFFER_COUNT 1
+#else
+#define DRAW_BUFFER_PX (DISPLAY_PX / 10)
+#define DRAW_BUFFER_COUNT 1
+#endif
+#define STATS_INITIAL_CAPACITY 1024
+#define BUS_BYTES_PER_S 10000000        // The i80 bus of the firmware, 8 bits at PIXEL_CLOCK_HZ (ui_task.c)
+
+typedef struct {
+    uint32_t frames;
+    uint64_t render_us;
+    uint64_t invalidated_px;
+    uint64_t rendered_px;
+    uint32_t * frame_render_us;     // Render time of every frame, for the percentiles
+    uint32_t capacity;              // Size of frame_render_us
+} frame_stats_t;
+
+// Static variables
+static lv_color_t frame_buffer[DISPLAY_PX];
+static lv_color_t draw_buffer_1[DRAW_BUFFER_PX];
+#if DRAW_BUFFER_COUNT == 2
+static lv_color_t draw_buffer_2[DRAW_BUFFER_PX];
+#endif
+static lv_disp_draw_buf_t disp_buf;
+static lv_disp_drv_t disp_drv;
+static lv_indev_drv_t pointer_indev_drv;
+static frame_stats_t stats = {0};
+static uint32_t frame_rendered_px = 0;
+static FILE * csv;
+static uint32_t te_period_us = 0;               // 0 when the TE signal is off
+static uint64_t te_start_us = 0;                // Virtual time of the first TE signal
+static uint64_t te_stats_start_us = 0;          // Virtual time of the start of the TE statistics
+static sim_display_te_stats_t te_stats = {0};
+#if SIMULATOR_SDL
+static SDL_Renderer * renderer;
+static SDL_Texture * texture;
+static lv_point_t mouse_point = {0};
+static bool mouse_pressed = false;
+#endif
+
+// Function prototypes
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map);
+static void refr_timer_cb(lv_timer_t * timer);
+static void wait_for_te(void);
+static void add_te_frame(uint32_t rendered_px);
+static void copy_area(const lv_area_t * area, const lv_color_t * pixels, lv_coord_t stride);
+static void pointer_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data);
+static void add_frame(uint32_t render_us, uint32_t invalidated_px, uint32_t rendered_px);
+static int compare_u32(const void * a, const void * b);
+static uint64_t get_time_us(void);
+#if SIMULATOR_SDL
+static bool poll_sdl_events(void);
+#endif
+
+
+/**
+ * @brief Initialize the display and the touchscreen input
+ *
+ * @note Must be called after lv_init()
+ *
+ * @param[in] csv_file The file to write the statistics of every frame to, NULL to not write them
+ */
+void sim_display_init(FILE * csv_file) {
+    csv = csv_file;
+    if (csv != NULL) {
+        fprintf(csv, "tick_ms,render_us,invalidated_px,rendered_px\n");
+    }
+
+    stats.frame_render_us = malloc(STATS_INITIAL_CAPACITY * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(stats.frame_render_us);
+    stats.capacity = STATS_INITIAL_CAPACITY;
+
+#if DRAW_BUFFER_COUNT == 2
+    lv_disp_draw_buf_init(&disp_buf, draw_buffer_1, draw_buffer_2, DRAW_BUFFER_PX);
+#else
+    lv_disp_draw_buf_init(&disp_buf, draw_buffer_1, NULL, DRAW_BUFFER_PX);
+#endif
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = UI_TASK_DISPLAY_WIDTH;
+    disp_drv.ver_res = UI_TASK_DISPLAY_HEIGHT;
+#if UI_TASK_RENDER_BUFFER_MODE == UI_TASK_RENDER_BUFFER_FULL_PSRAM
+    disp_drv.direct_mode = 1;
+#endif
+    lv_disp_t * disp = lv_disp_drv_register(&disp_drv);
+    lv_timer_set_cb(_lv_disp_get_refr_timer(disp), refr_timer_cb);
+
+    lv_indev_drv_init(&pointer_indev_drv);
+    pointer_indev_drv.type = LV_INDEV_TYPE_POINTER;
+    pointer_indev_drv.read_cb = pointer_read_cb;
+    lv_indev_drv_register(&pointer_indev_drv);
+
+#if SIMULATOR_SDL
+    SDL_Init(SDL_INIT_VIDEO);
+    SDL_Window * window = SDL_CreateWindow("KWARTIWI", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                                           UI_TASK_DISPLAY_WIDTH * SDL_ZOOM, UI_TASK_DISPLAY_HEIGHT * SDL_ZOOM, 0);
+    renderer = SDL_CreateRenderer(window, -1, 0);
+    SDL_RenderSetLogicalSize(renderer, UI_TASK_DISPLAY_WIDTH, UI_TASK_DISPLAY_HEIGHT);
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGB565, SDL_TEXTUREACCESS_STREAMING,
+                                UI_TASK_DISPLAY_WIDTH, UI_TASK_DISPLAY_HEIGHT);
+#endif
+}
+
+/**
+ * @brief Run the UI for some time
+ *
+ * The virtual time advances from LVGL timer deadline to deadline, like the UI task sleeps on the device.
+ * Headless this runs as fast as possible, with SDL the time also passes in real time.
+ *
+ * @param[in] ms The time to run in ms
+ * @return false if the window was closed
+ */
+bool sim_display_run(uint32_t ms) {
+    uint32_t end_ms = sim_tick_get() + ms;
+
+    // A refresh that waits for the TE signal also advances the time (wait_for_te())
+    while ((int32_t)(end_ms - sim_tick_get()) > 0) {
+        uint32_t sleep_ms = lv_timer_handler();
+        int32_t left_ms = (int32_t)(end_ms - sim_tick_get());
+
+        if (left_ms <= 0) {
+            break;
+        }
+        if (sleep_ms < 1) {
+            sleep_ms = 1;
+        }
+        if (sleep_ms > (uint32_t)left_ms) {
+            sleep_ms = (uint32_t)left_ms;
+        }
+
+#if SIMULATOR_SDL
+        SDL_Delay(sleep_ms);
+        if (!poll_sdl_events()) {
+            return false;
+        }
+#endif
+        sim_tick_advance(sleep_ms);
+    }
+
+    lv_timer_handler();
+    return true;
+}
+
+/**
+ * @brief Save the display as a binary PPM file
+ *
+ * Pending changes are rendered first, this refresh is not counted in the statistics.
+ *
+ * @param[in] path The file
+ * @return true on success
+ */
+bool sim_display_save_ppm(const char * path) {
+    FILE * file = fopen(path, "wb");
+
+    if (file == NULL) {
+        return false;
+    }
+
+    lv_refr_now(NULL);
+    fprintf(file, "P6\n%d %d\n255\n", UI_TASK_DISPLAY_WIDTH, UI_TASK_DISPLAY_HEIGHT);
+    for (uint32_t i = 0; i < DISPLAY_PX; i++) {
+        lv_color32_t c = {.full = lv_color_to32(frame_buffer[i])};
+        uint8_t rgb[3] = {c.ch.red, c.ch.green, c.ch.blue};
+        fwrite(rgb, 1, sizeof(rgb), file);
+    }
+
+    return fclose(file) == 0;
+}
+
+/**
+ * @brief Compare the display with a PPM file saved by sim_display_save_ppm()
+ *
+ * Pending changes are rendered first, this refresh is not counted in the statistics.
+ *
+ * @param[in] path The file
+ * @return The number of pixels that differ, SIM_DISPLAY_COMPARE_ERROR if the file could not be read or has another size
+ */
+long sim_display_compare_ppm(const char * path) {
+    FILE * file = fopen(path, "rb");
+    int width;
+    int height;
+    int max_value;
+    long diff = 0;
+
+    if (file == NULL) {
+        return SIM_DISPLAY_COMPARE_ERROR;
+    }
+    if (fscanf(file, "P6 %d %d %d", &width, &height, &max_value) != 3 || fgetc(file) == EOF ||
+        width != UI_TASK_DISPLAY_WIDTH || height != UI_TASK_DISPLAY_HEIGHT || max_value != 255) {
+        fclose(file);
+        return SIM_DISPLAY_COMPARE_ERROR;
+    }
+
+    lv_refr_now(NULL);
+    for (uint32_t i = 0; i < DISPLAY_PX; i++) {
+        lv_color32_t c = {.full = lv_color_to32(frame_buffer[i])};
+        uint8_t rgb[3];
+        if (fread(rgb, 1, sizeof(rgb), file) != sizeof(rgb)) {
+            diff = SIM_DISPLAY_COMPARE_ERROR;
+            break;
+        }
+        if (rgb[0] != c.ch.red || rgb[1] != c.ch.green || rgb[2] != c.ch.blue) {
+            diff++;
+        }
+    }
+
+    fclose(file);
+    return diff;
+}
+
+/**
+ * @brief Copy the display
+ *
+ * Pending changes are rendered first, this refresh is not counted in the statistics.
+ *
+ * @return The copy of the frame buffer, free it with free()
+ */
+lv_color_t * sim_display_snapshot(void) {
+    lv_color_t * snapshot = malloc(sizeof(frame_buffer));
+
+    LV_ASSERT_MALLOC(snapshot);
+    lv_refr_now(NULL);
+    memcpy(snapshot, frame_buffer, sizeof(frame_buffer));
+    return snapshot;
+}
+
+/**
+ * @brief Compare the display with a snapshot taken by sim_display_snapshot()
+ *
+ * Pending changes are rendered first, this refresh is not counted in the statistics.
+ *
+ * @param[in] snapshot The snapshot
+ * @return The number of pixels that differ
+ */
+long sim_display_compare_snapshot(const lv_color_t * snapshot) {
+    long diff = 0;
+
+    lv_refr_now(NULL);
+    for (uint32_t i = 0; i < DISPLAY_PX; i++) {
+        if (snapshot[i].full != frame_buffer[i].full) {
+            diff++;
+        }
+    }
+    return diff;
+}
+
+/**
+ * @brief Print the statistics of the frames since the previous call, and reset them
+ *
+ * @param[in] title The title of the statistics
+ */
+void sim_display_print_stats(const char * title) {
+    printf("== %s\n", title);
+    if (stats.frames == 0) {
+        printf("No frames rendered\n");
+        return;
+    }
+
+    qsort(stats.frame_render_us, stats.frames, sizeof(uint32_t), compare_u32);
+    printf("frames:           %lu\n", (unsigned long)stats.frames);
+    printf("render time [us]: avg %lu, p50 %lu, p95 %lu, max %lu\n",
+           (unsigned long)(stats.render_us / stats.frames),
+           (unsigned long)stats.frame_render_us[stats.frames / 2],
+           (unsigned long)stats.frame_render_us[stats.frames * 95 / 100],
+           (unsigned long)stats.frame_render_us[stats.frames - 1]);
+    printf("invalidated [px]: avg %lu per frame, %llu total\n",
+           (unsigned long)(stats.invalidated_px / stats.frames), (unsigned long long)stats.invalidated_px);
+    printf("rendered [px]:    avg %lu per frame, %llu total\n",
+           (unsigned long)(stats.rendered_px / stats.frames), (unsigned long long)stats.rendered_px);
+
+    stats.frames = 0;
+    stats.render_us = 0;
+    stats.invalidated_px = 0;
+    stats.rendered_px = 0;
+}
+
+/**
+ * @brief Start or stop the simulated TE signal, and reset the TE statistics
+ *
+ * The first TE signal is one period after the current virtual time. Like in the firmware the display is refreshed
+ * at the TE rate (see init_lvgl() in ui_task.c).
+ *
+ * @param[in] period_us The TE period in us, 0 to stop the TE signal
+ */
+void sim_display_set_te(uint32_t period_us) {
+    lv_timer_t * refr_timer = _lv_disp_get_refr_timer(lv_disp_get_default());
+
+    te_period_us = period_us;
+    te_start_us = (uint64_t)sim_tick_get() * 1000;
+    te_stats_start_us = te_start_us;
+    te_stats = (sim_display_te_stats_t) {0};
+    lv_timer_set_period(refr_timer, period_us > 0 ? period_us / 1000 : LV_DISP_DEF_REFR_PERIOD);
+}
+
+/**
+ * @brief Get the TE statistics since sim_display_set_te() or the previous call, and reset them
+ *
+ * @param[out] stats The statistics, all 0 when the TE signal is off
+ */
+void sim_display_get_te_stats(sim_display_te_stats_t * stats) {
+    uint64_t now_us = (uint64_t)sim_tick_get() * 1000;
+
+    if (te_period_us > 0) {
+        te_stats.periods = (uint32_t)((now_us - te_start_us) / te_period_us - (te_stats_start_us - te_start_us) / te_period_us);
+    }
+    *stats = te_stats;
+    te_stats = (sim_display_te_stats_t) {0};
+    te_stats_start_us = now_us;
+}
+
+/**
+ * @brief LVGL flush callback, copy the rendered area to the frame buffer
+ *
+ * In direct mode LVGL flushes the full render buffer once per dirty area, with the full display as area.
+ * Like in the firmware (see lvgl_flush_cb() in ui_task.c) only the last flush of the frame copies the dirty areas.
+ *
+ * @param[in] drv The display driver
+ * @param[in] area The rendered area, the full display in direct mode
+ * @param[in] color_map The rendered pixels, the full render buffer in direct mode
+ */
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map) {
+    if (drv->direct_mode) {
+        if (lv_disp_flush_is_last(drv)) {
+            lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+
+            for (uint16_t i = 0; i < disp->inv_p; i++) {
+                if (!disp->inv_area_joined[i]) {
+                    const lv_area_t * dirty = &disp->inv_areas[i];
+
+                    copy_area(dirty, color_map + dirty->y1 * UI_TASK_DISPLAY_WIDTH + dirty->x1, UI_TASK_DISPLAY_WIDTH);
+                }
+            }
+        }
+    }
+    else {
+        copy_area(area, color_map, lv_area_get_width(area));
+    }
+
+#if SIMULATOR_SDL
+    if (lv_disp_flush_is_last(drv)) {
+        SDL_UpdateTexture(texture, NULL, frame_buffer, UI_TASK_DISPLAY_WIDTH * sizeof(lv_color_t));
+        SDL_RenderClear(renderer);
+        SDL_RenderCopy(renderer, texture, NULL, NULL);
+        SDL_RenderPresent(renderer);
+    }
+#endif
+
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * @brief Copy a rendered area to the frame buffer, and add it to the rendered area of the frame
+ *
+ * @param[in] area The area
+ * @param[in] pixels The rendered pixel at (area->x1, area->y1)
+ * @param[in] stride The number of pixels from one row of the rendered pixels to the next
+ */
+static void copy_area(const lv_area_t * area, const lv_color_t * pixels, lv_coord_t stride) {
+    lv_coord_t width = lv_area_get_width(area);
+    const lv_color_t * src = pixels;
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&frame_buffer[y * UI_TASK_DISPLAY_WIDTH + area->x1], src, width * sizeof(lv_color_t));
+        src += stride;
+    }
+    frame_rendered_px += lv_area_get_size(area);
+}
+
+/**
+ * @brief LVGL display refresh timer callback, refresh the display and measure the frame
+ *
+ * @param[in] timer The refresh timer, its user data is the display
+ */
+static void refr_timer_cb(lv_timer_t * timer) {
+    lv_disp_t * disp = timer->user_data;
+    uint32_t invalidated_px = 0;
+
+    if (te_period_us > 0 && disp->inv_p > 0) {
+        wait_for_te();
+    }
+
+    uint16_t areas = disp->inv_p;
+    for (uint16_t i = 0; i < areas; i++) {
+        invalidated_px += lv_area_get_size(&disp->inv_areas[i]);
+    }
+
+    frame_rendered_px = 0;
+    uint64_t start = get_time_us();
+    _lv_disp_refr_timer(timer);
+    uint32_t render_us = (uint32_t)(get_time_us() - start);
+
+    if (areas > 0) {
+        add_frame(render_us, invalidated_px, frame_rendered_px);
+        if (te_period_us > 0) {
+            add_te_frame(frame_rendered_px);
+        }
+    }
+}
+
+/**
+ * @brief Wait for the next TE signal, advance the virtual time to it
+ *
+ * Like wait_for_te() in the firmware, the frame starts on the first TE signal after the start of the wait.
+ *
+ * @uses te_period_us, te_start_us
+ */
+static void wait_for_te(void) {
+    uint64_t now_us = (uint64_t)sim_tick_get() * 1000;
+    uint64_t te_us = te_start_us + ((now_us - te_start_us) / te_period_us + 1) * te_period_us;
+
+    // The virtual time is in ms, the frame starts at the first ms after the TE signal
+    sim_tick_advance((uint32_t)((te_us + 999) / 1000 - now_us / 1000));
+}
+
+/**
+ * @brief Add a frame to the TE statistics
+ *
+ * The transfer of the frame starts on the TE signal, it takes the time to send the rendered area over the bus.
+ *
+ * @param[in] rendered_px The rendered area
+ */
+static void add_te_frame(uint32_t rendered_px) {
+    uint64_t transfer_us = (uint64_t)rendered_px * sizeof(lv_color_t) * 1000000 / BUS_BYTES_PER_S;
+
+    te_stats.frames++;
+    if (transfer_us > te_period_us) {
+        te_stats.missed_frames++;
+    }
+}
+
+
+/**
+ * @brief LVGL pointer callback, the mouse in the SDL window, released when headless
+ *
+ * @param[in] drv unused
+ * @param[out] data The pointer state
+ */
+static void pointer_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data) {
+#if SIMULATOR_SDL
+    data->point = mouse_point;
+    data->state = mouse_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+#else
+    data->state = LV_INDEV_STATE_REL;
+#endif
+}
+
+/**
+ * @brief Add a frame to the statistics
+ *
+ * @param[in] render_us The render time
+ * @param[in] invalidated_px The invalidated area
+ * @param[in] rendered_px The rendered area
+ */
+static void add_frame(uint32_t render_us, uint32_t invalidated_px, uint32_t rendered_px) {
+    if (stats.frames == stats.capacity) {
+        stats.capacity *= 2;
+        stats.frame_render_us = realloc(stats.frame_render_us, stats.capacity * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(stats.frame_render_us);
+    }
+
+    stats.frame_render_us[stats.frames++] = render_us;
+    stats.render_us += render_us;
+    stats.invalidated_px += invalidated_px;
+    stats.rendered_px += rendered_px;
+
+    if (csv != NULL) {
+        fprintf(csv, "%lu,%lu,%lu,%lu\n", (unsigned long)sim_tick_get(), (unsigned long)render_us,
+                (unsigned long)invalidated_px, (unsigned long)rendered_px);
+    }
+}
+
+/**
+ * @brief qsort comparison of two uint32_t
+ */
+static int compare_u32(const void * a, const void * b) {
+    uint32_t va = *(const uint32_t *)a;
+    uint32_t vb = *(const uint32_t *)b;
+
+    return (va > vb) - (va < vb);
+}
+
+/**
+ * @brief Get the real (not virtual) time, to measure the render time
+ *
+ * @return A monotonic time in us
+ */
+static uint64_t get_time_us(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+#if SIMULATOR_SDL
+/**
+ * @brief Handle the SDL events, the mouse is the touchscreen
+ *
+ * @return false if the window was closed
+ */
+static bool poll_sdl_events(void) {
+    SDL_Event event;
+
+    while (SDL_PollEvent(&event)) {
+        switch (event.type) {
+            case SDL_QUIT:
+                return false;
+            case SDL_MOUSEBUTTONDOWN:
+            case SDL_MOUSEBUTTONUP:
+                mouse_pressed = event.type == SDL_MOUSEBUTTONDOWN;
+                mouse_point.x = (lv_coord_t)event.button.x;
+                mouse_point.y = (lv_coord_t)event.button.y;
+                break;
+            case SDL_MOUSEMOTION:
+                mouse_point.x = (lv_coord_t)event.motion.x;
+                mouse_point.y = (lv_coord_t)event.motion.y;
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+#endif
@@ -0,0 +1,28 @@
+#ifndef SIM_DISPLAY_H
+#define SIM_DISPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "lvgl.h"
+
+#define SIM_DISPLAY_COMPARE_ERROR (-1)  // Result of sim_display_compare_ppm() when the file can not be compared
+
+typedef struct {
+    uint32_t periods;           // TE periods
+    uint32_t frames;            // Frames started on the TE signal
+    uint32_t missed_frames;     // Frames not transferred before the next TE signal
+} sim_display_te_stats_t;
+
+// Function prototypes
+void sim_display_init(FILE * csv_file);
+bool sim_display_run(uint32_t ms);
+bool sim_display_save_ppm(const char * path);
+long sim_display_compare_ppm(const char * path);
+lv_color_t * sim_display_snapshot(void);
+long sim_display_compare_snapshot(const lv_color_t * snapshot);
+void sim_display_print_stats(const char * title);
+void sim_display_set_te(uint32_t period_us);
+void sim_display_get_te_stats(sim_display_te_stats_t * te_stats);
+
+#endif //SIM_DISPLAY_H
@@ -0,0 +1,95 @@
+/**
+ * @file sim_hal.c
+ * @brief The device state of the simulator
+ *
+ * A virtual clock (the LVGL tick and the wall clock), the setup state, and stubs for the touchscreen functions of
+ * ui_task.c used by the UI. The clock only advances with sim_tick_advance(), so every run renders the same frames.
+ */
+
+#include <stdio.h>
+#include "lvgl.h"
+#include "ui_task.h"
+#include "sim_hal.h"
+
+#define SIM_DEFAULT_TIME 1704067200     // 2024-01-01 00:00:00 UTC
+
+// Static variables
+static uint32_t tick_ms = 0;
+static time_t time_base = SIM_DEFAULT_TIME;    // Wall clock at tick 0
+static bool setup_done = true;
+
+
+/**
+ * @brief Get the virtual time, used as the LVGL tick (see lv_conf.h)
+ *
+ * @return The virtual time in ms
+ */
+uint32_t sim_tick_get(void) {
+    return tick_ms;
+}
+
+/**
+ * @brief Advance the virtual time
+ *
+ * @param[in] ms The time to advance in ms
+ */
+void sim_tick_advance(uint32_t ms) {
+    tick_ms += ms;
+}
+
+/**
+ * @brief Set the wall clock
+ *
+ * @param[in] time The current time
+ */
+void sim_set_time(time_t time) {
+    time_base = time - tick_ms / 1000;
+}
+
+/**
+ * @brief Get the wall clock, it advances with the virtual time
+ *
+ * @return The current time
+ */
+time_t sim_get_time(void) {
+    return time_base + tick_ms / 1000;
+}
+
+/**
+ * @brief Set whether the device is setup, the main screen is shown when it is
+ *
+ * @note Must be set before ui_init()
+ *
+ * @param[in] setup true if the device is setup
+ */
+void sim_set_setup(bool setup) {
+    setup_done = setup;
+}
+
+/**
+ * @brief Check if the device is setup
+ *
+ * @return true if the device is setup
+ */
+bool sim_is_setup(void) {
+    return setup_done;
+}
+
+/**
+ * @brief Stub of the touchscreen calibration of ui_task.c
+ */
+void ui_task_calibrate_tp(lv_point_t src_points[], lv_point_t cal_points[], size_t len) {
+    printf("[I] sim: Touchscreen calibrated with %zu points\n", len);
+}
+
+/**
+ * @brief Stub of the touchscreen calibration storage of ui_task.c
+ */
+void ui_task_store_tp_cal(void) {
+}
+
+/**
+ * @brief Stub of the raw touchscreen input selection of ui_task.c
+ */
+void ui_task_use_raw_tp_data(bool raw) {
+}
@@ -0,0 +1,16 @@
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+// Function prototypes
+uint32_t sim_tick_get(void);
+void sim_tick_advance(uint32_t ms);
+void sim_set_time(time_t time);
+time_t sim_get_time(void);
+void sim_set_setup(bool setup);
+bool sim_is_setup(void);
+
+#endif //SIM_HAL_H
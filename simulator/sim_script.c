@@ -0,0 +1,634 @@
+/**
+ * @file sim_script.c
+ * @brief Scripted data for the simulator
+ *
+ * A script is a text file with one command per line, '#' starts a comment. The commands feed data to the UI through the
+ * same ui_* functions as ui_task.c on the device, and run the UI for some (virtual) time.
+ *
+ * Commands:
+ *   setup <0|1>                        Mark the device as setup or not (before start), default 1
+ *   time <unix time>                   Set the wall clock
+ *   start                              Initialize the UI (ui_init())
+ *   initialized                        ui_set_initialized(true), the main screen is shown
+ *   network                            ui_set_network_initialized(true)
+ *   wifi <0|1>                         ui_set_wifi_connected()
+ *   connected <0|1>                    ui_set_connected_status()
+ *   power <W>                          ui_set_power_consumption()
+ *   peak <W>                           ui_add_peak_demand_data_point() at the current time
+ *   max_peak <W>                       ui_set_new_max_peak_demand()
+ *   predicted <W>                      ui_set_predicted_peak()
+ *   energy <Wh>                        ui_set_energy_bucket() at the current time
+ *   samples <n> <interval ms> <min W> <max W>
+ *                                      Send n pseudo-random meter samples (power and peak), one every interval
+ *   profiler                           Show or hide the profiler overlay
+ *   readout_labels <0|1>               Show the power readout with labels instead of sprites (power_readout_show_labels())
+ *   invalidate                         Invalidate the whole display, the next frame is a full frame
+ *   te <period us>                     Start the simulated TE signal of the display, 0 stops it (sim_display_set_te())
+ *   te_check <min frames %> <min missed> <max missed>
+ *                                      Check the TE statistics since the te or the previous te_check command: at most
+ *                                      one frame per TE period and at least the given percentage, and the number of
+ *                                      missed frames. The run fails if one is out of range
+ *   wait <ms>                          Run the UI
+ *   screenshot <file.ppm>              Save the display
+ *   compare <file.ppm>                 Compare the display with a reference screenshot, the run fails if it differs
+ *   snapshot <name>                    Keep a copy of the display in memory
+ *   compare_snapshot <name>            Compare the display with a snapshot, the run fails if it differs
+ *   stats [title]                      Print the frame statistics since the previous stats command
+ *
+ * The data commands (connected ... readout_labels) require the main screen, run "start" first.
+ *
+ * The reference of a compare command is relative to the directory of the script, screenshots are relative to
+ * the working directory. With --update-references (sim_script_set_update_references()) the compare commands save
+ * the display as the new reference instead. A missing reference fails the run like a difference, the script continues.
+ * Compare before the profiler overlay is shown, it shows the render times of the host.
+ */
+
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+#include <stdlib.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "sim_hal.h"
+#include "sim_display.h"
+#include "sim_script.h"
+#include "power_readout.h"
+
+#define MAX_LINE_LENGTH 256
+#define SAMPLES_SEED 0x2545F491u
+#define MAX_PATH_LENGTH 512
+#define MAX_SNAPSHOTS 8
+#define MAX_SNAPSHOT_NAME_LENGTH 32
+
+typedef sim_script_result_t (*command_handler_t)(const char * args);
+
+typedef struct {
+    const char * name;
+    command_handler_t handler;
+    bool needs_main_screen;
+} command_t;
+
+typedef struct {
+    char name[MAX_SNAPSHOT_NAME_LENGTH];
+    lv_color_t * pixels;            // NULL if the slot is free
+} snapshot_t;
+
+// Function prototypes
+static sim_script_result_t cmd_setup(const char * args);
+static sim_script_result_t cmd_time(const char * args);
+static sim_script_result_t cmd_start(const char * args);
+static sim_script_result_t cmd_initialized(const char * args);
+static sim_script_result_t cmd_network(const char * args);
+static sim_script_result_t cmd_wifi(const char * args);
+static sim_script_result_t cmd_connected(const char * args);
+static sim_script_result_t cmd_power(const char * args);
+static sim_script_result_t cmd_peak(const char * args);
+static sim_script_result_t cmd_max_peak(const char * args);
+static sim_script_result_t cmd_predicted(const char * args);
+static sim_script_result_t cmd_energy(const char * args);
+static sim_script_result_t cmd_samples(const char * args);
+static sim_script_result_t cmd_profiler(const char * args);
+static sim_script_result_t cmd_readout_labels(const char * args);
+static sim_script_result_t cmd_invalidate(const char * args);
+static sim_script_result_t cmd_te(const char * args);
+static sim_script_result_t cmd_te_check(const char * args);
+static sim_script_result_t cmd_wait(const char * args);
+static sim_script_result_t cmd_screenshot(const char * args);
+static sim_script_result_t cmd_compare(const char * args);
+static sim_script_result_t cmd_snapshot(const char * args);
+static sim_script_result_t cmd_compare_snapshot(const char * args);
+static sim_script_result_t cmd_stats(const char * args);
+static bool parse_long(const char * args, long * value, long min, long max);
+static uint32_t next_random(void);
+static snapshot_t * find_snapshot(const char * name);
+
+static const command_t commands[] = {
+        {"setup",            cmd_setup,              false},
+        {"time",             cmd_time,               false},
+        {"start",            cmd_start,              false},
+        {"initialized",      cmd_initialized,        false},
+        {"network",          cmd_network,            false},
+        {"wifi",             cmd_wifi,               false},
+        {"connected",        cmd_connected,          true},
+        {"power",            cmd_power,              true},
+        {"peak",             cmd_peak,               true},
+        {"max_peak",         cmd_max_peak,           true},
+        {"predicted",        cmd_predicted,          true},
+        {"energy",           cmd_energy,             true},
+        {"samples",          cmd_samples,            true},
+        {"profiler",         cmd_profiler,           true},
+        {"readout_labels",   cmd_readout_labels,     true},
+        {"invalidate",       cmd_invalidate,         false},
+        {"te",               cmd_te,                 false},
+        {"te_check",         cmd_te_check,           false},
+        {"wait",             cmd_wait,               false},
+        {"screenshot",       cmd_screenshot,         false},
+        {"compare",          cmd_compare,            false},
+        {"snapshot",         cmd_snapshot,           false},
+        {"compare_snapshot", cmd_compare_snapshot,   false},
+        {"stats",            cmd_stats,              false},
+};
+
+// Static variables
+static bool ui_started = false;
+static uint32_t random_state = SAMPLES_SEED;
+static bool update_references = false;
+static char script_dir[MAX_PATH_LENGTH] = "";  // Directory of the running script, with a trailing '/', or empty
+static snapshot_t snapshots[MAX_SNAPSHOTS];
+
+
+/**
+ * @brief Run a script
+ *
+ * @param[in] file The script
+ * @param[in] name The name of the script, for the error messages
+ * @return SIM_SCRIPT_OK, SIM_SCRIPT_MISMATCH if a compare failed (the script continues after it),
+ *         or the result of the command that stopped the script
+ */
+sim_script_result_t sim_script_run(FILE * file, const char * name) {
+    char line[MAX_LINE_LENGTH];
+    unsigned line_number = 0;
+    sim_script_result_t result = SIM_SCRIPT_OK;
+
+    const char * dir_end = strrchr(name, '/');
+    size_t dir_length = dir_end != NULL ? (size_t)(dir_end - name) + 1 : 0;
+    if (dir_length >= sizeof(script_dir)) {
+        fprintf(stderr, "%s: path too long\n", name);
+        return SIM_SCRIPT_ERROR;
+    }
+    memcpy(script_dir, name, dir_length);
+    script_dir[dir_length] = '\0';
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        line_number++;
+
+        // Strip the comment and the trailing whitespace
+        char * end = strchr(line, '#');
+        if (end == NULL) {
+            end = line + strlen(line);
+        }
+        while (end > line && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n')) {
+            end--;
+        }
+        *end = '\0';
+
+        // Split the command and the arguments
+        char * command = line + strspn(line, " \t");
+        if (*command == '\0') {
+            continue;
+        }
+        char * args = command + strcspn(command, " \t");
+        if (*args != '\0') {
+            *args++ = '\0';
+            args += strspn(args, " \t");
+        }
+
+        const command_t * cmd = NULL;
+        for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++) {
+            if (strcmp(commands[i].name, command) == 0) {
+                cmd = &commands[i];
+                break;
+            }
+        }
+        if (cmd == NULL) {
+            fprintf(stderr, "%s:%u: unknown command '%s'\n", name, line_number, command);
+            return SIM_SCRIPT_ERROR;
+        }
+        if (cmd->needs_main_screen && !main_screen_initialized) {
+            fprintf(stderr, "%s:%u: '%s' requires the main screen, run 'start' first\n", name, line_number, command);
+            return SIM_SCRIPT_ERROR;
+        }
+
+        sim_script_result_t cmd_result = cmd->handler(args);
+        if (cmd_result == SIM_SCRIPT_MISMATCH) {
+            result = SIM_SCRIPT_MISMATCH;
+        }
+        else if (cmd_result == SIM_SCRIPT_ERROR) {
+            fprintf(stderr, "%s:%u: invalid arguments for '%s': '%s'\n", name, line_number, command, args);
+            return cmd_result;
+        }
+        else if (cmd_result != SIM_SCRIPT_OK) {
+            return cmd_result;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Save the display as the reference of the compare commands, instead of comparing it
+ *
+ * @param[in] update true to update the references
+ */
+void sim_script_set_update_references(bool update) {
+    update_references = update;
+}
+
+/**
+ * @brief setup <0|1>
+ */
+static sim_script_result_t cmd_setup(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, 1)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    sim_set_setup(value != 0);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief time <unix time>
+ */
+static sim_script_result_t cmd_time(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, LONG_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    sim_set_time((time_t)value);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief start
+ */
+static sim_script_result_t cmd_start(const char * args) {
+    if (ui_started) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_init();
+    ui_started = true;
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief initialized
+ */
+static sim_script_result_t cmd_initialized(const char * args) {
+    ui_set_initialized(true);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief network
+ */
+static sim_script_result_t cmd_network(const char * args) {
+    ui_set_network_initialized(true);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief wifi <0|1>
+ */
+static sim_script_result_t cmd_wifi(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, 1)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_set_wifi_connected(value != 0);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief connected <0|1>
+ */
+static sim_script_result_t cmd_connected(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, 1)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_set_connected_status(value != 0);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief power <W>
+ */
+static sim_script_result_t cmd_power(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, UINT16_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_set_power_consumption((uint16_t)value);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief peak <W>
+ */
+static sim_script_result_t cmd_peak(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, UINT16_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_add_peak_demand_data_point(sim_get_time(), (uint16_t)value);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief max_peak <W>
+ */
+static sim_script_result_t cmd_max_peak(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, UINT16_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_set_new_max_peak_demand((uint16_t)value);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief predicted <W>
+ */
+static sim_script_result_t cmd_predicted(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, UINT16_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_set_predicted_peak((uint16_t)value);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief energy <Wh>
+ */
+static sim_script_result_t cmd_energy(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, UINT16_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    ui_set_energy_bucket(sim_get_time(), (uint16_t)value);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief samples <n> <interval ms> <min W> <max W>
+ *
+ * Every sample updates the power readout and the peak demand chart, like a meter telegram on the device.
+ * The values are pseudo-random with a fixed seed, so every run gets the same values.
+ */
+static sim_script_result_t cmd_samples(const char * args) {
+    long count;
+    long interval_ms;
+    long min_w;
+    long max_w;
+
+    if (sscanf(args, "%ld %ld %ld %ld", &count, &interval_ms, &min_w, &max_w) != 4 ||
+        count < 0 || interval_ms < 1 || min_w < 0 || max_w > UINT16_MAX || min_w > max_w) {
+        return SIM_SCRIPT_ERROR;
+    }
+
+    for (long i = 0; i < count; i++) {
+        uint16_t value = (uint16_t)(min_w + next_random() % (uint32_t)(max_w - min_w + 1));
+        ui_set_power_consumption(value);
+        ui_add_peak_demand_data_point(sim_get_time(), value);
+        if (!sim_display_run((uint32_t)interval_ms)) {
+            return SIM_SCRIPT_QUIT;
+        }
+    }
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief profiler
+ */
+static sim_script_result_t cmd_profiler(const char * args) {
+    ui_toggle_profiler_overlay();
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief readout_labels <0|1>
+ */
+static sim_script_result_t cmd_readout_labels(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, 1)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    power_readout_show_labels(value != 0);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief invalidate
+ */
+static sim_script_result_t cmd_invalidate(const char * args) {
+    lv_obj_invalidate(lv_scr_act());
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief te <period us>
+ */
+static sim_script_result_t cmd_te(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, UINT32_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    sim_display_set_te((uint32_t)value);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief te_check <min frames %> <min missed> <max missed>
+ *
+ * The frames are paced by the TE signal when there is at most one frame per TE period. The UI must change more often
+ * than the TE signal to reach 100 %.
+ */
+static sim_script_result_t cmd_te_check(const char * args) {
+    long min_frames_percent;
+    long min_missed;
+    long max_missed;
+    sim_display_te_stats_t te_stats;
+
+    if (sscanf(args, "%ld %ld %ld", &min_frames_percent, &min_missed, &max_missed) != 3 ||
+        min_frames_percent < 0 || min_frames_percent > 100 || min_missed < 0 || min_missed > max_missed) {
+        return SIM_SCRIPT_ERROR;
+    }
+
+    sim_display_get_te_stats(&te_stats);
+    printf("TE periods %lu, frames %lu, missed %lu\n", (unsigned long)te_stats.periods,
+           (unsigned long)te_stats.frames, (unsigned long)te_stats.missed_frames);
+    if (te_stats.frames > te_stats.periods ||
+        (uint64_t)te_stats.frames * 100 < (uint64_t)te_stats.periods * (uint64_t)min_frames_percent ||
+        (long)te_stats.missed_frames < min_missed || (long)te_stats.missed_frames > max_missed) {
+        printf("MISMATCH TE: expected at most 1 and at least %ld %% frames per TE period, %ld-%ld missed\n",
+               min_frames_percent, min_missed, max_missed);
+        return SIM_SCRIPT_MISMATCH;
+    }
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief wait <ms>
+ */
+static sim_script_result_t cmd_wait(const char * args) {
+    long value;
+
+    if (!parse_long(args, &value, 0, UINT32_MAX)) {
+        return SIM_SCRIPT_ERROR;
+    }
+    return sim_display_run((uint32_t)value) ? SIM_SCRIPT_OK : SIM_SCRIPT_QUIT;
+}
+
+/**
+ * @brief screenshot <file.ppm>
+ */
+static sim_script_result_t cmd_screenshot(const char * args) {
+    if (*args == '\0') {
+        return SIM_SCRIPT_ERROR;
+    }
+    if (!sim_display_save_ppm(args)) {
+        fprintf(stderr, "Could not save %s\n", args);
+        return SIM_SCRIPT_ERROR;
+    }
+    printf("Saved %s\n", args);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief compare <file.ppm>
+ */
+static sim_script_result_t cmd_compare(const char * args) {
+    char path[MAX_PATH_LENGTH];
+
+    if (*args == '\0') {
+        return SIM_SCRIPT_ERROR;
+    }
+    if (snprintf(path, sizeof(path), "%s%s", args[0] == '/' ? "" : script_dir, args) >= (int)sizeof(path)) {
+        return SIM_SCRIPT_ERROR;
+    }
+
+    if (update_references) {
+        if (!sim_display_save_ppm(path)) {
+            fprintf(stderr, "Could not save %s\n", path);
+            return SIM_SCRIPT_ERROR;
+        }
+        printf("Updated %s\n", path);
+        return SIM_SCRIPT_OK;
+    }
+
+    FILE * reference = fopen(path, "rb");
+    if (reference == NULL) {
+        printf("MISMATCH %s: no reference, record it with --update-references\n", path);
+        return SIM_SCRIPT_MISMATCH;
+    }
+    fclose(reference);
+
+    long diff = sim_display_compare_ppm(path);
+    if (diff == SIM_DISPLAY_COMPARE_ERROR) {
+        fprintf(stderr, "Could not compare with %s\n", path);
+        return SIM_SCRIPT_ERROR;
+    }
+    if (diff > 0) {
+        printf("MISMATCH %s: %ld pixels differ\n", path, diff);
+        return SIM_SCRIPT_MISMATCH;
+    }
+    printf("Match %s\n", path);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief snapshot <name>
+ */
+static sim_script_result_t cmd_snapshot(const char * args) {
+    if (*args == '\0' || strlen(args) >= MAX_SNAPSHOT_NAME_LENGTH) {
+        return SIM_SCRIPT_ERROR;
+    }
+
+    snapshot_t * snapshot = find_snapshot(args);
+    if (snapshot == NULL) {
+        snapshot = find_snapshot(NULL);
+        if (snapshot == NULL) {
+            fprintf(stderr, "More than %d snapshots\n", MAX_SNAPSHOTS);
+            return SIM_SCRIPT_ERROR;
+        }
+        strcpy(snapshot->name, args);
+    }
+    free(snapshot->pixels);
+    snapshot->pixels = sim_display_snapshot();
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief compare_snapshot <name>
+ */
+static sim_script_result_t cmd_compare_snapshot(const char * args) {
+    const snapshot_t * snapshot = find_snapshot(args);
+
+    if (*args == '\0' || snapshot == NULL) {
+        return SIM_SCRIPT_ERROR;
+    }
+
+    long diff = sim_display_compare_snapshot(snapshot->pixels);
+    if (diff > 0) {
+        printf("MISMATCH snapshot %s: %ld pixels differ\n", args, diff);
+        return SIM_SCRIPT_MISMATCH;
+    }
+    printf("Match snapshot %s\n", args);
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief stats [title]
+ */
+static sim_script_result_t cmd_stats(const char * args) {
+    sim_display_print_stats(*args != '\0' ? args : "Frames");
+    return SIM_SCRIPT_OK;
+}
+
+/**
+ * @brief Parse a single integer argument
+ *
+ * @param[in] args The arguments
+ * @param[out] value The value
+ * @param[in] min The min value
+ * @param[in] max The max value
+ * @return true if args is one integer between min and max
+ */
+static bool parse_long(const char * args, long * value, long min, long max) {
+    char * end;
+
+    *value = strtol(args, &end, 0);
+    return end != args && *end == '\0' && *value >= min && *value <= max;
+}
+
+/**
+ * @brief Get the next pseudo-random number (xorshift32)
+ *
+ * @note lv_rand() is not used, it is also used by the UI in the simulator, that would change the values
+ *
+ * @return The number
+ */
+static uint32_t next_random(void) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+/**
+ * @brief Find a snapshot
+ *
+ * @param[in] name The name of the snapshot, NULL to find a free slot
+ * @return The snapshot, NULL if not found
+ */
+static snapshot_t * find_snapshot(const char * name) {
+    for (size_t i = 0; i < MAX_SNAPSHOTS; i++) {
+        if (name == NULL ? snapshots[i].pixels == NULL
+                         : snapshots[i].pixels != NULL && strcmp(snapshots[i].name, name) == 0) {
+            return &snapshots[i];
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,18 @@
+#ifndef SIM_SCRIPT_H
+#define SIM_SCRIPT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+typedef enum {
+    SIM_SCRIPT_OK,
+    SIM_SCRIPT_MISMATCH,        // A screenshot differs from its reference or the reference is missing (compare command)
+    SIM_SCRIPT_ERROR,           // Invalid command or argument
+    SIM_SCRIPT_QUIT,            // The window was closed
+} sim_script_result_t;
+
+// Function prototypes
+sim_script_result_t sim_script_run(FILE * file, const char * name);
+void sim_script_set_update_references(bool update);
+
+#endif //SIM_SCRIPT_H
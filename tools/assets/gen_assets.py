@@ -0,0 +1,548 @@
+#!/usr/bin/env python3
+"""
+Generate the LVGL image and font assets of the UI from their sources.
+
+The assets are listed in assets.json, every asset has its own format:
+  Images (PNG sources):
+    - true_color    RGB565 (+ alpha when the source has transparency), blits without decoding
+    - indexed_Nbit  Palette with 2^N colors (N = 1, 2, 4 or 8), the source may not have more colors
+    - rle           RGB565 + alpha, run-length encoded, decoded once when the image is opened (img_decoder.c)
+    - qoi           QOI encoded RGBA, decoded once when the image is opened (img_decoder.c)
+  Fonts (TTF sources, converted with lv_font_conv):
+    - Only the glyphs in "symbols" are included, with "bpp" bits per pixel, optionally compressed
+    - Fonts are skipped (the checked-in file is kept) when their source or lv_font_conv is not available
+
+The generated C files are checked in, so the firmware builds without this script and its dependencies.
+All assets are converted before the first file is written, nothing is written when one of them fails.
+After generating, a report shows the flash size of every asset, compared to true_color, and the RAM needed to
+decode the compressed images. img_decoder logs the decode time of the compressed images on the device (info level),
+pass a captured monitor log with --device-log to add it to the report.
+
+Usage:
+  gen_assets.py [--only NAME ...] [--report] [--device-log LOG]   Generate the assets (or only report with --report)
+  gen_assets.py extract IMAGE_C_FILE PNG_FILE                      Recreate a PNG source from a generated indexed image
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+ASSETS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.normpath(os.path.join(ASSETS_DIR, "..", ".."))
+MANIFEST = os.path.join(ASSETS_DIR, "assets.json")
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+RLE_MAGIC = b"RLE1"
+QOI_MAGIC = b"qoif"
+RLE_MAX_RUN = 128
+DECODE_LOG_RE = re.compile(r"Decoded (rle|qoi) image (\d+)x(\d+) \((\d+) bytes\) in (\d+) ms")
+
+
+# ---------------------------------------------------------------------------
+# PNG
+# ---------------------------------------------------------------------------
+
+class Image:
+    def __init__(self, width, height, pixels, palette=None, indices=None):
+        self.width = width
+        self.height = height
+        self.pixels = pixels        # List of (r, g, b, a), row by row
+        self.palette = palette      # List of (r, g, b, a) for palette images, else None
+        self.indices = indices      # Palette index of every pixel for palette images, else None
+
+    def has_alpha(self):
+        return any(p[3] != 255 for p in self.pixels)
+
+
+def _unfilter(data, width, height, bpp_bits):
+    stride = (width * bpp_bits + 7) // 8
+    pixel_bytes = max(1, bpp_bits // 8)
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        filter_type = data[pos]
+        row = bytearray(data[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = row[i - pixel_bytes] if i >= pixel_bytes else 0
+            b = prev[i]
+            c = prev[i - pixel_bytes] if i >= pixel_bytes else 0
+            if filter_type == 1:
+                row[i] = (row[i] + a) & 0xFF
+            elif filter_type == 2:
+                row[i] = (row[i] + b) & 0xFF
+            elif filter_type == 3:
+                row[i] = (row[i] + (a + b) // 2) & 0xFF
+            elif filter_type == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                row[i] = (row[i] + pred) & 0xFF
+            elif filter_type != 0:
+                raise ValueError("Unknown PNG filter %d" % filter_type)
+        rows.append(row)
+        prev = row
+    return rows
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("%s is not a PNG file" % path)
+
+    pos = len(PNG_SIGNATURE)
+    idat = b""
+    plte = None
+    trns = None
+    while pos < len(data):
+        length, chunk_type = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if chunk_type == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif chunk_type == b"PLTE":
+            plte = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif chunk_type == b"tRNS":
+            trns = chunk
+        elif chunk_type == b"IDAT":
+            idat += chunk
+        elif chunk_type == b"IEND":
+            break
+
+    if interlace != 0:
+        raise ValueError("%s: interlaced PNG files are not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    if color_type != 3 and depth != 8:
+        raise ValueError("%s: only 8 bit PNG files are supported (or palette images)" % path)
+
+    rows = _unfilter(zlib.decompress(idat), width, height, channels * depth)
+    pixels = []
+    indices = None
+    palette = None
+    if color_type == 3:
+        palette = [plte[i] + ((trns[i] if trns is not None and i < len(trns) else 255),) for i in range(len(plte))]
+        indices = []
+        for row in rows:
+            for x in range(width):
+                bit = x * depth
+                index = (row[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+                indices.append(index)
+                pixels.append(palette[index])
+    else:
+        for row in rows:
+            for x in range(width):
+                px = row[x * channels:(x + 1) * channels]
+                if color_type == 0:
+                    pixels.append((px[0], px[0], px[0], 255))
+                elif color_type == 2:
+                    pixels.append((px[0], px[1], px[2], 255))
+                elif color_type == 4:
+                    pixels.append((px[0], px[0], px[0], px[1]))
+                else:
+                    pixels.append(tuple(px))
+    return Image(width, height, pixels, palette, indices)
+
+
+def write_png(path, image):
+    def chunk(chunk_type, payload):
+        return struct.pack(">I", len(payload)) + chunk_type + payload + struct.pack(">I", zlib.crc32(chunk_type + payload))
+
+    raw = bytearray()
+    if image.palette is not None:
+        ihdr = struct.pack(">IIBBBBB", image.width, image.height, 8, 3, 0, 0, 0)
+        for y in range(image.height):
+            raw.append(0)
+            raw += bytes(image.indices[y * image.width:(y + 1) * image.width])
+        extra = chunk(b"PLTE", b"".join(bytes(c[:3]) for c in image.palette))
+        extra += chunk(b"tRNS", bytes(c[3] for c in image.palette))
+    else:
+        ihdr = struct.pack(">IIBBBBB", image.width, image.height, 8, 6, 0, 0, 0)
+        for y in range(image.height):
+            raw.append(0)
+            for p in image.pixels[y * image.width:(y + 1) * image.width]:
+                raw += bytes(p)
+        extra = b""
+
+    with open(path, "wb") as f:
+        f.write(PNG_SIGNATURE + chunk(b"IHDR", ihdr) + extra + chunk(b"IDAT", zlib.compress(bytes(raw), 9)) + chunk(b"IEND", b""))
+
+
+# ---------------------------------------------------------------------------
+# Image encoders
+# ---------------------------------------------------------------------------
+
+def rgb565(pixel, swap):
+    value = ((pixel[0] >> 3) << 11) | ((pixel[1] >> 2) << 5) | (pixel[2] >> 3)
+    return struct.pack(">H" if swap else "<H", value)
+
+
+def encode_true_color(image, swap):
+    alpha = image.has_alpha()
+    out = bytearray()
+    for p in image.pixels:
+        out += rgb565(p, swap)
+        if alpha:
+            out.append(p[3])
+    return bytes(out), "LV_IMG_CF_TRUE_COLOR_ALPHA" if alpha else "LV_IMG_CF_TRUE_COLOR"
+
+
+def encode_indexed(image, bpp):
+    max_colors = 1 << bpp
+    if image.palette is not None and len(image.palette) <= max_colors:
+        palette = list(image.palette)
+        indices = image.indices
+    else:
+        palette = []
+        lookup = {}
+        indices = []
+        for p in image.pixels:
+            if p not in lookup:
+                lookup[p] = len(palette)
+                palette.append(p)
+            indices.append(lookup[p])
+        if len(palette) > max_colors:
+            raise ValueError("%d colors do not fit in a %d bit palette, reduce the colors of the source" % (len(palette), bpp))
+    palette += [(0, 0, 0, 0)] * (max_colors - len(palette))
+
+    out = bytearray()
+    for r, g, b, a in palette:
+        out += bytes((b, g, r, a))      # lv_color32_t
+    for y in range(image.height):
+        row = bytearray((image.width * bpp + 7) // 8)
+        for x in range(image.width):
+            bit = x * bpp
+            row[bit // 8] |= indices[y * image.width + x] << (8 - bpp - bit % 8)
+        out += row
+    return bytes(out), "LV_IMG_CF_INDEXED_%dBIT" % bpp
+
+
+def encode_rle(image, swap):
+    """
+    RLE of RGB565 + alpha pixels, in the byte order of LV_IMG_CF_TRUE_COLOR_ALPHA.
+    A packet starts with a control byte: bit 7 set is a run of (n & 0x7F) + 1 times the next pixel,
+    bit 7 clear is (n + 1) literal pixels.
+    """
+    units = [rgb565(p, swap) + bytes((p[3],)) for p in image.pixels]
+    out = bytearray(RLE_MAGIC)
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:RLE_MAX_RUN]
+            del literals[:RLE_MAX_RUN]
+            out.append(len(chunk) - 1)
+            out.extend(b"".join(chunk))
+
+    i = 0
+    while i < len(units):
+        run = 1
+        while i + run < len(units) and run < RLE_MAX_RUN and units[i + run] == units[i]:
+            run += 1
+        if run >= 2:
+            flush_literals()
+            out.append(0x80 | (run - 1))
+            out.extend(units[i])
+        else:
+            literals.append(units[i])
+        i += run
+    flush_literals()
+    return bytes(out), "LV_IMG_CF_RAW_ALPHA"
+
+
+def encode_qoi(image):
+    """QOI (https://qoiformat.org), 4 channels, sRGB."""
+    out = bytearray(QOI_MAGIC + struct.pack(">IIBB", image.width, image.height, 4, 0))
+    index = [(0, 0, 0, 0)] * 64
+    prev = (0, 0, 0, 255)
+    run = 0
+    for n, px in enumerate(image.pixels):
+        if px == prev:
+            run += 1
+            if run == 62 or n == len(image.pixels) - 1:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run > 0:
+            out.append(0xC0 | (run - 1))
+            run = 0
+        r, g, b, a = px
+        h = (r * 3 + g * 5 + b * 7 + a * 11) % 64
+        if index[h] == px:
+            out.append(h)
+        else:
+            index[h] = px
+            if a == prev[3]:
+                dr = (r - prev[0] + 128) % 256 - 128
+                dg = (g - prev[1] + 128) % 256 - 128
+                db = (b - prev[2] + 128) % 256 - 128
+                if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                    out.append(0x80 | (dg + 32))
+                    out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+                else:
+                    out += bytes((0xFE, r, g, b))
+            else:
+                out += bytes((0xFF, r, g, b, a))
+        prev = px
+    out += b"\x00" * 7 + b"\x01"
+    return bytes(out), "LV_IMG_CF_RAW_ALPHA"
+
+
+# ---------------------------------------------------------------------------
+# C output
+# ---------------------------------------------------------------------------
+
+C_PREAMBLE = """#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+"""
+
+
+def c_bytes(data, per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def image_c(asset, image, variants, cf):
+    """variants is a list of the data for LV_COLOR_16_SWAP 0 and 1, or a single item if it does not depend on it."""
+    symbol = asset["symbol"]
+    attribute = "LV_ATTRIBUTE_IMG_" + symbol.upper()
+    out = "/* Generated by tools/assets/gen_assets.py from %s (%s), do not edit */\n\n" % (asset["source"], asset["format"])
+    out += C_PREAMBLE
+    if len(variants) > 1:
+        out += "#if LV_COLOR_DEPTH != 16\n#error \"%s is generated for LV_COLOR_DEPTH 16\"\n#endif\n\n" % symbol
+    out += "\n#ifndef LV_ATTRIBUTE_MEM_ALIGN\n#define LV_ATTRIBUTE_MEM_ALIGN\n#endif\n\n"
+    out += "#ifndef %s\n#define %s\n#endif\n\n" % (attribute, attribute)
+    out += "const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST %s uint8_t %s_map[] = {\n" % (attribute, symbol)
+    if len(variants) > 1:
+        out += "#if LV_COLOR_16_SWAP == 0\n%s\n#else\n%s\n#endif\n" % (c_bytes(variants[0]), c_bytes(variants[1]))
+    else:
+        out += c_bytes(variants[0]) + "\n"
+    out += "};\n\n"
+    out += "const lv_img_dsc_t %s = {\n" % symbol
+    out += "  .header.cf = %s,\n" % cf
+    out += "  .header.always_zero = 0,\n  .header.reserved = 0,\n"
+    out += "  .header.w = %d,\n  .header.h = %d,\n" % (image.width, image.height)
+    out += "  .data_size = %d,\n" % len(variants[0])
+    out += "  .data = %s_map,\n};\n" % symbol
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Assets
+# ---------------------------------------------------------------------------
+
+def generate_image(asset, write):
+    """Returns the report entry and the content of the output file (None when not writing)."""
+    image = read_png(os.path.join(ASSETS_DIR, asset["source"]))
+    fmt = asset["format"]
+
+    if fmt == "true_color":
+        normal, cf = encode_true_color(image, False)
+        variants = [normal, encode_true_color(image, True)[0]]
+    elif fmt.startswith("indexed_"):
+        data, cf = encode_indexed(image, int(fmt[len("indexed_"):-len("bit")]))
+        variants = [data]
+    elif fmt == "rle":
+        normal, cf = encode_rle(image, False)
+        variants = [normal, encode_rle(image, True)[0]]
+    elif fmt == "qoi":
+        data, cf = encode_qoi(image)
+        variants = [data]
+    else:
+        raise ValueError("%s: unknown image format %s" % (asset["name"], fmt))
+
+    content = image_c(asset, image, variants, cf) if write else None
+
+    true_color_size = len(encode_true_color(image, False)[0])
+    decoded_size = true_color_size if fmt in ("rle", "qoi") else 0
+    if decoded_size and not image.has_alpha():
+        decoded_size += image.width * image.height     # Always decoded with an alpha channel
+    return {
+        "name": asset["name"],
+        "format": fmt,
+        "size": "%dx%d" % (image.width, image.height),
+        "flash": len(variants[0]),
+        "true_color": true_color_size,
+        "decode_ram": decoded_size,
+        "decode_ms": None,
+    }, content
+
+
+def generate_font(asset, write):
+    """Returns the report entry and the content of the output file (None when not writing or skipped)."""
+    generated = None
+    if write:
+        converter = shutil.which("lv_font_conv")
+        source = os.path.join(ASSETS_DIR, asset["source"])
+        if converter is None:
+            print("warning: %s: lv_font_conv not found (npm install -g lv_font_conv), keeping the checked-in font"
+                  % asset["name"], file=sys.stderr)
+        elif not os.path.exists(source):
+            print("warning: %s: font source %s not found, keeping the checked-in font" % (asset["name"], source),
+                  file=sys.stderr)
+        else:
+            with tempfile.TemporaryDirectory() as tmp:
+                output = os.path.join(tmp, os.path.basename(asset["output"]))
+                cmd = [converter, "--font", source, "--size", str(asset["size"]), "--bpp", str(asset["bpp"]),
+                       "--symbols", asset["symbols"], "--format", "lvgl", "--lv-include", "lvgl.h", "-o", output]
+                if not asset.get("compress", False):
+                    cmd.append("--no-compress")
+                if subprocess.run(cmd).returncode != 0:
+                    raise RuntimeError("%s: lv_font_conv failed" % asset["name"])
+                with open(output) as f:
+                    generated = f.read()
+
+    if generated is not None:
+        content = generated
+    else:
+        with open(os.path.join(REPO_DIR, asset["output"])) as f:
+            content = f.read()
+    bitmap = re.search(r"glyph_bitmap\[\]\s*=\s*\{(.*?)\};", content, re.S)
+    flash = len(re.findall(r"0x[0-9a-fA-F]{1,2}", bitmap.group(1))) if bitmap else 0
+    return {
+        "name": asset["name"],
+        "format": "font %dpx %dbpp%s" % (asset["size"], asset["bpp"], " compressed" if asset.get("compress") else ""),
+        "size": "%d glyphs" % len(asset["symbols"]),
+        "flash": flash,
+        "true_color": None,
+        "decode_ram": 0,
+        "decode_ms": None,
+    }, generated
+
+
+def read_decode_times(results, log_file):
+    """Add the decode times logged by img_decoder to the report entries, an image is found by format, size and flash."""
+    with open(log_file, errors="replace") as f:
+        for line in f:
+            m = DECODE_LOG_RE.search(line)
+            if m is None:
+                continue
+            fmt, size, flash, ms = m.group(1), "%sx%s" % (m.group(2), m.group(3)), int(m.group(4)), int(m.group(5))
+            for r in results:
+                if r["format"] == fmt and r["size"] == size and r["flash"] == flash:
+                    r["decode_ms"] = ms if r["decode_ms"] is None else max(r["decode_ms"], ms)
+
+
+def print_report(results, device_log):
+    print("%-28s %-26s %-10s %10s %12s %11s %12s" % ("asset", "format", "size", "flash [B]", "vs RGB565",
+                                                    "decode RAM", "decode [ms]"))
+    total = 0
+    for r in results:
+        ratio = "%.0f%%" % (100.0 * r["flash"] / r["true_color"]) if r["true_color"] else "-"
+        decode = "%d" % r["decode_ram"] if r["decode_ram"] else "-"
+        if r["decode_ms"] is not None:
+            decode_ms = "%d" % r["decode_ms"]
+        else:
+            decode_ms = "?" if r["decode_ram"] and device_log else "-"
+        print("%-28s %-26s %-10s %10d %12s %11s %12s" % (r["name"], r["format"], r["size"], r["flash"], ratio, decode,
+                                                        decode_ms))
+        total += r["flash"]
+    print("%-28s %-26s %-10s %10d" % ("total", "", "", total))
+    print("\nrle and qoi images are decoded into RAM when they are opened, and kept in the LVGL image cache (1 entry).")
+    if device_log:
+        print("The decode times are the slowest decode of each image in %s, \"?\" if it was not decoded." % device_log)
+    else:
+        print("Pass a monitor log of the device with --device-log to report the decode time of these images.")
+
+
+def extract(c_file, png_file):
+    with open(c_file) as f:
+        content = f.read()
+    cf = re.search(r"\.header\.cf\s*=\s*LV_IMG_CF_INDEXED_(\d)BIT", content)
+    if cf is None:
+        raise ValueError("%s: only indexed images can be extracted" % c_file)
+    bpp = int(cf.group(1))
+    width = int(re.search(r"\.header\.w\s*=\s*(\d+)", content).group(1))
+    height = int(re.search(r"\.header\.h\s*=\s*(\d+)", content).group(1))
+    body = re.search(r"uint8_t\s+\w+\[\]\s*=\s*\{(.*?)\};", content, re.S).group(1)
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{1,2})", body))
+
+    colors = 1 << bpp
+    palette = [(data[i * 4 + 2], data[i * 4 + 1], data[i * 4], data[i * 4 + 3]) for i in range(colors)]
+    stride = (width * bpp + 7) // 8
+    indices = []
+    for y in range(height):
+        row = data[colors * 4 + y * stride:colors * 4 + (y + 1) * stride]
+        for x in range(width):
+            bit = x * bpp
+            indices.append((row[bit // 8] >> (8 - bpp - bit % 8)) & (colors - 1))
+    write_png(png_file, Image(width, height, [palette[i] for i in indices], palette, indices))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the LVGL assets of the UI")
+    parser.add_argument("--only", nargs="+", metavar="NAME", help="only handle these assets")
+    parser.add_argument("--report", action="store_true", help="only report, do not generate")
+    parser.add_argument("--device-log", metavar="LOG", help="monitor log of the device, to report the decode times")
+    sub = parser.add_subparsers(dest="command")
+    ext = sub.add_parser("extract", help="recreate a PNG source from a generated indexed image")
+    ext.add_argument("c_file")
+    ext.add_argument("png_file")
+    args = parser.parse_args()
+
+    if args.command == "extract":
+        extract(args.c_file, args.png_file)
+        return 0
+
+    with open(MANIFEST) as f:
+        manifest = json.load(f)
+
+    # Convert everything first, so a failing asset does not leave a partly regenerated tree
+    results = []
+    outputs = []
+    for asset in manifest["images"] + manifest["fonts"]:
+        if args.only and asset["name"] not in args.only:
+            continue
+        try:
+            if asset in manifest["images"]:
+                result, content = generate_image(asset, not args.report)
+            else:
+                result, content = generate_font(asset, not args.report)
+        except (RuntimeError, ValueError, OSError) as e:
+            print("error: %s" % e, file=sys.stderr)
+            print("error: nothing written", file=sys.stderr)
+            return 1
+        results.append(result)
+        if content is not None:
+            outputs.append((os.path.join(REPO_DIR, asset["output"]), content))
+
+    for path, content in outputs:
+        with open(path, "w") as f:
+            f.write(content)
+
+    if args.device_log:
+        try:
+            read_decode_times(results, args.device_log)
+        except OSError as e:
+            print("error: %s" % e, file=sys.stderr)
+            return 1
+    print_report(results, args.device_log)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,442 @@
+/**
+ * @file dsmr_bench.c
+ * @brief Host checks and throughput benchmark of the DSMR parser
+ *
+ * Feeds recorded telegrams (telegrams/ directory) to the parser of the firmware (main/dsmr_parser.c):
+ *   - every telegram on its own, split in reads of several sizes, and checks the result and the parsed fields
+ *   - all telegrams in one stream, after noise and a truncated telegram, and checks the sequence of results
+ * Then feeds the valid telegrams repeatedly, in reads of BENCH_READ_SIZE bytes, and reports the throughput.
+ *
+ * Usage: dsmr_bench [--iterations N] TELEGRAM_DIR
+ *
+ * Exit status: 0 if all checks passed, 1 if a check failed, 2 on an error.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "dsmr_parser.h"
+
+#define EXIT_CHECK_FAILED 1
+#define EXIT_ERROR 2
+#define MAX_PATH_LENGTH 512
+#define MAX_RESULTS 16
+#define DEFAULT_ITERATIONS 20000
+#define BENCH_READ_SIZE 128         // Bytes per read, like the UART reads of p1_serial.c
+#define ENERGY_TOLERANCE 0.0005     // kWh, the registers have 3 decimals
+#define POWER_TOLERANCE 0.0005f     // kW
+
+#define DEMAND_YEAR_FIELDS (DSMR_FIELD_TIMESTAMP | DSMR_FIELD_DELIVERED_TARIFF1 | DSMR_FIELD_DELIVERED_TARIFF2 | \
+                            DSMR_FIELD_RETURNED_TARIFF1 | DSMR_FIELD_RETURNED_TARIFF2 | DSMR_FIELD_ACTIVE_TARIFF | \
+                            DSMR_FIELD_POWER_DELIVERED | DSMR_FIELD_POWER_RETURNED | DSMR_FIELD_CURRENT_AVG_DEMAND | \
+                            DSMR_FIELD_MAX_DEMAND_MONTH | DSMR_FIELD_MAX_DEMAND_YEAR)
+#define REGISTER_FIELDS (DSMR_FIELD_DELIVERED_TARIFF1 | DSMR_FIELD_DELIVERED_TARIFF2 | DSMR_FIELD_RETURNED_TARIFF1 | \
+                         DSMR_FIELD_RETURNED_TARIFF2 | DSMR_FIELD_ACTIVE_TARIFF | DSMR_FIELD_POWER_DELIVERED | \
+                         DSMR_FIELD_POWER_RETURNED)
+
+typedef struct {
+    const char *file;
+    dsmr_parser_result_t result;
+    bool benchmark;             // Used by the benchmark, only valid telegrams
+    dsmr_telegram_t telegram;   // Expected fields, not checked for a CRC error
+} recorded_telegram_t;
+
+typedef struct {
+    uint8_t *data;
+    size_t len;
+} buffer_t;
+
+static const recorded_telegram_t recorded_telegrams[] = {
+        {
+                // Belgian e-MUCS meter, with the current average demand and the peaks of the last months
+                .file = "dsmr5_fluvius.txt",
+                .result = DSMR_PARSER_RESULT_TELEGRAM,
+                .benchmark = true,
+                .telegram = {
+                        .present_fields = DEMAND_YEAR_FIELDS,
+                        .crc_checked = true,
+                        .timestamp = 1678373121,                    // 2023-03-09 14:45:21 UTC
+                        .delivered_tariff1 = 123.456,
+                        .delivered_tariff2 = 234.567,
+                        .returned_tariff1 = 1.234,
+                        .returned_tariff2 = 2.345,
+                        .active_tariff = 1,
+                        .power_delivered = 0.512f,
+                        .power_returned = 0.0f,
+                        .current_avg_demand = 1.234f,
+                        .max_demand_month = {1677654900, 3.123f},   // 2023-03-01 07:15:00 UTC
+                        .max_demand_year = {
+                                {1670347800, 3.456f},               // 2022-12-06 17:30:00 UTC
+                                {1673978400, 4.321f},               // 2023-01-17 18:00:00 UTC
+                                {1676358000, 2.987f},               // 2023-02-14 07:00:00 UTC
+                        },
+                        .max_demand_year_items = 3,
+                },
+        },
+        {
+                // Dutch DSMR 5 meter in summer time, without demand fields
+                .file = "dsmr5_nl.txt",
+                .result = DSMR_PARSER_RESULT_TELEGRAM,
+                .benchmark = true,
+                .telegram = {
+                        .present_fields = DSMR_FIELD_TIMESTAMP | REGISTER_FIELDS,
+                        .crc_checked = true,
+                        .timestamp = 1499523067,                    // 2017-07-08 14:11:07 UTC
+                        .delivered_tariff1 = 671.578,
+                        .delivered_tariff2 = 842.472,
+                        .active_tariff = 2,
+                        .power_delivered = 0.333f,
+                },
+        },
+        {
+                // DSMR 2.2 meter, without timestamp and CRC
+                .file = "dsmr22_no_crc.txt",
+                .result = DSMR_PARSER_RESULT_TELEGRAM,
+                .benchmark = true,
+                .telegram = {
+                        .present_fields = REGISTER_FIELDS,
+                        .crc_checked = false,
+                        .delivered_tariff1 = 185.0,
+                        .delivered_tariff2 = 84.0,
+                        .returned_tariff1 = 13.0,
+                        .returned_tariff2 = 19.0,
+                        .active_tariff = 1,
+                        .power_delivered = 0.98f,
+                },
+        },
+        {
+                // The Fluvius telegram with a changed power value, and the original CRC
+                .file = "dsmr5_bad_crc.txt",
+                .result = DSMR_PARSER_RESULT_CRC_ERROR,
+                .benchmark = false,
+        },
+};
+
+#define RECORDED_TELEGRAM_COUNT (sizeof(recorded_telegrams) / sizeof(recorded_telegrams[0]))
+
+static const size_t read_sizes[] = {1, 7, 64, 0};   // 0: all data in one read
+
+// Function prototypes
+static bool load_file(const char *dir, const char *name, buffer_t *buffer);
+static uint8_t feed(dsmr_parser_t *parser, const buffer_t *buffer, size_t read_size,
+                    dsmr_parser_result_t results[], dsmr_telegram_t telegrams[]);
+static bool check_telegram(const char *name, const dsmr_telegram_t *expected, const dsmr_telegram_t *telegram);
+static bool check_recorded_telegrams(const buffer_t buffers[]);
+static bool check_stream(const buffer_t buffers[]);
+static void run_benchmark(const buffer_t buffers[], long iterations);
+static double get_time_s(void);
+static void print_usage(const char *program);
+
+
+int main(int argc, char **argv) {
+    const char *dir = NULL;
+    long iterations = DEFAULT_ITERATIONS;
+    buffer_t buffers[RECORDED_TELEGRAM_COUNT];
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = strtol(argv[++i], NULL, 10);
+        }
+        else if (argv[i][0] != '-' && dir == NULL) {
+            dir = argv[i];
+        }
+        else {
+            print_usage(argv[0]);
+            return EXIT_ERROR;
+        }
+    }
+    if (dir == NULL || iterations < 0) {
+        print_usage(argv[0]);
+        return EXIT_ERROR;
+    }
+
+    for (size_t i = 0; i < RECORDED_TELEGRAM_COUNT; i++) {
+        if (!load_file(dir, recorded_telegrams[i].file, &buffers[i])) {
+            fprintf(stderr, "Could not read %s/%s\n", dir, recorded_telegrams[i].file);
+            return EXIT_ERROR;
+        }
+    }
+
+    bool passed = check_recorded_telegrams(buffers);
+    passed &= check_stream(buffers);
+    printf("Checks %s\n", passed ? "passed" : "FAILED");
+
+    if (iterations > 0) {
+        run_benchmark(buffers, iterations);
+    }
+
+    for (size_t i = 0; i < RECORDED_TELEGRAM_COUNT; i++) {
+        free(buffers[i].data);
+    }
+    return passed ? EXIT_SUCCESS : EXIT_CHECK_FAILED;
+}
+
+/**
+ * @brief Read a file
+ *
+ * @param[in] dir The directory
+ * @param[in] name The name of the file
+ * @param[out] buffer The contents, free buffer->data when done
+ * @return true on success
+ */
+static bool load_file(const char *dir, const char *name, buffer_t *buffer) {
+    char path[MAX_PATH_LENGTH];
+
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    buffer->data = malloc(size > 0 ? (size_t)size : 1);
+    buffer->len = size > 0 ? fread(buffer->data, 1, (size_t)size, file) : 0;
+    fclose(file);
+
+    return buffer->data != NULL && size >= 0 && buffer->len == (size_t)size;
+}
+
+/**
+ * @brief Feed a buffer to the parser in reads of read_size bytes, like the serial port returns them
+ *
+ * @param[in, out] parser The parser
+ * @param[in] buffer The data
+ * @param[in] read_size The max number of bytes per read, 0 for one read
+ * @param[out] results The results other than DSMR_PARSER_RESULT_NONE, at most MAX_RESULTS
+ * @param[out] telegrams The parsed telegram of each result, may be NULL
+ * @return The number of results
+ */
+static uint8_t feed(dsmr_parser_t *parser, const buffer_t *buffer, size_t read_size,
+                    dsmr_parser_result_t results[], dsmr_telegram_t telegrams[]) {
+    uint8_t count = 0;
+    size_t offset = 0;
+
+    while (offset < buffer->len) {
+        size_t read_len = buffer->len - offset;
+        if (read_size > 0 && read_len > read_size) {
+            read_len = read_size;
+        }
+        const uint8_t *data = buffer->data + offset;
+        offset += read_len;
+
+        // The parser stops after each telegram, feed the rest of the read again
+        while (read_len > 0) {
+            dsmr_parser_result_t result;
+            size_t used = dsmr_parser_feed(parser, data, read_len, &result);
+            data += used;
+            read_len -= used;
+            if (result != DSMR_PARSER_RESULT_NONE && count < MAX_RESULTS) {
+                if (telegrams != NULL) {
+                    telegrams[count] = parser->telegram;
+                }
+                results[count++] = result;
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Compare a parsed telegram with the expected fields, and print the differences
+ *
+ * @param[in] name The name of the telegram, for the messages
+ * @param[in] expected The expected fields
+ * @param[in] telegram The parsed telegram
+ * @return true if the telegrams match
+ */
+static bool check_telegram(const char *name, const dsmr_telegram_t *expected, const dsmr_telegram_t *telegram) {
+    bool match = true;
+
+    #define CHECK(condition, field) \
+        if (!(condition)) { \
+            printf("FAIL %s: %s differs\n", name, field); \
+            match = false; \
+        }
+
+    CHECK(telegram->present_fields == expected->present_fields, "present_fields")
+    CHECK(telegram->crc_checked == expected->crc_checked, "crc_checked")
+    CHECK(telegram->timestamp == expected->timestamp, "timestamp")
+    CHECK(fabs(telegram->delivered_tariff1 - expected->delivered_tariff1) < ENERGY_TOLERANCE, "delivered_tariff1")
+    CHECK(fabs(telegram->delivered_tariff2 - expected->delivered_tariff2) < ENERGY_TOLERANCE, "delivered_tariff2")
+    CHECK(fabs(telegram->returned_tariff1 - expected->returned_tariff1) < ENERGY_TOLERANCE, "returned_tariff1")
+    CHECK(fabs(telegram->returned_tariff2 - expected->returned_tariff2) < ENERGY_TOLERANCE, "returned_tariff2")
+    CHECK(telegram->active_tariff == expected->active_tariff, "active_tariff")
+    CHECK(fabsf(telegram->power_delivered - expected->power_delivered) < POWER_TOLERANCE, "power_delivered")
+    CHECK(fabsf(telegram->power_returned - expected->power_returned) < POWER_TOLERANCE, "power_returned")
+    CHECK(fabsf(telegram->current_avg_demand - expected->current_avg_demand) < POWER_TOLERANCE, "current_avg_demand")
+    CHECK(telegram->max_demand_month.timestamp == expected->max_demand_month.timestamp, "max_demand_month.timestamp")
+    CHECK(fabsf(telegram->max_demand_month.demand - expected->max_demand_month.demand) < POWER_TOLERANCE, "max_demand_month.demand")
+    CHECK(telegram->max_demand_year_items == expected->max_demand_year_items, "max_demand_year_items")
+    for (uint8_t i = 0; i < expected->max_demand_year_items && i < telegram->max_demand_year_items; i++) {
+        CHECK(telegram->max_demand_year[i].timestamp == expected->max_demand_year[i].timestamp, "max_demand_year.timestamp")
+        CHECK(fabsf(telegram->max_demand_year[i].demand - expected->max_demand_year[i].demand) < POWER_TOLERANCE, "max_demand_year.demand")
+    }
+
+    #undef CHECK
+    return match;
+}
+
+/**
+ * @brief Feed every recorded telegram on its own, in reads of each size of read_sizes, and check the results
+ *
+ * @param[in] buffers The recorded telegrams
+ * @return true if all checks passed
+ */
+static bool check_recorded_telegrams(const buffer_t buffers[]) {
+    bool passed = true;
+    dsmr_parser_t parser;
+    dsmr_parser_result_t results[MAX_RESULTS];
+    dsmr_telegram_t telegrams[MAX_RESULTS];
+
+    for (size_t i = 0; i < RECORDED_TELEGRAM_COUNT; i++) {
+        const recorded_telegram_t *recorded = &recorded_telegrams[i];
+
+        for (size_t j = 0; j < sizeof(read_sizes) / sizeof(read_sizes[0]); j++) {
+            dsmr_parser_init(&parser);
+            uint8_t count = feed(&parser, &buffers[i], read_sizes[j], results, telegrams);
+
+            if (count != 1 || results[0] != recorded->result) {
+                printf("FAIL %s, reads of %zu bytes: %u results (first %d), expected 1 with result %d\n",
+                       recorded->file, read_sizes[j], count, count > 0 ? (int)results[0] : -1, recorded->result);
+                passed = false;
+                continue;
+            }
+            if (recorded->result == DSMR_PARSER_RESULT_TELEGRAM) {
+                passed &= check_telegram(recorded->file, &recorded->telegram, &telegrams[0]);
+            }
+        }
+        printf("Checked %s\n", recorded->file);
+    }
+
+    return passed;
+}
+
+/**
+ * @brief Feed all recorded telegrams in one stream, and check the sequence of results
+ *
+ * The stream starts with noise and a telegram that is cut off by the next header, like when the reading starts in the
+ * middle of a telegram. The truncated telegram must be dropped, without a result.
+ *
+ * @param[in] buffers The recorded telegrams
+ * @return true if all checks passed
+ */
+static bool check_stream(const buffer_t buffers[]) {
+    static const char noise[] = "\r\n1-0:1.8.1(000123.4";
+    bool passed = true;
+    dsmr_parser_t parser;
+    dsmr_parser_result_t results[MAX_RESULTS];
+    dsmr_telegram_t telegrams[MAX_RESULTS];
+    buffer_t stream = {0};
+
+    // Noise, half of the first telegram, then all telegrams
+    size_t len = sizeof(noise) - 1 + buffers[0].len / 2;
+    for (size_t i = 0; i < RECORDED_TELEGRAM_COUNT; i++) {
+        len += buffers[i].len;
+    }
+    stream.data = malloc(len);
+    if (stream.data == NULL) {
+        printf("FAIL stream: out of memory\n");
+        return false;
+    }
+    memcpy(stream.data, noise, sizeof(noise) - 1);
+    stream.len = sizeof(noise) - 1;
+    memcpy(stream.data + stream.len, buffers[0].data, buffers[0].len / 2);
+    stream.len += buffers[0].len / 2;
+    for (size_t i = 0; i < RECORDED_TELEGRAM_COUNT; i++) {
+        memcpy(stream.data + stream.len, buffers[i].data, buffers[i].len);
+        stream.len += buffers[i].len;
+    }
+
+    for (size_t j = 0; j < sizeof(read_sizes) / sizeof(read_sizes[0]); j++) {
+        dsmr_parser_init(&parser);
+        uint8_t count = feed(&parser, &stream, read_sizes[j], results, telegrams);
+
+        if (count != RECORDED_TELEGRAM_COUNT) {
+            printf("FAIL stream, reads of %zu bytes: %u results, expected %zu\n", read_sizes[j], count, RECORDED_TELEGRAM_COUNT);
+            passed = false;
+            continue;
+        }
+        for (size_t i = 0; i < RECORDED_TELEGRAM_COUNT; i++) {
+            const recorded_telegram_t *recorded = &recorded_telegrams[i];
+            if (results[i] != recorded->result) {
+                printf("FAIL stream, reads of %zu bytes: result %d for %s, expected %d\n",
+                       read_sizes[j], results[i], recorded->file, recorded->result);
+                passed = false;
+            }
+            else if (recorded->result == DSMR_PARSER_RESULT_TELEGRAM) {
+                passed &= check_telegram(recorded->file, &recorded->telegram, &telegrams[i]);
+            }
+        }
+        if (parser.telegram_count + parser.crc_error_count != RECORDED_TELEGRAM_COUNT) {
+            printf("FAIL stream, reads of %zu bytes: parser counted %lu telegrams and %lu CRC errors\n", read_sizes[j],
+                   (unsigned long)parser.telegram_count, (unsigned long)parser.crc_error_count);
+            passed = false;
+        }
+    }
+    printf("Checked the stream of all telegrams\n");
+
+    free(stream.data);
+    return passed;
+}
+
+/**
+ * @brief Feed the valid recorded telegrams repeatedly, and print the throughput of the parser
+ *
+ * @param[in] buffers The recorded telegrams
+ * @param[in] iterations The number of times every telegram is fed
+ */
+static void run_benchmark(const buffer_t buffers[], long iterations) {
+    dsmr_parser_t parser;
+    dsmr_parser_result_t results[MAX_RESULTS];
+    uint64_t bytes = 0;
+    uint64_t telegrams = 0;
+
+    dsmr_parser_init(&parser);
+    double start = get_time_s();
+    for (long n = 0; n < iterations; n++) {
+        for (size_t i = 0; i < RECORDED_TELEGRAM_COUNT; i++) {
+            if (!recorded_telegrams[i].benchmark) {
+                continue;
+            }
+            telegrams += feed(&parser, &buffers[i], BENCH_READ_SIZE, results, NULL);
+            bytes += buffers[i].len;
+        }
+    }
+    double elapsed = get_time_s() - start;
+
+    printf("== Benchmark\n");
+    printf("telegrams:  %llu (%llu bytes, reads of %d bytes)\n", (unsigned long long)telegrams,
+           (unsigned long long)bytes, BENCH_READ_SIZE);
+    printf("time [s]:   %.3f\n", elapsed);
+    if (elapsed > 0) {
+        printf("throughput: %.1f MB/s, %.0f telegrams/s\n", (double)bytes / elapsed / 1e6, (double)telegrams / elapsed);
+    }
+}
+
+/**
+ * @brief Get a monotonic time, to measure the benchmark
+ *
+ * @return The time in s
+ */
+static double get_time_s(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Print the command line usage
+ *
+ * @param[in] program The name of the program
+ */
+static void print_usage(const char *program) {
+    fprintf(stderr, "Usage: %s [--iterations N] TELEGRAM_DIR\n", program);
+}